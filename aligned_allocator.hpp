@@ -0,0 +1,75 @@
+#ifndef aligned_allocator_hpp
+#define aligned_allocator_hpp
+
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <utility>
+
+namespace ft {
+template < class T, size_t Align = 64 >
+class aligned_allocator {
+	static_assert((Align & (Align - 1)) == 0, "aligned_allocator alignment must be a power of two");
+	static_assert(Align >= sizeof(void*), "aligned_allocator alignment must be at least sizeof(void*)");
+public:
+	//MARK: - Member types
+	typedef T value_type;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+	template <class U>
+	struct rebind {
+		typedef aligned_allocator<U, Align> other;
+	};
+	static const size_t alignment = Align;
+
+	//MARK: - Constructors
+	aligned_allocator() {};
+	aligned_allocator (const aligned_allocator&) {};
+	template <class U>
+	aligned_allocator (const aligned_allocator<U, Align>&) {};
+
+	//MARK: - Allocation
+	pointer allocate (size_type n, const void* = 0) {
+		if (n > max_size())
+			throw std::bad_alloc();
+		size_t bytes = (n * sizeof(value_type) + Align - 1) / Align * Align;
+		void* ptr = 0;
+		if (::posix_memalign(&ptr, Align, bytes ? bytes : Align) != 0)
+			throw std::bad_alloc();
+		return static_cast<pointer>(ptr);
+	};
+	void deallocate (pointer p, size_type) {
+		::free(p);
+	};
+	size_type max_size() const {
+		return (std::numeric_limits<size_type>::max() - Align) / sizeof(value_type);
+	};
+
+	//MARK: - Construction
+	template <class U, class... Args>
+	void construct (U* p, Args&&... args) {
+		::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+	};
+	template <class U>
+	void destroy (U* p) {
+		p->~U();
+	};
+};
+
+//MARK: - Non-member function overloads
+template <class T, class U, size_t Align>
+bool operator== (const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&) {
+	return true;
+};
+template <class T, class U, size_t Align>
+bool operator!= (const aligned_allocator<T, Align>&, const aligned_allocator<U, Align>&) {
+	return false;
+};
+};
+
+#endif
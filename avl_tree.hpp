@@ -0,0 +1,1418 @@
+#ifndef avl_tree_hpp
+#define avl_tree_hpp
+
+#include <exception>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace ft {
+template <class Pair>
+struct select_first {
+	const typename Pair::first_type& operator()(const Pair& x) const {return x.first;}
+};
+template <class T>
+struct identity {
+	const T& operator()(const T& x) const {return x;}
+};
+
+struct transparent_less {
+	typedef void is_transparent;
+	template <class T, class U>
+	bool operator()(const T& x, const U& y) const {return x < y;}
+};
+template <class T>
+struct void_type {
+	typedef void type;
+};
+template <class Compare, class K, class Result, class = void>
+struct enable_if_transparent {
+};
+template <class Compare, class K, class Result>
+struct enable_if_transparent<Compare, K, Result, typename void_type<typename Compare::is_transparent>::type> {
+	typedef Result type;
+};
+
+template <class Key, class Value, class KeyOfValue, class Compare = std::less<Key>, class Alloc = std::allocator<Value> >
+class avl_tree {
+public:
+	//Links, heights and subtree size are laid out first so a descent reads them
+	//with the key from the same cache line; the value lives inline in the node.
+	typedef struct	s_node
+	{
+		struct s_node*	_left;
+		struct s_node*	_right;
+		struct s_node*	_head;
+		size_t			_s;
+		int				_l;
+		int				_r;
+		typename std::aligned_storage<sizeof(Value), alignof(Value)>::type	_data;
+	}				t_node;
+
+	//MARK: - Member types
+	typedef Key key_type;
+	typedef Value value_type;
+	typedef Compare key_compare;
+	typedef Alloc allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+
+private:
+	typedef typename Alloc::template rebind<t_node>::other Alloc_rebind;
+	enum { PARALLEL_GRAIN = 1 << 15 };
+	Alloc			_dataAlloc;
+	Alloc_rebind	_nodeAlloc;
+	Compare			_comp;
+
+	t_node*			_left;
+	t_node*			_right;
+	t_node*			_root;
+	size_t			_size;
+
+public:
+	//MARK: - Node access
+	static value_type& valueOf(t_node* node) {
+		return *reinterpret_cast<value_type*>(&node->_data);
+	}
+	static const key_type& keyOf(t_node* node) {
+		return KeyOfValue()(valueOf(node));
+	}
+	static size_t nodeSize(t_node* node) {
+		if (node == 0)
+			return 0;
+		return node->_s;
+	}
+	static size_t nodeRank(t_node* node) {
+		size_t res = nodeSize(node->_left);
+		while (node->_head) {
+			if (node == (node->_head)->_right)
+				res += nodeSize((node->_head)->_left) + 1;
+			node = node->_head;
+		}
+		return res;
+	}
+	//rend() wraps the _left sentinel, which sits one step before the minimum.
+	static difference_type reverseRank(t_node* node) {
+		if (node->_s == 0)
+			return -1;
+		return static_cast<difference_type>(nodeRank(node));
+	}
+	static t_node* nextNode(t_node* node) {
+		if (node->_right != 0) {
+			node = node->_right;
+			while (node->_left != 0)
+				node = node->_left;
+			return node;
+		}
+		while (node->_head && node == (node->_head)->_right)
+			node = node->_head;
+		return node->_head;
+	}
+	static t_node* prevNode(t_node* node) {
+		if (node->_left != 0) {
+			node = node->_left;
+			while (node->_right != 0)
+				node = node->_right;
+			return node;
+		}
+		while (node->_head && node == (node->_head)->_left)
+			node = node->_head;
+		return node->_head;
+	}
+
+	//MARK: - Node handle
+	class node_type {
+	public:
+		node_type() : _node(0) {};
+		node_type(node_type&& src) : _node(src._node), _dataAlloc(src._dataAlloc), _nodeAlloc(src._nodeAlloc) {
+			src._node = 0;
+		}
+		node_type& operator=(node_type&& src) {
+			if (this == &src)
+				return *this;
+			release();
+			_node = src._node;
+			_dataAlloc = src._dataAlloc;
+			_nodeAlloc = src._nodeAlloc;
+			src._node = 0;
+			return *this;
+		}
+		~node_type() {
+			release();
+		}
+		bool empty() const {
+			return _node == 0;
+		}
+		explicit operator bool() const {
+			return _node != 0;
+		}
+		allocator_type get_allocator() const {
+			return _dataAlloc;
+		}
+		value_type& value() const {
+			return valueOf(_node);
+		}
+		key_type& key() const {
+			return const_cast<key_type&>(keyOf(_node));
+		}
+		template <class V = value_type>
+		typename V::second_type& mapped() const {
+			return valueOf(_node).second;
+		}
+	private:
+		friend class avl_tree;
+		t_node*			_node;
+		Alloc			_dataAlloc;
+		Alloc_rebind	_nodeAlloc;
+		node_type(t_node* node, const Alloc& dataAlloc, const Alloc_rebind& nodeAlloc) : _node(node), _dataAlloc(dataAlloc), _nodeAlloc(nodeAlloc) {}
+		node_type(const node_type&);
+		node_type& operator=(const node_type&);
+		void release() {
+			if (_node == 0)
+				return;
+			_dataAlloc.destroy(&valueOf(_node));
+			_nodeAlloc.deallocate(_node, 1);
+			_node = 0;
+		}
+	};
+
+	//MARK: - Constructors
+	explicit avl_tree (const key_compare& comp = key_compare(),
+					   const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _comp(comp) {
+		_root = 0;
+		_left = endNodeCreator();
+		_right = endNodeCreator();
+		_size = 0;
+	};
+	avl_tree (const avl_tree& x) : _dataAlloc(x._dataAlloc), _comp(x._comp) {
+		_root = 0;
+		_left = endNodeCreator();
+		_right = endNodeCreator();
+		_size = 0;
+		*this = x;
+	};
+
+	//MARK: - Destructor
+	~avl_tree() {
+		clear();
+		endNodeDeleter(_left);
+		endNodeDeleter(_right);
+	};
+
+	//MARK: - Assign
+	avl_tree& operator=(const avl_tree& x) {
+		if (this == &x)
+			return *this;
+		clear();
+		_root = cloneTree(realNode(x._root));
+		_size = x._size;
+		resetEnds();
+		return *this;
+	};
+
+	//MARK: - Iterators
+	class iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_node* point;
+		iterator() : point(0) {};
+		iterator(t_node* src) : point(src) {}
+		iterator& operator++() {
+			point = nextNode(point);
+			return *this;
+		}
+		iterator operator++(int) {
+			iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		iterator& operator--() {
+			point = prevNode(point);
+			return *this;
+		}
+		iterator operator--(int) {
+			iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		friend difference_type distance(const iterator& first, const iterator& last) {
+			return static_cast<difference_type>(nodeRank(last.point) - nodeRank(first.point));
+		}
+		bool operator==(const iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const iterator& rhs) const {
+			return point != rhs.point;
+		}
+		value_type& operator*() const {
+			return valueOf(point);
+		}
+		value_type* operator->() const {
+			return &valueOf(point);
+		}
+	};
+	class const_iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_node* point;
+		const_iterator() : point(0) {};
+		const_iterator(t_node* src) : point(src) {}
+		const_iterator(const iterator& src) : point(src.point) {}
+		const_iterator& operator++() {
+			point = nextNode(point);
+			return *this;
+		}
+		const_iterator operator++(int) {
+			const_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		const_iterator& operator--() {
+			point = prevNode(point);
+			return *this;
+		}
+		const_iterator operator--(int) {
+			const_iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		friend difference_type distance(const const_iterator& first, const const_iterator& last) {
+			return static_cast<difference_type>(nodeRank(last.point) - nodeRank(first.point));
+		}
+		bool operator==(const const_iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const const_iterator& rhs) const {
+			return point != rhs.point;
+		}
+		const value_type& operator*() const {
+			return valueOf(point);
+		}
+		const value_type* operator->() const {
+			return &valueOf(point);
+		}
+	};
+	class reverse_iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_node* point;
+		reverse_iterator() : point(0) {};
+		reverse_iterator(t_node* src) : point(src) {}
+		reverse_iterator& operator++() {
+			point = prevNode(point);
+			return *this;
+		}
+		reverse_iterator operator++(int) {
+			reverse_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		reverse_iterator& operator--() {
+			point = nextNode(point);
+			return *this;
+		}
+		reverse_iterator operator--(int) {
+			reverse_iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		friend difference_type distance(const reverse_iterator& first, const reverse_iterator& last) {
+			return reverseRank(first.point) - reverseRank(last.point);
+		}
+		bool operator==(const reverse_iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const reverse_iterator& rhs) const {
+			return point != rhs.point;
+		}
+		value_type& operator*() const {
+			return valueOf(point);
+		}
+		value_type* operator->() const {
+			return &valueOf(point);
+		}
+	};
+	class const_reverse_iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_node* point;
+		const_reverse_iterator() : point(0) {};
+		const_reverse_iterator(t_node* src) : point(src) {}
+		const_reverse_iterator(const reverse_iterator& src) : point(src.point) {}
+		const_reverse_iterator& operator++() {
+			point = prevNode(point);
+			return *this;
+		}
+		const_reverse_iterator operator++(int) {
+			const_reverse_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		const_reverse_iterator& operator--() {
+			point = nextNode(point);
+			return *this;
+		}
+		const_reverse_iterator operator--(int) {
+			const_reverse_iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		friend difference_type distance(const const_reverse_iterator& first, const const_reverse_iterator& last) {
+			return reverseRank(first.point) - reverseRank(last.point);
+		}
+		bool operator==(const const_reverse_iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const const_reverse_iterator& rhs) const {
+			return point != rhs.point;
+		}
+		const value_type& operator*() const {
+			return valueOf(point);
+		}
+		const value_type* operator->() const {
+			return &valueOf(point);
+		}
+	};
+	struct insert_return_type {
+		iterator position;
+		bool inserted;
+		node_type node;
+	};
+	iterator begin() const {
+		if (_size == 0)
+			return end();
+		return iterator(_left->_head);
+	}
+	iterator end() const {
+		return iterator(_right);
+	}
+	reverse_iterator rbegin() const {
+		if (_size == 0)
+			return rend();
+		return reverse_iterator(_right->_head);
+	}
+	reverse_iterator rend() const {
+		return reverse_iterator(_left);
+	}
+
+	//MARK: - Capacity
+	bool empty() const {
+		return (_size == 0);
+	};
+	size_type size() const {
+		return _size;
+	};
+	size_type max_size() const {
+		return std::numeric_limits<size_type>::max() / sizeof(t_node);
+	};
+
+	//MARK: - Modifiers
+	std::pair<iterator,bool> insert_unique (const value_type& val) {
+		std::pair<iterator,bool> res = locate(KeyOfValue()(val));
+		if (res.second)
+			return std::pair<iterator, bool>(res.first, false);
+		return std::pair<iterator, bool>(insert_at(res.first, val), true);
+	};
+	iterator insert_equal (const value_type& val) {
+		return iterator(insertNode(serchLeaf(KeyOfValue()(val), false), nodeCreator(val)));
+	};
+	iterator insert_equal (iterator position, const value_type& val) {
+		return iterator(insertEqual(position.point, nodeCreator(val)));
+	};
+	template <class... Args>
+	std::pair<iterator,bool> emplace_unique (Args&&... args) {
+		t_node* newone = nodeCreator(std::forward<Args>(args)...);
+		std::pair<iterator,bool> res = locate(keyOf(newone));
+		if (res.second) {
+			freeNode(newone);
+			return std::pair<iterator, bool>(res.first, false);
+		}
+		return std::pair<iterator, bool>(iterator(insertNode(res.first.point, newone)), true);
+	};
+	template <class... Args>
+	iterator emplace_equal (Args&&... args) {
+		t_node* newone = nodeCreator(std::forward<Args>(args)...);
+		return iterator(insertNode(serchLeaf(keyOf(newone), false), newone));
+	};
+	template <class... Args>
+	iterator emplace_equal_hint (iterator position, Args&&... args) {
+		return iterator(insertEqual(position.point, nodeCreator(std::forward<Args>(args)...)));
+	};
+	node_type extract (iterator position) {
+		cutEnds();
+		t_node* res = unlinkNode(position.point);
+		resetEnds();
+		return node_type(resetNode(res), _dataAlloc, _nodeAlloc);
+	};
+	node_type extract (const key_type& k) {
+		iterator goal = find(k);
+		if (goal == end())
+			return node_type();
+		return extract(goal);
+	};
+	insert_return_type insert_unique (node_type&& nh) {
+		insert_return_type res;
+		res.inserted = false;
+		if (nh.empty()) {
+			res.position = end();
+			return res;
+		}
+		std::pair<iterator,bool> place = locate(keyOf(nh._node));
+		if (place.second) {
+			res.position = place.first;
+			res.node = std::move(nh);
+			return res;
+		}
+		res.position = iterator(insertNode(place.first.point, nh._node));
+		res.inserted = true;
+		nh._node = 0;
+		return res;
+	};
+	iterator insert_equal (iterator position, node_type&& nh) {
+		if (nh.empty())
+			return end();
+		t_node* newone = nh._node;
+		nh._node = 0;
+		return iterator(insertEqual(position.point, newone));
+	};
+	void erase (iterator position) {
+		cutEnds();
+		freeNode(unlinkNode(position.point));
+		resetEnds();
+	};
+	size_type erase_unique (const key_type& k) {
+		iterator goal = find(k);
+		if (goal == end())
+			return 0;
+		erase(goal);
+		return 1;
+	};
+	size_type erase_equal (const key_type& k) {
+		iterator first = lower_bound(k);
+		size_type res = 0;
+		while (first != end() && !_comp(k, keyOf(first.point))) {
+			erase(first++);
+			res++;
+		}
+		return res;
+	};
+	void erase (iterator first, iterator last) {
+		if (first == last)
+			return;
+		size_t from = nodeRank(first.point);
+		size_t to = nodeRank(last.point);
+		t_node* left;
+		t_node* middle;
+		t_node* right;
+		cutEnds();
+		splitTree(_root, from, left, middle);
+		splitTree(middle, to - from, middle, right);
+		_size -= freeTree(middle);
+		_root = joinTrees(left, right);
+		resetEnds();
+	};
+	void swap (avl_tree& x) {
+		std::swap(_comp, x._comp);
+		std::swap(_left, x._left);
+		std::swap(_right, x._right);
+		std::swap(_root, x._root);
+		std::swap(_size, x._size);
+	};
+	void clear() {
+		if (_root == 0)
+			return;
+		cutEnds();
+		freeTree(_root);
+		_root = 0;
+		_size = 0;
+		resetEnds();
+	};
+
+	//MARK: - Set operations
+	void merge_unique (avl_tree& src) {
+		if (this == &src || src._root == 0)
+			return;
+		t_node* dups;
+		cutEnds();
+		src.cutEnds();
+		try {
+			_root = uniteTrees(_root, src._root, parallelDepth(), dups);
+		}
+		catch (...) {
+			_size = nodeSize(_root);
+			resetEnds();
+			src._size = nodeSize(src._root);
+			src.resetEnds();
+			throw;
+		}
+		_size = nodeSize(_root);
+		resetEnds();
+		src._root = dups;
+		src._size = nodeSize(dups);
+		src.resetEnds();
+	};
+	void merge_equal (avl_tree& src) {
+		if (this == &src)
+			return;
+		if (src._root == 0)
+			return;
+		src.cutEnds();
+		t_node* next = treeToVine(src._root);
+		src._root = 0;
+		src._size = 0;
+		src.resetEnds();
+		try {
+			while (next != 0) {
+				t_node* place = serchLeaf(keyOf(next), false);
+				bool toLeft = place != 0 && _comp(keyOf(next), keyOf(place));
+				t_node* newone = next;
+				next = next->_right;
+				insertNode(place, resetNode(newone), toLeft);
+			}
+		}
+		catch (...) {
+			while (next != 0) {
+				t_node* newone = next;
+				next = next->_right;
+				src._root = joinTrees(src._root, resetNode(newone), 0);
+			}
+			src._size = nodeSize(src._root);
+			src.resetEnds();
+			throw;
+		}
+	};
+	void unite (const avl_tree& x) {
+		if (this == &x || x._root == 0)
+			return;
+		cutEnds();
+		try {
+			_root = uniteTrees(_root, x._root, parallelDepth());
+		}
+		catch (...) {
+			_size = nodeSize(_root);
+			resetEnds();
+			throw;
+		}
+		_size = nodeSize(_root);
+		resetEnds();
+	};
+	void intersect (const avl_tree& x) {
+		if (this == &x || _root == 0)
+			return;
+		cutEnds();
+		try {
+			_root = intersectTrees(_root, realNode(x._root), parallelDepth());
+		}
+		catch (...) {
+			_size = nodeSize(_root);
+			resetEnds();
+			throw;
+		}
+		_size = nodeSize(_root);
+		resetEnds();
+	};
+	void subtract (const avl_tree& x) {
+		if (this == &x)
+			return clear();
+		if (_root == 0)
+			return;
+		cutEnds();
+		try {
+			_root = subtractTrees(_root, realNode(x._root), parallelDepth());
+		}
+		catch (...) {
+			_size = nodeSize(_root);
+			resetEnds();
+			throw;
+		}
+		_size = nodeSize(_root);
+		resetEnds();
+	};
+
+	//MARK: - Observers
+	key_compare key_comp() const {return _comp;};
+	allocator_type get_allocator() const {return _dataAlloc;};
+
+	//MARK: - Operations
+	template <class K>
+	iterator find (const K& k) const {
+		std::pair<iterator,bool> res = locate(k);
+		if (res.second)
+			return res.first;
+		return end();
+	};
+	template <class K>
+	size_type count (const K& k) const {
+		return upperRank(k) - rank(k);
+	};
+	template <class K>
+	iterator lower_bound (const K& k) const {
+		return nth(rank(k));
+	};
+	template <class K>
+	iterator upper_bound (const K& k) const {
+		return nth(upperRank(k));
+	};
+
+	template <class K>
+	std::pair<iterator,bool> locate (const K& k) const {
+		t_node* place = 0;
+		t_node* bound = 0;
+		t_node* tmp = _root;
+		while (realNode(tmp)) {
+			place = tmp;
+			if (_comp(keyOf(tmp), k))
+				tmp = tmp->_right;
+			else {
+				bound = tmp;
+				tmp = tmp->_left;
+			}
+		}
+		if (bound != 0 && !_comp(k, keyOf(bound)))
+			return std::pair<iterator,bool>(iterator(bound), true);
+		return std::pair<iterator,bool>(iterator(place), false);
+	};
+	template <class... Args>
+	iterator insert_at (iterator place, Args&&... args) {
+		return iterator(insertNode(place.point, nodeCreator(std::forward<Args>(args)...)));
+	};
+
+	//MARK: - Order statistics
+	iterator nth (size_type k) const {
+		t_node* tmp = nthNode(k);
+		if (tmp == 0)
+			return end();
+		return iterator(tmp);
+	};
+	template <class K>
+	size_type rank (const K& k) const {
+		size_type res = 0;
+		t_node* tmp = _root;
+		while (realNode(tmp)) {
+			if (_comp(keyOf(tmp), k)) {
+				res += nodeSize(tmp->_left) + 1;
+				tmp = tmp->_right;
+			}
+			else
+				tmp = tmp->_left;
+		}
+		return res;
+	};
+	template <class K>
+	size_type upperRank (const K& k) const {
+		size_type res = 0;
+		t_node* tmp = _root;
+		while (realNode(tmp)) {
+			if (!_comp(k, keyOf(tmp))) {
+				res += nodeSize(tmp->_left) + 1;
+				tmp = tmp->_right;
+			}
+			else
+				tmp = tmp->_left;
+		}
+		return res;
+	};
+	template <class K>
+	size_type count_range (const K& lo, const K& hi) const {
+		if (!_comp(lo, hi))
+			return 0;
+		return rank(hi) - rank(lo);
+	};
+
+	//MARK: - Utilitys
+private:
+	static t_node* realNode(t_node* node) {
+		if (node == 0 || node->_l == -1)
+			return 0;
+		return node;
+	}
+	t_node* nthNode(size_type k) const {
+		t_node* tmp = _root;
+		if (k >= _size)
+			return 0;
+		while (tmp) {
+			size_t left = nodeSize(tmp->_left);
+			if (k < left)
+				tmp = tmp->_left;
+			else if (k == left)
+				return tmp;
+			else {
+				k -= left + 1;
+				tmp = tmp->_right;
+			}
+		}
+		return 0;
+	}
+	t_node* serchLeaf(const key_type& k, bool lower) const {
+		t_node* head = _root;
+		while (head) {
+			t_node* next;
+			if (lower ? !_comp(keyOf(head), k) : _comp(k, keyOf(head)))
+				next = realNode(head->_left);
+			else
+				next = realNode(head->_right);
+			if (next == 0)
+				return head;
+			head = next;
+		}
+		return 0;
+	}
+	void glueEnds() {
+		t_node* tmp = _root;
+		while (tmp->_left)
+			tmp = tmp->_left;
+		tmp->_left = _left;
+		_left->_head = tmp;
+		tmp = _root;
+		while (tmp->_right)
+			tmp = tmp->_right;
+		tmp->_right = _right;
+		_right->_head = tmp;
+	}
+	void cutEnds() {
+		if (_right->_head && (_right->_head)->_right == _right)
+			(_right->_head)->_right = 0;
+		if (_left->_head && (_left->_head)->_left == _left)
+			(_left->_head)->_left = 0;
+	}
+	void resetEnds() {
+		_left->_head = 0;
+		_right->_head = 0;
+		if (_root == 0)
+			return;
+		_root->_head = 0;
+		glueEnds();
+	}
+	void balanceBranch(t_node* root) {
+		if ((root->_l - root->_r < -1) && (root->_right)->_l <= (root->_right)->_r)
+			leftTwist(root);
+		else if ((root->_l - root->_r > 1) && (root->_left)->_r <= (root->_left)->_l)
+			rightTwist(root);
+		else if ((root->_l - root->_r < -1) && (root->_right)->_l > (root->_right)->_r)
+			bigLeftTwist(root);
+		else if ((root->_l - root->_r > 1) && (root->_left)->_r > (root->_left)->_l)
+			bigRightTwist(root);
+	}
+	t_node* incBranch(t_node* newone) {
+		t_node* tmp = newone->_head;
+		while (tmp) {
+			changeIndex(tmp);
+			balanceBranch(tmp);
+			tmp = tmp->_head;
+		}
+		return newone;
+	}
+	t_node* insertNode(t_node* placeHold, t_node* newone) {
+		return insertNode(placeHold, newone, placeHold != 0 && _comp(keyOf(newone), keyOf(placeHold)));
+	}
+	t_node* insertEqual(t_node* pos, t_node* newone) {
+		const key_type& k = keyOf(newone);
+		if (pos != _right && _comp(keyOf(pos), k)) {
+			t_node* next = nextNode(pos);
+			if (next != _right && _comp(keyOf(next), k)) {
+				t_node* place = serchLeaf(k, true);
+				return insertNode(place, newone, !_comp(keyOf(place), k));
+			}
+			return insertBefore(next, newone);
+		}
+		if (_size != 0 && pos != _left->_head && _comp(k, keyOf(prevNode(pos))))
+			return insertNode(serchLeaf(k, false), newone);
+		return insertBefore(pos, newone);
+	}
+	t_node* insertBefore(t_node* pos, t_node* newone) {
+		if (_size == 0)
+			return insertNode(0, newone, false);
+		if (pos == _right)
+			return insertNode(_right->_head, newone, false);
+		if (realNode(pos->_left) == 0)
+			return insertNode(pos, newone, true);
+		return insertNode(prevNode(pos), newone, false);
+	}
+	t_node* insertNode(t_node* placeHold, t_node* newone, bool toLeft) {
+		if (placeHold == 0) {
+			_root = newone;
+			newone->_left = _left;
+			_left->_head = newone;
+			newone->_right = _right;
+			_right->_head = newone;
+		}
+		else if (toLeft) {
+			if (placeHold->_left == _left) {
+				newone->_left = _left;
+				_left->_head = newone;
+			}
+			placeHold->_left = newone;
+		}
+		else {
+			if (placeHold->_right == _right) {
+				newone->_right = _right;
+				_right->_head = newone;
+			}
+			placeHold->_right = newone;
+		}
+		newone->_head = placeHold;
+		_size++;
+		return incBranch(newone);
+	}
+	t_node* unlinkNode(t_node* toPull) {
+		t_node* tmp = toPull->_head;
+		if (toPull->_left == 0 || toPull->_right == 0) {
+			t_node* child = toPull->_left ? toPull->_left : toPull->_right;
+			makeHeadLink(toPull, child);
+			if (child)
+				child->_head = tmp;
+			if (toPull == _root)
+				_root = child;
+		}
+		else {
+			t_node* next = poolMin(toPull->_right);
+			tmp = next->_head == toPull ? next : next->_head;
+			if (next != toPull->_right) {
+				next->_right = toPull->_right;
+				(next->_right)->_head = next;
+			}
+			next->_left = toPull->_left;
+			(next->_left)->_head = next;
+			next->_head = toPull->_head;
+			makeHeadLink(toPull, next);
+			if (toPull == _root)
+				_root = next;
+		}
+		while (tmp) {
+			changeIndex(tmp);
+			balanceBranch(tmp);
+			tmp = tmp->_head;
+		}
+		_size--;
+		return toPull;
+	}
+	t_node* poolMin(t_node* goal) {
+		while (goal->_left)
+			goal = goal->_left;
+		if (goal == (goal->_head)->_left) {
+			(goal->_head)->_left = goal->_right;
+			if (goal->_right)
+				(goal->_right)->_head = goal->_head;
+		}
+		return goal;
+	}
+	t_node* endNodeCreator() {
+		t_node* end = _nodeAlloc.allocate(1);
+		end->_head = 0;
+		end->_left = 0;
+		end->_right = 0;
+		end->_l = -1;
+		end->_r = -1;
+		end->_s = 0;
+		return (end);
+	}
+	void endNodeDeleter(t_node* end) {
+		_nodeAlloc.deallocate(end, 1);
+	}
+	template <class... Args>
+	t_node* nodeCreator(Args&&... args) {
+		t_node* newone = _nodeAlloc.allocate(1);
+		try {
+			_dataAlloc.construct(&valueOf(newone), std::forward<Args>(args)...);
+		}
+		catch (...) {
+			_nodeAlloc.deallocate(newone, 1);
+			throw;
+		}
+		return resetNode(newone);
+	}
+	t_node* resetNode(t_node* newone) {
+		newone->_head = 0;
+		newone->_left = 0;
+		newone->_right = 0;
+		newone->_l = 0;
+		newone->_r = 0;
+		newone->_s = 1;
+		return (newone);
+	}
+	void freeNode(t_node* toDelete) {
+		_dataAlloc.destroy(&valueOf(toDelete));
+		_nodeAlloc.deallocate(toDelete, 1);
+	}
+	void leftTwist(t_node* root) {
+		t_node* newRoot = root->_right;
+		makeHeadLink(root, newRoot);
+		newRoot->_head = root->_head;
+		root->_right = newRoot->_left;
+		if (root->_right)
+			(root->_right)->_head = root;
+		newRoot->_left = root;
+		root->_head = newRoot;
+		changeIndex(root);
+		changeIndex(newRoot);
+		if (root == _root)
+			_root = newRoot;
+	}
+	void rightTwist(t_node* root) {
+		t_node* newRoot = root->_left;
+		makeHeadLink(root, newRoot);
+		newRoot->_head = root->_head;
+		root->_left = newRoot->_right;
+		if (root->_left)
+			(root->_left)->_head = root;
+		newRoot->_right = root;
+		root->_head = newRoot;
+		changeIndex(root);
+		changeIndex(newRoot);
+		if (root == _root)
+			_root = newRoot;
+	}
+	void bigLeftTwist(t_node* root) {
+		t_node* newRoot = (root->_right)->_left;
+		t_node* tmp = root->_right;
+		newRoot->_head = root->_head;
+		makeHeadLink(root, newRoot);
+		root->_right = newRoot->_left;
+		if (root->_right)
+			(root->_right)->_head = root;
+		tmp->_left = newRoot->_right;
+		if (tmp->_left)
+			(tmp->_left)->_head = tmp;
+		newRoot->_left = root;
+		root->_head = newRoot;
+		newRoot->_right = tmp;
+		tmp->_head = newRoot;
+		changeIndex(root);
+		changeIndex(tmp);
+		changeIndex(newRoot);
+		if (root == _root)
+			_root = newRoot;
+	}
+	void bigRightTwist(t_node* root) {
+		t_node* newRoot = (root->_left)->_right;
+		t_node* tmp = root->_left;
+		newRoot->_head = root->_head;
+		makeHeadLink(root, newRoot);
+		root->_left = newRoot->_right;
+		if (root->_left)
+			(root->_left)->_head = root;
+		tmp->_right = newRoot->_left;
+		if (tmp->_right)
+			(tmp->_right)->_head = tmp;
+		newRoot->_right = root;
+		tmp->_head = newRoot;
+		newRoot->_left = tmp;
+		root->_head = newRoot;
+		changeIndex(root);
+		changeIndex(tmp);
+		changeIndex(newRoot);
+		if (root == _root)
+			_root = newRoot;
+	}
+	void changeIndex(t_node* goal) {
+		if (goal->_right) {
+			if (goal->_right->_l > goal->_right->_r)
+				goal->_r = goal->_right->_l + 1;
+			else
+				goal->_r = goal->_right->_r + 1;
+		}
+		else
+			goal->_r = 0;
+		if (goal->_left) {
+			if (goal->_left->_l > goal->_left->_r)
+				goal->_l = goal->_left->_l + 1;
+			else
+				goal->_l = goal->_left->_r + 1;
+		}
+		else
+			goal->_l = 0;
+		changeSize(goal);
+	}
+	void changeSize(t_node* goal) {
+		goal->_s = nodeSize(goal->_left) + nodeSize(goal->_right) + 1;
+	}
+	void makeHeadLink(t_node* goal, t_node* newone) {
+		if (goal->_head) {
+			if (goal == (goal->_head)->_right)
+				(goal->_head)->_right = newone;
+			else
+				(goal->_head)->_left = newone;
+		}
+	}
+	static int nodeHeight(t_node* node) {
+		if (node == 0)
+			return 0;
+		if (node->_l > node->_r)
+			return node->_l + 1;
+		return node->_r + 1;
+	}
+	t_node* linkNode(t_node* left, t_node* mid, t_node* right) {
+		mid->_head = 0;
+		mid->_left = left;
+		mid->_right = right;
+		if (left)
+			left->_head = mid;
+		if (right)
+			right->_head = mid;
+		changeIndex(mid);
+		return mid;
+	}
+	t_node* subtreeLeftTwist(t_node* root) {
+		t_node* newRoot = root->_right;
+		linkNode(root->_left, root, newRoot->_left);
+		return linkNode(root, newRoot, newRoot->_right);
+	}
+	t_node* subtreeRightTwist(t_node* root) {
+		t_node* newRoot = root->_left;
+		linkNode(newRoot->_right, root, root->_right);
+		return linkNode(newRoot->_left, newRoot, root);
+	}
+	t_node* joinRight(t_node* left, t_node* mid, t_node* right) {
+		t_node* l = left->_left;
+		t_node* c = left->_right;
+		if (nodeHeight(c) <= nodeHeight(right) + 1) {
+			t_node* tmp = linkNode(c, mid, right);
+			if (nodeHeight(tmp) <= nodeHeight(l) + 1)
+				return linkNode(l, left, tmp);
+			return subtreeLeftTwist(linkNode(l, left, subtreeRightTwist(tmp)));
+		}
+		t_node* tmp = joinRight(c, mid, right);
+		linkNode(l, left, tmp);
+		if (nodeHeight(tmp) <= nodeHeight(l) + 1)
+			return left;
+		return subtreeLeftTwist(left);
+	}
+	t_node* joinLeft(t_node* left, t_node* mid, t_node* right) {
+		t_node* c = right->_left;
+		t_node* r = right->_right;
+		if (nodeHeight(c) <= nodeHeight(left) + 1) {
+			t_node* tmp = linkNode(left, mid, c);
+			if (nodeHeight(tmp) <= nodeHeight(r) + 1)
+				return linkNode(tmp, right, r);
+			return subtreeRightTwist(linkNode(subtreeLeftTwist(tmp), right, r));
+		}
+		t_node* tmp = joinLeft(left, mid, c);
+		linkNode(tmp, right, r);
+		if (nodeHeight(tmp) <= nodeHeight(r) + 1)
+			return right;
+		return subtreeRightTwist(right);
+	}
+	t_node* joinTrees(t_node* left, t_node* mid, t_node* right) {
+		if (nodeHeight(left) > nodeHeight(right) + 1)
+			return joinRight(left, mid, right);
+		if (nodeHeight(right) > nodeHeight(left) + 1)
+			return joinLeft(left, mid, right);
+		return linkNode(left, mid, right);
+	}
+	t_node* joinTrees(t_node* left, t_node* right) {
+		if (left == 0)
+			return right;
+		if (right == 0)
+			return left;
+		t_node* mid;
+		splitTree(left, nodeSize(left) - 1, left, mid);
+		return joinTrees(left, mid, right);
+	}
+	void splitTree(t_node* root, size_t k, t_node*& left, t_node*& right) {
+		if (root == 0) {
+			left = 0;
+			right = 0;
+			return;
+		}
+		t_node* l = root->_left;
+		t_node* r = root->_right;
+		t_node* tmp;
+		if (l)
+			l->_head = 0;
+		if (r)
+			r->_head = 0;
+		if (k <= nodeSize(l)) {
+			splitTree(l, k, left, tmp);
+			right = joinTrees(tmp, root, r);
+		}
+		else {
+			splitTree(r, k - nodeSize(l) - 1, tmp, right);
+			left = joinTrees(l, root, tmp);
+		}
+	}
+	//If the comparator throws, root is rejoined from its pieces before rethrowing.
+	void splitByKey(t_node*& root, const key_type& k, t_node*& left, t_node*& found, t_node*& right) {
+		if (root == 0) {
+			left = 0;
+			found = 0;
+			right = 0;
+			return;
+		}
+		t_node* mid = root;
+		t_node* l = mid->_left;
+		t_node* r = mid->_right;
+		t_node* tmp;
+		if (l)
+			l->_head = 0;
+		if (r)
+			r->_head = 0;
+		try {
+			if (_comp(k, keyOf(mid))) {
+				splitByKey(l, k, left, found, tmp);
+				right = joinTrees(tmp, mid, r);
+			}
+			else if (_comp(keyOf(mid), k)) {
+				splitByKey(r, k, tmp, found, right);
+				left = joinTrees(l, mid, tmp);
+			}
+			else {
+				left = l;
+				right = r;
+				found = linkNode(0, mid, 0);
+			}
+		}
+		catch (...) {
+			root = joinTrees(l, mid, r);
+			throw;
+		}
+	}
+	//Both halves go through the one _nodeAlloc, _dataAlloc and _comp, so the
+	//recursion only forks when none of them can carry state.
+	static int parallelDepth() {
+		if (!std::is_same<Alloc, std::allocator<Value> >::value || !std::is_empty<Compare>::value)
+			return 0;
+		unsigned threads = std::thread::hardware_concurrency();
+		int depth = 0;
+		while ((1u << depth) < threads)
+			depth++;
+		return depth;
+	}
+	template <class Left, class Right>
+	static void forkJoin(Left left, Right right) {
+		std::exception_ptr error;
+		std::thread worker([&]() {
+			try {
+				left();
+			}
+			catch (...) {
+				error = std::current_exception();
+			}
+		});
+		try {
+			right();
+		}
+		catch (...) {
+			worker.join();
+			throw;
+		}
+		worker.join();
+		if (error)
+			std::rethrow_exception(error);
+	}
+	static bool goParallel(int depth, t_node* a, t_node* b) {
+		return depth > 0 && nodeSize(a) + nodeSize(b) > PARALLEL_GRAIN;
+	}
+	//The set operations below leave a (and b when it is consumed) holding every
+	//node they still own if anything throws, so the caller can rebuild its tree.
+	t_node* uniteTrees(t_node*& a, t_node*& b, int depth, t_node*& dups) {
+		if (b == 0 || a == 0) {
+			dups = 0;
+			return a ? a : b;
+		}
+		t_node* mid = b;
+		t_node* bl = mid->_left;
+		t_node* br = mid->_right;
+		t_node* al;
+		t_node* ar;
+		t_node* found;
+		if (bl)
+			bl->_head = 0;
+		if (br)
+			br->_head = 0;
+		try {
+			splitByKey(a, keyOf(mid), al, found, ar);
+		}
+		catch (...) {
+			b = joinTrees(bl, mid, br);
+			throw;
+		}
+		t_node* l = al;
+		t_node* r = ar;
+		t_node* dupsL = bl;
+		t_node* dupsR = br;
+		bool leftDone = false;
+		bool rightDone = false;
+		try {
+			if (goParallel(depth, al, bl))
+				forkJoin([&]() { l = uniteTrees(al, bl, depth - 1, dupsL); leftDone = true; },
+					[&]() { r = uniteTrees(ar, br, depth - 1, dupsR); rightDone = true; });
+			else {
+				l = uniteTrees(al, bl, depth, dupsL);
+				leftDone = true;
+				r = uniteTrees(ar, br, depth, dupsR);
+				rightDone = true;
+			}
+		}
+		catch (...) {
+			if (!leftDone) {
+				l = al;
+				dupsL = bl;
+			}
+			if (!rightDone) {
+				r = ar;
+				dupsR = br;
+			}
+			a = restoreTree(l, found, r);
+			b = joinTrees(dupsL, mid, dupsR);
+			throw;
+		}
+		if (found) {
+			dups = joinTrees(dupsL, linkNode(0, mid, 0), dupsR);
+			return joinTrees(l, found, r);
+		}
+		dups = joinTrees(dupsL, dupsR);
+		return joinTrees(l, mid, r);
+	}
+	t_node* uniteTrees(t_node*& a, t_node* b, int depth) {
+		b = realNode(b);
+		if (b == 0)
+			return a;
+		if (a == 0)
+			return cloneTree(b);
+		t_node* al;
+		t_node* ar;
+		t_node* found;
+		splitByKey(a, keyOf(b), al, found, ar);
+		t_node* l = al;
+		t_node* r = ar;
+		bool leftDone = false;
+		bool rightDone = false;
+		try {
+			if (goParallel(depth, al, b))
+				forkJoin([&]() { l = uniteTrees(al, b->_left, depth - 1); leftDone = true; },
+					[&]() { r = uniteTrees(ar, b->_right, depth - 1); rightDone = true; });
+			else {
+				l = uniteTrees(al, b->_left, depth);
+				leftDone = true;
+				r = uniteTrees(ar, b->_right, depth);
+				rightDone = true;
+			}
+			if (found == 0)
+				found = nodeCreator(valueOf(b));
+		}
+		catch (...) {
+			a = restoreTree(leftDone ? l : al, found, rightDone ? r : ar);
+			throw;
+		}
+		return joinTrees(l, found, r);
+	}
+	t_node* intersectTrees(t_node*& a, t_node* b, int depth) {
+		if (a == 0)
+			return 0;
+		if (b == 0) {
+			freeTree(a);
+			return 0;
+		}
+		t_node* al;
+		t_node* ar;
+		t_node* found;
+		splitByKey(a, keyOf(b), al, found, ar);
+		t_node* l = al;
+		t_node* r = ar;
+		bool leftDone = false;
+		bool rightDone = false;
+		try {
+			if (goParallel(depth, al, b))
+				forkJoin([&]() { l = intersectTrees(al, realNode(b->_left), depth - 1); leftDone = true; },
+					[&]() { r = intersectTrees(ar, realNode(b->_right), depth - 1); rightDone = true; });
+			else {
+				l = intersectTrees(al, realNode(b->_left), depth);
+				leftDone = true;
+				r = intersectTrees(ar, realNode(b->_right), depth);
+				rightDone = true;
+			}
+		}
+		catch (...) {
+			a = restoreTree(leftDone ? l : al, found, rightDone ? r : ar);
+			throw;
+		}
+		if (found)
+			return joinTrees(l, found, r);
+		return joinTrees(l, r);
+	}
+	t_node* subtractTrees(t_node*& a, t_node* b, int depth) {
+		if (a == 0 || b == 0)
+			return a;
+		t_node* al;
+		t_node* ar;
+		t_node* found;
+		splitByKey(a, keyOf(b), al, found, ar);
+		if (found)
+			freeNode(found);
+		t_node* l = al;
+		t_node* r = ar;
+		bool leftDone = false;
+		bool rightDone = false;
+		try {
+			if (goParallel(depth, al, b))
+				forkJoin([&]() { l = subtractTrees(al, realNode(b->_left), depth - 1); leftDone = true; },
+					[&]() { r = subtractTrees(ar, realNode(b->_right), depth - 1); rightDone = true; });
+			else {
+				l = subtractTrees(al, realNode(b->_left), depth);
+				leftDone = true;
+				r = subtractTrees(ar, realNode(b->_right), depth);
+				rightDone = true;
+			}
+		}
+		catch (...) {
+			a = restoreTree(leftDone ? l : al, 0, rightDone ? r : ar);
+			throw;
+		}
+		return joinTrees(l, r);
+	}
+	t_node* restoreTree(t_node* left, t_node* mid, t_node* right) {
+		if (mid)
+			return joinTrees(left, mid, right);
+		return joinTrees(left, right);
+	}
+	//Flattens root into an in-order chain linked through _right.
+	static t_node* treeToVine(t_node* root) {
+		t_node* res = 0;
+		t_node* tail = 0;
+		while (root != 0) {
+			if (root->_left != 0) {
+				t_node* tmp = root->_left;
+				root->_left = tmp->_right;
+				tmp->_right = root;
+				root = tmp;
+				continue;
+			}
+			if (tail == 0)
+				res = root;
+			else
+				tail->_right = root;
+			tail = root;
+			root = root->_right;
+		}
+		return res;
+	}
+	t_node* cloneTree(t_node* src) {
+		if (src == 0)
+			return 0;
+		t_node* newone = nodeCreator(valueOf(src));
+		t_node* left = 0;
+		try {
+			left = cloneTree(realNode(src->_left));
+			return linkNode(left, newone, cloneTree(realNode(src->_right)));
+		}
+		catch (...) {
+			freeTree(left);
+			freeNode(newone);
+			throw;
+		}
+	}
+	size_t freeTree(t_node* root) {
+		if (root == 0)
+			return 0;
+		size_t res = freeTree(root->_left) + freeTree(root->_right) + 1;
+		freeNode(root);
+		return res;
+	}
+};
+}
+
+#endif
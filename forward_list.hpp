@@ -0,0 +1,477 @@
+#ifndef forward_list_hpp
+#define forward_list_hpp
+
+#include <iostream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace ft {
+template <class T, class Alloc = std::allocator<T> > class forward_list {
+private:
+	typedef struct		s_flink
+	{
+		struct s_flink*	_next;
+	}					t_flink;
+	typedef struct		s_flist : public s_flink
+	{
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type	_data;
+	}					t_flist;
+
+	typedef typename Alloc::template rebind<t_flist>::other Alloc_rebind;
+	Alloc				_dataAlloc;
+	Alloc_rebind		_nodeAlloc;
+
+	t_flink				_head;
+
+public:
+	//MARK: - Member types
+	typedef T value_type;
+	typedef Alloc allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+
+	//MARK: - Constructors
+	explicit forward_list (const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _nodeAlloc(alloc) {
+		_head._next = 0;
+	};
+	explicit forward_list (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _nodeAlloc(alloc) {
+		_head._next = 0;
+		insert_after(before_begin(), n, val);
+	};
+	template <class InputIterator>
+	forward_list (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _dataAlloc(alloc), _nodeAlloc(alloc) {
+		_head._next = 0;
+		insert_after(before_begin(), first, last);
+	};
+	forward_list (const forward_list& src) : _dataAlloc(src._dataAlloc), _nodeAlloc(src._nodeAlloc) {
+		_head._next = 0;
+		insert_after(before_begin(), src.cbegin(), src.cend());
+	};
+
+	//MARK: - Destructor
+	~forward_list() {
+		clear();
+	};
+
+	//MARK: - Assign
+	forward_list& operator=(const forward_list& src) {
+		if (this == &src)
+			return (*this);
+		assign(src.cbegin(), src.cend());
+		return (*this);
+	};
+	template <class InputIterator>
+	void assign (InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
+		clear();
+		insert_after(before_begin(), first, last);
+	};
+	void assign (size_type n, const value_type& val) {
+		clear();
+		insert_after(before_begin(), n, val);
+	};
+
+	//MARK: - Iterators
+	class iterator : public std::iterator<std::forward_iterator_tag, value_type> {
+	public:
+		t_flink* point;
+		iterator() : point(0) {};
+		iterator(t_flink* src) : point(src) {}
+		iterator& operator++() {
+			point = point->_next;
+			return *this;
+		}
+		iterator operator++(int) {
+			iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		bool operator==(const iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const iterator& rhs) const {
+			return point != rhs.point;
+		}
+		value_type& operator*() const {
+			return valueOf(point);
+		}
+		value_type* operator->() const {
+			return &valueOf(point);
+		}
+	};
+	class const_iterator : public std::iterator<std::forward_iterator_tag, value_type> {
+	public:
+		t_flink* point;
+		const_iterator() : point(0) {};
+		const_iterator(t_flink* src) : point(src) {}
+		const_iterator(const iterator& src) : point(src.point) {}
+		const_iterator& operator++() {
+			point = point->_next;
+			return *this;
+		}
+		const_iterator operator++(int) {
+			const_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		bool operator==(const const_iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const const_iterator& rhs) const {
+			return point != rhs.point;
+		}
+		const value_type& operator*() const {
+			return valueOf(point);
+		}
+		const value_type* operator->() const {
+			return &valueOf(point);
+		}
+	};
+	iterator before_begin() {
+		return iterator(&_head);
+	}
+	const_iterator cbefore_begin() const {
+		return const_iterator(const_cast<t_flink*>(&_head));
+	}
+	iterator begin() {
+		return iterator(_head._next);
+	}
+	iterator end() {
+		return iterator(0);
+	}
+	const_iterator cbegin() const {
+		return const_iterator(_head._next);
+	}
+	const_iterator cend() const {
+		return const_iterator(0);
+	}
+
+	//MARK: - Capacity
+	bool empty() const {
+		return _head._next == 0;
+	};
+	size_type max_size() const {
+		return std::numeric_limits<size_type>::max() / sizeof(t_flist);
+	};
+
+	//MARK: - Element access
+	reference front() {
+		return valueOf(_head._next);
+	};
+	const_reference front() const {
+		return valueOf(_head._next);
+	};
+
+	//MARK: - Modifiers
+	void push_front (const value_type& val) {
+		linkAfter(&_head, createNode(val));
+	};
+	template <class... Args>
+	void emplace_front (Args&&... args) {
+		linkAfter(&_head, createNode(std::forward<Args>(args)...));
+	};
+	void pop_front() {
+		if (_head._next != 0)
+			freeNode(unlinkAfter(&_head));
+	};
+	iterator insert_after (iterator position, const value_type& val) {
+		return iterator(linkAfter(position.point, createNode(val)));
+	};
+	iterator insert_after (iterator position, size_type n, const value_type& val) {
+		for (size_type i = 0; i < n; i++)
+			position.point = linkAfter(position.point, createNode(val));
+		return position;
+	};
+	template <class InputIterator>
+	iterator insert_after (iterator position, InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
+		while (first != last) {
+			position.point = linkAfter(position.point, createNode(*first));
+			first++;
+		}
+		return position;
+	};
+	template <class... Args>
+	iterator emplace_after (iterator position, Args&&... args) {
+		return iterator(linkAfter(position.point, createNode(std::forward<Args>(args)...)));
+	};
+	iterator erase_after (iterator position) {
+		freeNode(unlinkAfter(position.point));
+		return iterator(position.point->_next);
+	};
+	iterator erase_after (iterator position, iterator last) {
+		t_flink* tmp = position.point->_next;
+		position.point->_next = last.point;
+		while (tmp != last.point) {
+			t_flink* next = tmp->_next;
+			freeNode(tmp);
+			tmp = next;
+		}
+		return last;
+	};
+	void swap (forward_list& src) {
+		t_flink* tmp = _head._next;
+		_head._next = src._head._next;
+		src._head._next = tmp;
+	};
+	void resize (size_type n, const value_type& val = value_type()) {
+		t_flink* tmp = &_head;
+		while (n != 0 && tmp->_next != 0) {
+			tmp = tmp->_next;
+			n--;
+		}
+		if (n == 0)
+			erase_after(iterator(tmp), end());
+		else
+			insert_after(iterator(tmp), n, val);
+	};
+	void clear() {
+		erase_after(before_begin(), end());
+	};
+
+	//MARK: - Operations
+	void splice_after (iterator position, forward_list& src) {
+		if (this == &src || src._head._next == 0)
+			return;
+		t_flink* tail = &src._head;
+		while (tail->_next != 0)
+			tail = tail->_next;
+		transferAfter(position.point, &src._head, tail);
+	};
+	void splice_after (iterator position, forward_list& src, iterator i) {
+		(void)src;
+		if (position.point == i.point || position.point == i.point->_next)
+			return;
+		transferAfter(position.point, i.point, i.point->_next);
+	};
+	void splice_after (iterator position, forward_list& src, iterator first, iterator last) {
+		(void)src;
+		if (first.point->_next == last.point)
+			return;
+		t_flink* tail = first.point;
+		while (tail->_next != last.point)
+			tail = tail->_next;
+		transferAfter(position.point, first.point, tail);
+	};
+	size_type remove (const value_type& val) {
+		return remove_if(equalTo(val));
+	};
+	template <class Predicate>
+	size_type remove_if (Predicate pred) {
+		t_flink* removed = 0;
+		size_type res = 0;
+		t_flink* tmp = &_head;
+		while (tmp->_next != 0) {
+			if (pred(valueOf(tmp->_next))) {
+				chainAfter(removed, tmp);
+				res++;
+			}
+			else
+				tmp = tmp->_next;
+		}
+		freeChain(removed);
+		return res;
+	};
+	size_type unique() {
+		return unique(std::equal_to<value_type>());
+	};
+	template <class BinaryPredicate>
+	size_type unique (BinaryPredicate binary_pred) {
+		size_type res = 0;
+		t_flink* tmp = _head._next;
+		if (tmp == 0)
+			return 0;
+		while (tmp->_next != 0) {
+			if (binary_pred(valueOf(tmp), valueOf(tmp->_next))) {
+				freeNode(unlinkAfter(tmp));
+				res++;
+			}
+			else
+				tmp = tmp->_next;
+		}
+		return res;
+	};
+	void merge (forward_list& src) {
+		merge(src, std::less<value_type>());
+	};
+	template <class Compare>
+	void merge (forward_list& src, Compare comp) {
+		if (this == &src)
+			return;
+		_head._next = mergeChains(_head._next, src._head._next, comp);
+		src._head._next = 0;
+	};
+	void sort() {
+		sort(std::less<value_type>());
+	};
+	template <class Compare>
+	void sort (Compare comp) {
+		_head._next = sortChain(_head._next, comp);
+	};
+	void reverse() {
+		t_flink* prev = 0;
+		t_flink* tmp = _head._next;
+		while (tmp != 0) {
+			t_flink* next = tmp->_next;
+			tmp->_next = prev;
+			prev = tmp;
+			tmp = next;
+		}
+		_head._next = prev;
+	};
+
+	//MARK: - Allocator
+	allocator_type get_allocator() const {
+		return _dataAlloc;
+	};
+
+	//MARK: - Utilitys
+private:
+	struct equalTo {
+		const value_type& val;
+		equalTo(const value_type& src) : val(src) {}
+		bool operator()(const value_type& elem) const {
+			return elem == val;
+		}
+	};
+	static value_type& valueOf(t_flink* node) {
+		return *reinterpret_cast<value_type*>(&static_cast<t_flist*>(node)->_data);
+	}
+	t_flink* linkAfter(t_flink* position, t_flink* newone) {
+		newone->_next = position->_next;
+		position->_next = newone;
+		return newone;
+	}
+	t_flink* unlinkAfter(t_flink* position) {
+		t_flink* res = position->_next;
+		position->_next = res->_next;
+		res->_next = 0;
+		return res;
+	}
+	void chainAfter(t_flink*& chain, t_flink* position) {
+		t_flink* res = unlinkAfter(position);
+		res->_next = chain;
+		chain = res;
+	}
+	void freeChain(t_flink* chain) {
+		while (chain != 0) {
+			t_flink* next = chain->_next;
+			freeNode(chain);
+			chain = next;
+		}
+	}
+	void transferAfter(t_flink* position, t_flink* before, t_flink* tail) {
+		t_flink* first = before->_next;
+		before->_next = tail->_next;
+		tail->_next = position->_next;
+		position->_next = first;
+	}
+	template <class Compare>
+	static t_flink* mergeChains(t_flink* left, t_flink* right, Compare& comp) {
+		t_flink res;
+		t_flink* tail = &res;
+		while (left != 0 && right != 0) {
+			if (comp(valueOf(right), valueOf(left))) {
+				tail->_next = right;
+				right = right->_next;
+			}
+			else {
+				tail->_next = left;
+				left = left->_next;
+			}
+			tail = tail->_next;
+		}
+		if (left != 0)
+			tail->_next = left;
+		else
+			tail->_next = right;
+		return res._next;
+	}
+	template <class Compare>
+	static t_flink* sortChain(t_flink* first, Compare& comp) {
+		if (first == 0 || first->_next == 0)
+			return first;
+		t_flink* slow = first;
+		t_flink* fast = first->_next;
+		while (fast != 0 && fast->_next != 0) {
+			slow = slow->_next;
+			fast = fast->_next->_next;
+		}
+		t_flink* second = slow->_next;
+		slow->_next = 0;
+		return mergeChains(sortChain(first, comp), sortChain(second, comp), comp);
+	}
+	template <class... Args>
+	t_flist* createNode(Args&&... args) {
+		t_flist* newone = _nodeAlloc.allocate(1);
+		try {
+			_dataAlloc.construct(&valueOf(newone), std::forward<Args>(args)...);
+		}
+		catch (...) {
+			_nodeAlloc.deallocate(newone, 1);
+			throw;
+		}
+		newone->_next = 0;
+		return newone;
+	}
+	void freeNode(t_flink* toDelete) {
+		_dataAlloc.destroy(&valueOf(toDelete));
+		_nodeAlloc.deallocate(static_cast<t_flist*>(toDelete), 1);
+	}
+};
+
+//MARK: - Non-member function overloads
+template <class T, class Alloc>
+bool operator== (const ft::forward_list<T,Alloc>& lhs, const ft::forward_list<T,Alloc>& rhs) {
+	typename ft::forward_list<T,Alloc>::const_iterator lit = lhs.cbegin();
+	typename ft::forward_list<T,Alloc>::const_iterator rit = rhs.cbegin();
+	while (lit != lhs.cend() && rit != rhs.cend()) {
+		if (!(*lit == *rit))
+			return false;
+		lit++;
+		rit++;
+	}
+	return lit == lhs.cend() && rit == rhs.cend();
+};
+template <class T, class Alloc>
+bool operator!= (const ft::forward_list<T,Alloc>& lhs, const ft::forward_list<T,Alloc>& rhs) {
+	return !(lhs == rhs);
+};
+template <class T, class Alloc>
+bool operator<  (const ft::forward_list<T,Alloc>& lhs, const ft::forward_list<T,Alloc>& rhs) {
+	typename ft::forward_list<T,Alloc>::const_iterator lit = lhs.cbegin();
+	typename ft::forward_list<T,Alloc>::const_iterator rit = rhs.cbegin();
+	while (lit != lhs.cend() && rit != rhs.cend()) {
+		if (*lit < *rit)
+			return true;
+		if (*rit < *lit)
+			return false;
+		lit++;
+		rit++;
+	}
+	return lit == lhs.cend() && rit != rhs.cend();
+};
+template <class T, class Alloc>
+bool operator<= (const ft::forward_list<T,Alloc>& lhs, const ft::forward_list<T,Alloc>& rhs) {
+	return !(rhs < lhs);
+};
+template <class T, class Alloc>
+bool operator>  (const ft::forward_list<T,Alloc>& lhs, const ft::forward_list<T,Alloc>& rhs) {
+	return rhs < lhs;
+};
+template <class T, class Alloc>
+bool operator>= (const ft::forward_list<T,Alloc>& lhs, const ft::forward_list<T,Alloc>& rhs) {
+	return !(lhs < rhs);
+};
+template <class T, class Alloc>
+void swap (ft::forward_list<T,Alloc>& x, ft::forward_list<T,Alloc>& y) {
+	x.swap(y);
+};
+}
+
+#endif
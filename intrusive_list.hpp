@@ -0,0 +1,382 @@
+#ifndef intrusive_list_hpp
+#define intrusive_list_hpp
+
+#include <iostream>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace ft {
+struct list_hook {
+	list_hook*	_next;
+	list_hook*	_prev;
+	list_hook() : _next(0), _prev(0) {}
+	list_hook(const list_hook&) : _next(0), _prev(0) {}
+	list_hook& operator=(const list_hook&) {
+		return *this;
+	}
+	bool is_linked() const {
+		return _next != 0;
+	}
+};
+
+template <class T, list_hook T::*Hook> class intrusive_list {
+private:
+	typedef list_hook	t_hook;
+
+	t_hook				_end;
+	size_t				_size;
+
+public:
+	//MARK: - Member types
+	typedef T value_type;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+
+	//MARK: - Constructors
+	intrusive_list() {
+		_end._next = &_end;
+		_end._prev = &_end;
+		_size = 0;
+	};
+
+	//MARK: - Destructor
+	~intrusive_list() {
+		clear();
+	};
+
+	//MARK: - Iterators
+	class iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_hook* point;
+		iterator() : point(0) {};
+		iterator(t_hook* src) : point(src) {}
+		iterator& operator++() {
+			point = point->_next;
+			return *this;
+		}
+		iterator operator++(int) {
+			iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		iterator& operator--() {
+			point = point->_prev;
+			return *this;
+		}
+		iterator operator--(int) {
+			iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		bool operator==(const iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const iterator& rhs) const {
+			return point != rhs.point;
+		}
+		value_type& operator*() const {
+			return *owner(point);
+		}
+		value_type* operator->() const {
+			return owner(point);
+		}
+	};
+	class reverse_iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_hook* point;
+		reverse_iterator() : point(0) {};
+		reverse_iterator(t_hook* src) : point(src) {}
+		reverse_iterator& operator++() {
+			point = point->_prev;
+			return *this;
+		}
+		reverse_iterator operator++(int) {
+			reverse_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		reverse_iterator& operator--() {
+			point = point->_next;
+			return *this;
+		}
+		reverse_iterator operator--(int) {
+			reverse_iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		bool operator==(const reverse_iterator& rhs) const {
+			return point == rhs.point;
+		}
+		bool operator!=(const reverse_iterator& rhs) const {
+			return point != rhs.point;
+		}
+		value_type& operator*() const {
+			return *owner(point);
+		}
+		value_type* operator->() const {
+			return owner(point);
+		}
+	};
+	iterator begin() {
+		return iterator(_end._next);
+	}
+	iterator end() {
+		return iterator(&_end);
+	}
+	reverse_iterator rbegin() {
+		return reverse_iterator(_end._prev);
+	}
+	reverse_iterator rend() {
+		return reverse_iterator(&_end);
+	}
+	static iterator iterator_to(value_type& val) {
+		return iterator(&(val.*Hook));
+	}
+
+	//MARK: - Capacity
+	bool empty() const {
+		return _size == 0;
+	};
+	size_type size() const {
+		return _size;
+	};
+
+	//MARK: - Element access
+	reference front() {
+		return *owner(_end._next);
+	};
+	reference back() {
+		return *owner(_end._prev);
+	};
+
+	//MARK: - Modifiers
+	void push_back (value_type& val) {
+		linkBefore(&_end, &(val.*Hook));
+	};
+	void push_front (value_type& val) {
+		linkBefore(_end._next, &(val.*Hook));
+	};
+	void pop_front() {
+		if (_size > 0)
+			unlink(_end._next);
+	};
+	void pop_back() {
+		if (_size > 0)
+			unlink(_end._prev);
+	};
+	iterator insert (iterator position, value_type& val) {
+		linkBefore(position.point, &(val.*Hook));
+		return iterator(&(val.*Hook));
+	};
+	iterator erase (iterator position) {
+		t_hook* next = position.point->_next;
+		unlink(position.point);
+		return iterator(next);
+	};
+	iterator erase (iterator first, iterator last) {
+		while (first != last)
+			first = erase(first);
+		return last;
+	};
+	void erase (value_type& val) {
+		unlink(&(val.*Hook));
+	};
+	void swap (intrusive_list& src) {
+		intrusive_list tmp;
+		tmp.splice(tmp.end(), src);
+		src.splice(src.end(), *this);
+		splice(end(), tmp);
+	};
+	void clear() {
+		t_hook* tmp = _end._next;
+		while (tmp != &_end) {
+			t_hook* next = tmp->_next;
+			tmp->_next = 0;
+			tmp->_prev = 0;
+			tmp = next;
+		}
+		_end._next = &_end;
+		_end._prev = &_end;
+		_size = 0;
+	};
+
+	//MARK: - Operations
+	void splice (iterator position, intrusive_list& src) {
+		if (this == &src || src._size == 0)
+			return;
+		transferRange(position.point, src._end._next, &src._end);
+		_size += src._size;
+		src._size = 0;
+	};
+	void splice (iterator position, intrusive_list& src, iterator i) {
+		if (position.point == i.point || position.point == i.point->_next)
+			return;
+		transferRange(position.point, i.point, i.point->_next);
+		src._size--;
+		_size++;
+	};
+	void splice (iterator position, intrusive_list& src, iterator first, iterator last) {
+		if (this == &src) {
+			transferRange(position.point, first.point, last.point);
+			return;
+		}
+		size_type n = 0;
+		for (t_hook* tmp = first.point; tmp != last.point; tmp = tmp->_next)
+			n++;
+		splice(position, src, first, last, n);
+	};
+	void splice (iterator position, intrusive_list& src, iterator first, iterator last, size_type n) {
+		if (first == last)
+			return;
+		transferRange(position.point, first.point, last.point);
+		if (this == &src)
+			return;
+		_size += n;
+		src._size -= n;
+	};
+	size_type remove (const value_type& val) {
+		return remove_if(equalTo(val));
+	};
+	template <class Predicate>
+	size_type remove_if (Predicate pred) {
+		size_type res = 0;
+		t_hook* tmp = _end._next;
+		while (tmp != &_end) {
+			t_hook* next = tmp->_next;
+			if (pred(*owner(tmp))) {
+				unlink(tmp);
+				res++;
+			}
+			tmp = next;
+		}
+		return res;
+	};
+	size_type unique() {
+		return unique(std::equal_to<value_type>());
+	};
+	template <class BinaryPredicate>
+	size_type unique (BinaryPredicate binary_pred) {
+		size_type res = 0;
+		if (_size == 0)
+			return 0;
+		t_hook* tmp = _end._next->_next;
+		while (tmp != &_end) {
+			t_hook* next = tmp->_next;
+			if (binary_pred(*owner(tmp->_prev), *owner(tmp))) {
+				unlink(tmp);
+				res++;
+			}
+			tmp = next;
+		}
+		return res;
+	};
+	void merge (intrusive_list& src) {
+		merge(src, std::less<value_type>());
+	};
+	template <class Compare>
+	void merge (intrusive_list& src, Compare comp) {
+		if (this == &src)
+			return;
+		t_hook* it = _end._next;
+		while (it != &_end && src._size != 0) {
+			t_hook* first = src._end._next;
+			if (comp(*owner(first), *owner(it))) {
+				t_hook* last = first->_next;
+				size_type n = 1;
+				while (last != &src._end && comp(*owner(last), *owner(it))) {
+					last = last->_next;
+					n++;
+				}
+				splice(iterator(it), src, iterator(first), iterator(last), n);
+			}
+			else
+				it = it->_next;
+		}
+		splice(end(), src);
+	};
+	void sort() {
+		sort(std::less<value_type>());
+	};
+	template <class Compare>
+	void sort (Compare comp) {
+		if (_size < 2)
+			return;
+		intrusive_list half;
+		t_hook* middle = _end._next;
+		for (size_type i = 0; i < _size / 2; i++)
+			middle = middle->_next;
+		half.splice(half.end(), *this, iterator(middle), end(), _size - _size / 2);
+		sort(comp);
+		half.sort(comp);
+		merge(half, comp);
+	};
+	void reverse() {
+		t_hook* tmp = &_end;
+		do {
+			t_hook* next = tmp->_next;
+			tmp->_next = tmp->_prev;
+			tmp->_prev = next;
+			tmp = next;
+		} while (tmp != &_end);
+	};
+
+	//MARK: - Utilitys
+private:
+	intrusive_list(const intrusive_list&);
+	intrusive_list& operator=(const intrusive_list&);
+	struct equalTo {
+		const value_type& val;
+		equalTo(const value_type& src) : val(src) {}
+		bool operator()(const value_type& elem) const {
+			return elem == val;
+		}
+	};
+	static size_t hookOffset() {
+		static typename std::aligned_storage<sizeof(T), alignof(T)>::type probe;
+		T* base = reinterpret_cast<T*>(&probe);
+		return reinterpret_cast<char*>(&(base->*Hook)) - reinterpret_cast<char*>(base);
+	}
+	static T* owner(t_hook* hook) {
+		return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hookOffset());
+	}
+	void linkBefore(t_hook* position, t_hook* newone) {
+		newone->_prev = position->_prev;
+		newone->_next = position;
+		(position->_prev)->_next = newone;
+		position->_prev = newone;
+		_size++;
+	}
+	void unlink(t_hook* toPull) {
+		(toPull->_prev)->_next = toPull->_next;
+		(toPull->_next)->_prev = toPull->_prev;
+		toPull->_next = 0;
+		toPull->_prev = 0;
+		_size--;
+	}
+	void transferRange(t_hook* position, t_hook* first, t_hook* last) {
+		if (first == last || position == last)
+			return;
+		t_hook* before = first->_prev;
+		t_hook* tail = last->_prev;
+		before->_next = last;
+		last->_prev = before;
+		(position->_prev)->_next = first;
+		first->_prev = position->_prev;
+		tail->_next = position;
+		position->_prev = tail;
+	}
+};
+
+//MARK: - Non-member function overloads
+template <class T, list_hook T::*Hook>
+void swap (ft::intrusive_list<T,Hook>& x, ft::intrusive_list<T,Hook>& y) {
+	x.swap(y);
+};
+}
+
+#endif
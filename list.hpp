@@ -6,7 +6,15 @@
 #include <memory>
 
 namespace ft {
-template <class T, class Alloc = std::allocator<T> > class list {
+struct no_node_cache {
+	static const size_t high_water = 0;
+};
+template <size_t HighWater>
+struct node_cache {
+	static const size_t high_water = HighWater;
+};
+
+template <class T, class Alloc = std::allocator<T>, class CachePolicy = no_node_cache> class list {
 private:
 	typedef struct		s_list
 	{
@@ -21,6 +29,8 @@ private:
 	
 	t_list*				_end;
 	size_t				_size;
+	t_list*				_cache;
+	size_t				_cached;
 	
 public:
 	//MARK: - Member types
@@ -32,13 +42,65 @@ public:
 	typedef typename allocator_type::const_pointer const_pointer;
 	typedef ptrdiff_t difference_type;
 	typedef size_t size_type;
+	typedef CachePolicy cache_policy;
+	
+	//MARK: - Node handle
+	class node_type {
+	public:
+		node_type() : _node(0) {};
+		node_type(node_type&& src) : _node(src._node), _dataAlloc(src._dataAlloc), _rebindAlloc(src._rebindAlloc) {
+			src._node = 0;
+		}
+		node_type& operator=(node_type&& src) {
+			if (this == &src)
+				return *this;
+			release();
+			_node = src._node;
+			_dataAlloc = src._dataAlloc;
+			_rebindAlloc = src._rebindAlloc;
+			src._node = 0;
+			return *this;
+		}
+		~node_type() {
+			release();
+		}
+		bool empty() const {
+			return _node == 0;
+		}
+		explicit operator bool() const {
+			return _node != 0;
+		}
+		allocator_type get_allocator() const {
+			return _dataAlloc;
+		}
+		value_type& value() const {
+			return *_node->_data;
+		}
+	private:
+		friend class list;
+		t_list*			_node;
+		Alloc			_dataAlloc;
+		Alloc_rebind	_rebindAlloc;
+		node_type(t_list* node, const Alloc& dataAlloc, const Alloc_rebind& rebindAlloc) : _node(node), _dataAlloc(dataAlloc), _rebindAlloc(rebindAlloc) {}
+		node_type(const node_type&);
+		node_type& operator=(const node_type&);
+		void release() {
+			if (_node == 0)
+				return;
+			_dataAlloc.destroy(_node->_data);
+			_dataAlloc.deallocate(_node->_data, 1);
+			_rebindAlloc.destroy(_node);
+			_rebindAlloc.deallocate(_node, 1);
+			_node = 0;
+		}
+	};
 	
 	//MARK: - Constructors
-	explicit list (const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc) {
+	explicit list (const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _cache(0), _cached(0) {
 		_end = endNodeConsructor();
 		_size = 0;
 	}
-	explicit list (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc) {
+	explicit list (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _cache(0), _cached(0) {
 		_end = endNodeConsructor();
 		_size = 0;
 		for (size_type i = 0; i < n; i++) {
@@ -46,7 +108,7 @@ public:
 		}
 	};
 	template <class InputIterator>
-	list (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _dataAlloc(alloc) {
+	list (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _dataAlloc(alloc), _cache(0), _cached(0) {
 		_size = 0;
 		_end = endNodeConsructor();
 		while (first != last) {
@@ -54,7 +116,7 @@ public:
 			first++;
 		}
 	};
-	list (const list<T>& src) {
+	list (const list& src) : _cache(0), _cached(0) {
 		_size = 0;
 		_end = endNodeConsructor();
 		for (const_iterator it = src.cbegin(); it != src.cend(); it++)
@@ -63,10 +125,8 @@ public:
 	
 	//MARK: -  Destructor
 	~list() {
-		while (_end->_next != _end) {
-			pop_front();
-			_size--;
-		}
+		clear();
+		shrink_cache();
 		endNodeDestructor();
 	};
 	
@@ -307,6 +367,19 @@ public:
 	size_type max_size() const{
 		return std::numeric_limits<size_type>::max() / sizeof(t_list);
 	};
+	size_type cached_nodes() const {
+		return _cached;
+	};
+	void shrink_cache() {
+		while (_cache != 0) {
+			t_list* next = _cache->_next;
+			_dataAlloc.deallocate(_cache->_data, 1);
+			_rebindAlloc.destroy(_cache);
+			_rebindAlloc.deallocate(_cache, 1);
+			_cache = next;
+		}
+		_cached = 0;
+	};
 	
 	//MARK: - Element access
 	reference front() {
@@ -367,6 +440,17 @@ public:
 			first++;
 		}
 	};
+	iterator insert (iterator position, node_type&& nh) {
+		if (nh.empty())
+			return position;
+		t_list* newone = nh._node;
+		nh._node = 0;
+		insertBetween(position.point->_prev, position.point, newone);
+		return iterator(newone);
+	};
+	node_type extract (iterator position) {
+		return node_type(pullNode(position.point), _dataAlloc, _rebindAlloc);
+	};
 	iterator erase (iterator position) {
 		position++;
 		deleteOne(position.point->_prev);
@@ -407,62 +491,93 @@ public:
 	
 	//MARK: - Operations
 	void splice (iterator position, list& src) {
-		while (src._size != 0) {
-			insertBetween(position.point->_prev, position.point, src.pullNode(src._end->_next));
-		}
+		if (this == &src || src._size == 0)
+			return;
+		transferRange(position.point, src._end->_next, src._end);
+		_size += src._size;
+		src._size = 0;
 	};
 	void splice (iterator position, list& src, iterator i) {
+		if (position.point == i.point)
+			return;
 		insertBetween(position.point->_prev, position.point, src.pullNode(i.point));
 	};
 	void splice (iterator position, list& src, iterator first, iterator last) {
-		while (first != last) {
-			first++;
-			insertBetween(position.point->_prev, position.point, src.pullNode(first.point->_prev));
-		}
-	};
-	void remove (const value_type& val) {
-		iterator it = begin();
-		iterator ite = end();
-		while (it != ite) {
-			if (comaprator(val, it) == true)
-				deleteOne(it.point);
-			it++;
+		if (this == &src) {
+			transferRange(position.point, first.point, last.point);
+			return;
+		}
+		size_type n = 0;
+		for (t_list* tmp = first.point; tmp != last.point; tmp = tmp->_next)
+			n++;
+		splice(position, src, first, last, n);
+	};
+	void splice (iterator position, list& src, iterator first, iterator last, size_type n) {
+		if (first == last)
+			return;
+		transferRange(position.point, first.point, last.point);
+		if (this == &src)
+			return;
+		_size += n;
+		src._size -= n;
+	};
+	size_type remove (const value_type& val) {
+		t_list* removed = 0;
+		size_type res = 0;
+		for (t_list* tmp = _end->_next; tmp != _end;) {
+			t_list* next = tmp->_next;
+			if (*tmp->_data == val) {
+				chainNode(removed, tmp);
+				res++;
+			}
+			tmp = next;
 		}
+		freeChain(removed);
+		return res;
 	};
 	template <class Predicate>
-	void remove_if (Predicate pred){
-		iterator it = begin();
-		iterator ite = end();
-		while (it != ite) {
-			if (pred(*it) == true)
-				deleteOne(it.point);
-			it++;
-		}
-	};
-	void unique() {
-		iterator it = begin()++;
-		iterator eit = end();
-		while (it != eit) {
-			if (comaprator(*(it.point->_prev)->_data, it)) {
-				it++;
-				deleteOne(it.point->_prev);
+	size_type remove_if (Predicate pred) {
+		t_list* removed = 0;
+		size_type res = 0;
+		for (t_list* tmp = _end->_next; tmp != _end;) {
+			t_list* next = tmp->_next;
+			if (pred(*tmp->_data)) {
+				chainNode(removed, tmp);
+				res++;
 			}
-			else
-				it++;
+			tmp = next;
+		}
+		freeChain(removed);
+		return res;
+	};
+	size_type unique() {
+		t_list* removed = 0;
+		size_type res = 0;
+		for (t_list* tmp = _end->_next->_next; tmp != _end;) {
+			t_list* next = tmp->_next;
+			if (*(tmp->_prev)->_data == *tmp->_data) {
+				chainNode(removed, tmp);
+				res++;
+			}
+			tmp = next;
 		}
+		freeChain(removed);
+		return res;
 	};
 	template <class BinaryPredicate>
-	void unique (BinaryPredicate binary_pred) {
-		iterator it = begin()++;
-		iterator eit = end();
-		while (it != eit) {
-			if (binary_pred(*it.point->_data, *(it.point->_prev)->_data)) {
-				it++;
-				deleteOne(it.point->_prev);
+	size_type unique (BinaryPredicate binary_pred) {
+		t_list* removed = 0;
+		size_type res = 0;
+		for (t_list* tmp = _end->_next->_next; tmp != _end;) {
+			t_list* next = tmp->_next;
+			if (binary_pred(*(tmp->_prev)->_data, *tmp->_data)) {
+				chainNode(removed, tmp);
+				res++;
 			}
-			else
-				it++;
+			tmp = next;
 		}
+		freeChain(removed);
+		return res;
 	};
 	void merge (list& src) {
 		iterator it = begin();
@@ -530,11 +645,6 @@ public:
 	
 	//MARK: - Utilitys
 private:
-	bool comaprator(const value_type& val, iterator elem) {
-		if (*elem.point->_data == val)
-			return true;
-		return false;
-	}
 	t_list* pullNode(t_list* toPull) {
 		_size--;
 		(toPull->_next)->_prev = toPull->_prev;
@@ -543,15 +653,48 @@ private:
 		toPull->_prev = nullptr;
 		return toPull;
 	}
+	void chainNode(t_list*& chain, t_list* toPull) {
+		pullNode(toPull);
+		toPull->_next = chain;
+		chain = toPull;
+	}
+	void freeChain(t_list* chain) {
+		while (chain != 0) {
+			t_list* next = chain->_next;
+			releaseNode(chain);
+			chain = next;
+		}
+	}
 	void deleteOne(t_list* toDelete) {
 		(toDelete->_prev)->_next = toDelete->_next;
 		(toDelete->_next)->_prev = toDelete->_prev;
-		_dataAlloc.destroy(toDelete->_data);
-		_dataAlloc.deallocate(toDelete->_data, 1);
-		_rebindAlloc.destroy(toDelete);
-		_rebindAlloc.deallocate(toDelete, 1);
+		releaseNode(toDelete);
 		_size--;
 	}
+	void releaseNode(t_list* toRelease) {
+		_dataAlloc.destroy(toRelease->_data);
+		if (_cached < CachePolicy::high_water) {
+			toRelease->_next = _cache;
+			_cache = toRelease;
+			_cached++;
+			return;
+		}
+		_dataAlloc.deallocate(toRelease->_data, 1);
+		_rebindAlloc.destroy(toRelease);
+		_rebindAlloc.deallocate(toRelease, 1);
+	}
+	void transferRange(t_list* position, t_list* first, t_list* last) {
+		if (first == last || position == last)
+			return;
+		t_list* before = first->_prev;
+		t_list* tail = last->_prev;
+		before->_next = last;
+		last->_prev = before;
+		(position->_prev)->_next = first;
+		first->_prev = position->_prev;
+		tail->_next = position;
+		position->_prev = tail;
+	}
 	void insertBetween(t_list* left, t_list* right, t_list* newone) {
 		left->_next = newone;
 		newone->_next = right;
@@ -560,6 +703,15 @@ private:
 		_size++;
 	};
 	t_list* createNode(const value_type& val) {
+		if (_cache != 0) {
+			t_list* newone = _cache;
+			_dataAlloc.construct(newone->_data, val);
+			_cache = newone->_next;
+			_cached--;
+			newone->_next = _end;
+			newone->_prev = _end;
+			return (newone);
+		}
 		t_list *newone = _rebindAlloc.allocate(1);
 		_rebindAlloc.construct(newone);
 		newone->_data = _dataAlloc.allocate(1);
@@ -586,14 +738,14 @@ private:
 };
 
 //MARK: - Non-member function overloads
-template <class T, class Alloc>
-bool operator== (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
+template <class T, class Alloc, class CachePolicy>
+bool operator== (const ft::list<T,Alloc,CachePolicy>& lhs, const ft::list<T,Alloc,CachePolicy>& rhs) {
 	if (lhs.size() != rhs.size())
 		return false;
-	typename ft::list<T>::const_iterator lit = lhs.cbegin();
-	typename ft::list<T>::const_iterator lite = lhs.cend();
-	typename ft::list<T>::const_iterator rit = rhs.cbegin();
-	typename ft::list<T>::const_iterator rite = rhs.cend();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator lit = lhs.cbegin();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator lite = lhs.cend();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator rit = rhs.cbegin();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator rite = rhs.cend();
 	while (lit != lite) {
 		if (*lit != *rit)
 			return false ;
@@ -604,21 +756,21 @@ bool operator== (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
 		return true ;
 	return false;
 };
-template <class T, class Alloc>
-bool operator!= (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
+template <class T, class Alloc, class CachePolicy>
+bool operator!= (const ft::list<T,Alloc,CachePolicy>& lhs, const ft::list<T,Alloc,CachePolicy>& rhs) {
 	return !(lhs == rhs);
 };
-template <class T, class Alloc>
-bool operator<  (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
+template <class T, class Alloc, class CachePolicy>
+bool operator<  (const ft::list<T,Alloc,CachePolicy>& lhs, const ft::list<T,Alloc,CachePolicy>& rhs) {
 	size_t size;
 	if (lhs.size() < rhs.size())
 		size = lhs.size();
 	else
 		size = rhs.size();
-	typename ft::list<T>::const_iterator lit = lhs.cbegin();
-	typename ft::list<T>::const_iterator lite = lhs.cend();
-	typename ft::list<T>::const_iterator rit = rhs.cbegin();
-	typename ft::list<T>::const_iterator rite = rhs.cend();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator lit = lhs.cbegin();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator lite = lhs.cend();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator rit = rhs.cbegin();
+	typename ft::list<T,Alloc,CachePolicy>::const_iterator rite = rhs.cend();
 	for (size_t i = 0; i < size; i++) {
 		if (*rit < *lit)
 			return false;
@@ -629,20 +781,20 @@ bool operator<  (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
 	}
 	return false;
 };
-template <class T, class Alloc>
-bool operator<= (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
+template <class T, class Alloc, class CachePolicy>
+bool operator<= (const ft::list<T,Alloc,CachePolicy>& lhs, const ft::list<T,Alloc,CachePolicy>& rhs) {
 	return (lhs < rhs || lhs == rhs);
 };
-template <class T, class Alloc>
-bool operator>  (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
+template <class T, class Alloc, class CachePolicy>
+bool operator>  (const ft::list<T,Alloc,CachePolicy>& lhs, const ft::list<T,Alloc,CachePolicy>& rhs) {
 	return !(lhs <= rhs);
 };
-template <class T, class Alloc>
-bool operator>= (const ft::list<T,Alloc>& lhs, const ft::list<T,Alloc>& rhs) {
+template <class T, class Alloc, class CachePolicy>
+bool operator>= (const ft::list<T,Alloc,CachePolicy>& lhs, const ft::list<T,Alloc,CachePolicy>& rhs) {
 	return (!(lhs < rhs) || lhs == rhs);
 };
-template <class T, class Alloc>
-void swap (ft::list<T,Alloc>& x, ft::list<T,Alloc>& y) {
+template <class T, class Alloc, class CachePolicy>
+void swap (ft::list<T,Alloc,CachePolicy>& x, ft::list<T,Alloc,CachePolicy>& y) {
 	x.swap(y);
 };
 }
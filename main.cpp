@@ -1,11 +1,28 @@
+#include <algorithm>
 #include <list>
+#include <numeric>
+#include <forward_list>
 #include <vector>
 #include <map>
+#include <set>
 #include <queue>
 #include <stack>
+#include <unordered_map>
+#include <chrono>
+#include <sstream>
+#include <ctime>
+#include <stdexcept>
 #include "map.hpp"
+#include "set.hpp"
+#include "unordered_map.hpp"
 #include "list.hpp"
+#include "intrusive_list.hpp"
+#include "forward_list.hpp"
+#include "unrolled_list.hpp"
 #include "vector.hpp"
+#include "mmap_vector.hpp"
+#include "aligned_allocator.hpp"
+#include "parallel.hpp"
 #include "queue.hpp"
 #include "stack.hpp"
 
@@ -70,8 +87,186 @@ void listPopBackElem(std::list<T> &std, ft::list<T> &ft, unsigned long number) {
 	}
 }
 
+//MARK: - Utilst forward list
+
+template <typename T>
+void forwardListPushElem(std::forward_list<T> &std, ft::forward_list<T> &ft, unsigned long number) {
+	T i;
+	for (unsigned long l = 0; l < number; l++) {
+		i = rand() % 20;
+		std.push_front(i);
+		ft.push_front(i);
+	}
+}
+
+template <typename T>
+void forwardListFillStr(std::forward_list<T> &def, ft::forward_list<T> &my, std::string &std, std::string &ft) {
+	size_t stdSize = 0;
+	size_t ftSize = 0;
+	for (typename std::forward_list<T>::iterator it = def.begin(); it != def.end(); it++) {
+		std += *it;
+		stdSize++;
+	}
+	for (typename ft::forward_list<T>::iterator it = my.begin(); it != my.end(); it++) {
+		ft += *it;
+		ftSize++;
+	}
+	std += stdSize;
+	ft += ftSize;
+	std += def.empty();
+	ft += my.empty();
+}
+
+//MARK: - Utilst unrolled list
+
+template <typename T>
+void unrolledPushElem(std::list<T> &std, ft::unrolled_list<T, 4> &ft, unsigned long number) {
+	T i;
+	for (unsigned long l = 0; l < number; l++) {
+		i = rand() % 20;
+		std.push_back(i);
+		ft.push_back(i);
+	}
+}
+
+template <typename T>
+void unrolledFillStr(std::list<T> &def, ft::unrolled_list<T, 4> &my, std::string &std, std::string &ft) {
+	for (typename std::list<T>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (typename ft::unrolled_list<T, 4>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	for (typename std::list<T>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (typename ft::unrolled_list<T, 4>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	std += def.size();
+	ft += my.size();
+}
+
+//MARK: - Utilst intrusive list
+
+template <typename T>
+struct IntrusiveElem {
+	T value;
+	ft::list_hook hook;
+	IntrusiveElem() : value() {}
+	bool operator==(const IntrusiveElem& rhs) const {
+		return value == rhs.value;
+	}
+	bool operator<(const IntrusiveElem& rhs) const {
+		return value < rhs.value;
+	}
+};
+
+template <typename T>
+void intrusivePushBackElem(std::list<T> &std, ft::intrusive_list<IntrusiveElem<T>, &IntrusiveElem<T>::hook> &ft,
+						   std::vector<IntrusiveElem<T> > &storage, unsigned long number) {
+	storage.resize(number);
+	for (unsigned long l = 0; l < number; l++) {
+		storage[l].value = rand() % 20;
+		std.push_back(storage[l].value);
+		ft.push_back(storage[l]);
+	}
+}
+
+template <typename T>
+void intrusiveFillStr(std::list<T> &def, ft::intrusive_list<IntrusiveElem<T>, &IntrusiveElem<T>::hook> &my, std::string &std, std::string &ft) {
+	typedef ft::intrusive_list<IntrusiveElem<T>, &IntrusiveElem<T>::hook> List;
+	for (typename std::list<T>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (typename List::iterator it = my.begin(); it != my.end(); it++)
+		ft += it->value;
+	for (typename std::list<T>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (typename List::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += it->value;
+	std += def.size();
+	ft += my.size();
+}
+
+//MARK: - Utilst parallel
+
+template <typename T>
+struct doubleInPlace {
+	void operator()(T& val) const {
+		val = val + val;
+	}
+};
+
+template <typename T>
+struct doubleValue {
+	T operator()(const T& val) const {
+		return val + val;
+	}
+};
+
+template <typename T>
+struct equalValue {
+	T val;
+	equalValue(const T& src) : val(src) {}
+	bool operator()(const T& elem) const {
+		return elem == val;
+	}
+};
+
+template <typename T>
+void parallelPushElem(std::vector<T> &std, ft::vector<T> &ft, unsigned long number) {
+	T i;
+	for (unsigned long l = 0; l < number; l++) {
+		i = rand() % 20;
+		std.push_back(i);
+		ft.push_back(i);
+	}
+}
+
 //MARK: - Utilst vector
 
+struct LiveCounter {
+	static long live;
+	int val;
+	LiveCounter(int src = 0) : val(src) {
+		live++;
+	}
+	LiveCounter(const LiveCounter& src) : val(src.val) {
+		live++;
+	}
+	LiveCounter& operator=(const LiveCounter& src) {
+		val = src.val;
+		return *this;
+	}
+	~LiveCounter() {
+		live--;
+	}
+};
+long LiveCounter::live = 0;
+
+template <class Vector>
+void lifetimeSteps(Vector& vec, std::string& out) {
+	for (int i = 0; i < 20; i++)
+		vec.push_back(LiveCounter(i));
+	out += LiveCounter::live;
+	vec.erase(vec.begin() + 2, vec.begin() + 7);
+	out += LiveCounter::live;
+	vec.erase(vec.begin());
+	out += LiveCounter::live;
+	vec.insert(vec.begin() + 3, 4, LiveCounter(-1));
+	out += LiveCounter::live;
+	vec.resize(5);
+	out += LiveCounter::live;
+	vec.assign(3, LiveCounter(7));
+	out += LiveCounter::live;
+	Vector copy(vec);
+	copy.push_back(LiveCounter(8));
+	vec = copy;
+	out += LiveCounter::live;
+	vec.pop_back();
+	out += LiveCounter::live;
+	vec.clear();
+	out += LiveCounter::live;
+	for (typename Vector::iterator it = copy.begin(); it != copy.end(); it++)
+		out += it->val;
+}
+
 template <typename T>
 void VectorPushBackElem(std::vector<T> &std, ft::vector<T> &ft, unsigned long number) {
 	T i;
@@ -133,6 +328,176 @@ void mapFillStr(std::map<Key,T> &def, ft::map<Key,T> &my, std::string &std, std:
 	ft += my.size();
 }
 
+//MARK: - Utilst unordered map
+
+template <typename Key, typename T>
+void unorderedMapInsertElem(std::unordered_map<Key,T> &std, ft::unordered_map<Key,T> &ft, unsigned long number) {
+	Key i;
+	T j;
+	for (unsigned long l = 0; l < number; l++) {
+		i = rand();
+		j = rand();
+		std::pair<Key, T> res(i, j);
+		std.insert(res);
+		ft.insert(res);
+	}
+}
+
+template <typename Key, typename T>
+void unorderedMapFillStr(std::unordered_map<Key,T> &def, ft::unordered_map<Key,T> &my, std::string &std, std::string &ft) {
+	for (typename std::unordered_map<Key,T>::iterator it = def.begin(); it != def.end(); it++) {
+		typename ft::unordered_map<Key,T>::iterator res = my.find(it->first);
+		std += it->first;
+		std += it->second;
+		if (res != my.end()) {
+			ft += res->first;
+			ft += res->second;
+		}
+	}
+	unsigned long elems = 0;
+	for (typename ft::unordered_map<Key,T>::iterator it = my.begin(); it != my.end(); it++)
+		elems++;
+	std += def.size();
+	ft += elems;
+}
+
+//MARK: - Utilst set
+
+template <typename Std, typename Ft>
+void setInsertElem(Std &std, Ft &ft, unsigned long number, int range) {
+	for (unsigned long l = 0; l < number; l++) {
+		typename Std::value_type i;
+		i = rand() % range;
+		std.insert(i);
+		ft.insert(i);
+	}
+}
+
+template <typename Std, typename Ft>
+void setFillStr(Std &def, Ft &my, std::string &std, std::string &ft) {
+	for (typename Std::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (typename Ft::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	for (typename Std::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (typename Ft::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	std += def.size();
+	ft += my.size();
+}
+
+//MARK: - Utilst multimap
+
+template <typename Key, typename T>
+void multimapInsertElem(std::multimap<Key,T> &std, ft::multimap<Key,T> &ft, unsigned long number, int range) {
+	Key i;
+	T j;
+	for (unsigned long l = 0; l < number; l++) {
+		i = rand() % range;
+		j = rand();
+		std::pair<Key, T> res(i, j);
+		std.insert(res);
+		ft.insert(res);
+	}
+}
+
+template <typename Key, typename T>
+void multimapFillStr(std::multimap<Key,T> &def, ft::multimap<Key,T> &my, std::string &std, std::string &ft) {
+	for (typename std::multimap<Key,T>::iterator it = def.begin(); it != def.end(); it++) {
+		std += it->first;
+		std += it->second;
+	}
+	for (typename ft::multimap<Key,T>::iterator it = my.begin(); it != my.end(); it++) {
+		ft += it->first;
+		ft += it->second;
+	}
+	std += def.size();
+	ft += my.size();
+}
+
+//MARK: - Utils benchmark
+
+double elapsedMs(clock_t start) {
+	return static_cast<double>(clock() - start) * 1000 / CLOCKS_PER_SEC;
+}
+
+size_t allocationCount = 0;
+size_t allocatedBytes = 0;
+
+template <class T>
+class CountingAllocator : public std::allocator<T> {
+public:
+	template <class U>
+	struct rebind {
+		typedef CountingAllocator<U> other;
+	};
+	CountingAllocator() {}
+	CountingAllocator(const CountingAllocator& src) : std::allocator<T>(src) {}
+	CountingAllocator& operator=(const CountingAllocator&) = default;
+	template <class U>
+	CountingAllocator(const CountingAllocator<U>& src) : std::allocator<T>(src) {}
+	T* allocate(size_t n, const void* hint = 0) {
+		(void)hint;
+		allocationCount++;
+		allocatedBytes += n * sizeof(T);
+		return std::allocator<T>::allocate(n);
+	}
+};
+
+long comparisonBudget = -1;
+
+struct ThrowingLess {
+	bool operator()(int lhs, int rhs) const {
+		if (comparisonBudget >= 0 && comparisonBudget-- == 0)
+			throw std::runtime_error("comparison budget exhausted");
+		return lhs < rhs;
+	}
+};
+
+long copyBudget = -1;
+long liveObjects = 0;
+
+struct ThrowingCopy {
+	int value;
+	ThrowingCopy(int src = 0) : value(src) {
+		liveObjects++;
+	}
+	ThrowingCopy(const ThrowingCopy& src) : value(src.value) {
+		spend();
+		liveObjects++;
+	}
+	ThrowingCopy& operator=(const ThrowingCopy& src) {
+		spend();
+		value = src.value;
+		return *this;
+	}
+	~ThrowingCopy() {
+		liveObjects--;
+	}
+	static void spend() {
+		if (copyBudget >= 0 && copyBudget-- == 0)
+			throw std::runtime_error("copy budget exhausted");
+	}
+};
+
+template <class Map>
+bool mapIsConsistent(Map &m) {
+	size_t forward = 0;
+	size_t backward = 0;
+	bool sorted = true;
+	for (typename Map::iterator it = m.begin(); it != m.end(); it++) {
+		typename Map::iterator next = it;
+		next++;
+		if (next != m.end() && !(it->first < next->first))
+			sorted = false;
+		forward++;
+	}
+	for (typename Map::reverse_iterator it = m.rbegin(); it != m.rend(); it++)
+		backward++;
+	return sorted && forward == m.size() && backward == m.size();
+}
+
 //MARK: - Utils stack
 
 template <typename T>
@@ -1434,6 +1799,132 @@ void spliceTestRangeStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
+void spliceTestLengthInt(std::string &std, std::string &ft) {
+	std::cout << "Splice range with length int test" << " ";
+	std::list<int> def;
+	ft::list<int> my;
+	std::list<int> splice;
+	ft::list<int> mySplice;
+	listPushBackElem(def, my, 10);
+	listPushBackElem(splice, mySplice, 20);
+	std::list<int>::iterator first = splice.begin();
+	std::list<int>::iterator last = splice.begin();
+	ft::list<int>::iterator myFirst = mySplice.begin();
+	ft::list<int>::iterator myLast = mySplice.begin();
+	std::advance(first, 3);
+	std::advance(last, 15);
+	std::advance(myFirst, 3);
+	std::advance(myLast, 15);
+	def.splice(++def.begin(), splice, first, last);
+	my.splice(++my.begin(), mySplice, myFirst, myLast, 12);
+	def.splice(def.end(), def, def.begin(), ++(++def.begin()));
+	my.splice(my.end(), my, my.begin(), ++(++my.begin()));
+	def.splice(def.begin(), splice);
+	my.splice(my.begin(), mySplice);
+	std += def.size();
+	ft += my.size();
+	for (std::list<int>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<int>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += splice.size();
+	ft += mySplice.size();
+	for (std::list<int>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (ft::list<int>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void spliceTestLengthFloat(std::string &std, std::string &ft) {
+	std::cout << "Splice range with length float test" << " ";
+	std::list<float> def;
+	ft::list<float> my;
+	std::list<float> splice;
+	ft::list<float> mySplice;
+	listPushBackElem(def, my, 10);
+	listPushBackElem(splice, mySplice, 20);
+	std::list<float>::iterator first = splice.begin();
+	std::list<float>::iterator last = splice.begin();
+	ft::list<float>::iterator myFirst = mySplice.begin();
+	ft::list<float>::iterator myLast = mySplice.begin();
+	std::advance(first, 3);
+	std::advance(last, 15);
+	std::advance(myFirst, 3);
+	std::advance(myLast, 15);
+	def.splice(++def.begin(), splice, first, last);
+	my.splice(++my.begin(), mySplice, myFirst, myLast, 12);
+	def.splice(def.end(), def, def.begin(), ++(++def.begin()));
+	my.splice(my.end(), my, my.begin(), ++(++my.begin()));
+	def.splice(def.begin(), splice);
+	my.splice(my.begin(), mySplice);
+	std += def.size();
+	ft += my.size();
+	for (std::list<float>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<float>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += splice.size();
+	ft += mySplice.size();
+	for (std::list<float>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (ft::list<float>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void spliceTestLengthStr(std::string &std, std::string &ft) {
+	std::cout << "Splice range with length std::string test" << " ";
+	std::list<std::string> def;
+	ft::list<std::string> my;
+	std::list<std::string> splice;
+	ft::list<std::string> mySplice;
+	listPushBackElem(def, my, 10);
+	listPushBackElem(splice, mySplice, 20);
+	std::list<std::string>::iterator first = splice.begin();
+	std::list<std::string>::iterator last = splice.begin();
+	ft::list<std::string>::iterator myFirst = mySplice.begin();
+	ft::list<std::string>::iterator myLast = mySplice.begin();
+	std::advance(first, 3);
+	std::advance(last, 15);
+	std::advance(myFirst, 3);
+	std::advance(myLast, 15);
+	def.splice(++def.begin(), splice, first, last);
+	my.splice(++my.begin(), mySplice, myFirst, myLast, 12);
+	def.splice(def.end(), def, def.begin(), ++(++def.begin()));
+	my.splice(my.end(), my, my.begin(), ++(++my.begin()));
+	def.splice(def.begin(), splice);
+	my.splice(my.begin(), mySplice);
+	std += def.size();
+	ft += my.size();
+	for (std::list<std::string>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<std::string>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += splice.size();
+	ft += mySplice.size();
+	for (std::list<std::string>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (ft::list<std::string>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
 void removeTestInt(std::string &std, std::string &ft) {
 	std::cout << "Remove int test" << " ";
 	std::list<int> def;
@@ -1635,31 +2126,313 @@ void uniqueTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void mergeTestInt(std::string &std, std::string &ft) {
-	std::cout << "Merge int test" << " ";
+void removeCountTest(std::string &std, std::string &ft) {
+	std::cout << "Remove count int test" << " ";
 	std::list<int> def;
 	ft::list<int> my;
-	std::list<int> mergDef;
-	ft::list<int> mergMy;
-	listPushBackElem(def, my, 10);
-	listPushBackElem(mergDef, mergMy, 10);
+	listPushBackElem(def, my, 200);
+	for (int i = 0; i < 30; i++) {
+		def.push_back(def.front());
+		my.push_back(my.front());
+	}
+	size_t before = def.size();
+	def.remove(def.front());
+	std += before - def.size();
+	ft += my.remove(my.front());
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	before = def.size();
+	def.remove(def.back());
+	std += before - def.size();
+	ft += my.remove(my.back());
 	std += def.size();
 	ft += my.size();
 	for (std::list<int>::iterator it = def.begin(); it != def.end(); it++)
 		std += *it;
 	for (ft::list<int>::iterator it = my.begin(); it != my.end(); it++)
 		ft += *it;
-	std += def.size();
-	ft += my.size();
-	for (std::list<int>::iterator it = mergDef.begin(); it != mergDef.end(); it++)
+	for (std::list<int>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
 		std += *it;
-	for (ft::list<int>::iterator it = mergMy.begin(); it != mergMy.end(); it++)
+	for (ft::list<int>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
 		ft += *it;
-	def.merge(mergDef);
-	my.merge(mergMy);
+	def.clear();
+	my.clear();
+	std += def.size();
+	ft += my.remove(int()) + my.unique();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void removeCountTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Remove count float test" << " ";
+	std::list<float> def;
+	ft::list<float> my;
+	listPushBackElem(def, my, 200);
+	for (int i = 0; i < 30; i++) {
+		def.push_back(def.front());
+		my.push_back(my.front());
+	}
+	size_t before = def.size();
+	def.remove(def.front());
+	std += before - def.size();
+	ft += my.remove(my.front());
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	before = def.size();
+	def.remove(def.back());
+	std += before - def.size();
+	ft += my.remove(my.back());
 	std += def.size();
 	ft += my.size();
-	for (std::list<int>::iterator it = def.begin(); it != def.end(); it++)
+	for (std::list<float>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<float>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	for (std::list<float>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (ft::list<float>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	def.clear();
+	my.clear();
+	std += def.size();
+	ft += my.remove(float()) + my.unique();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void removeCountTestStr(std::string &std, std::string &ft) {
+	std::cout << "Remove count std::string test" << " ";
+	std::list<std::string> def;
+	ft::list<std::string> my;
+	listPushBackElem(def, my, 200);
+	for (int i = 0; i < 30; i++) {
+		def.push_back(def.front());
+		my.push_back(my.front());
+	}
+	size_t before = def.size();
+	def.remove(def.front());
+	std += before - def.size();
+	ft += my.remove(my.front());
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	before = def.size();
+	def.remove(def.back());
+	std += before - def.size();
+	ft += my.remove(my.back());
+	std += def.size();
+	ft += my.size();
+	for (std::list<std::string>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<std::string>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	for (std::list<std::string>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (ft::list<std::string>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	def.clear();
+	my.clear();
+	std += def.size();
+	ft += my.remove(std::string()) + my.unique();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void nodeCacheTest(std::string &std, std::string &ft) {
+	std::cout << "Node cache int test" << " ";
+	std::list<int> def;
+	ft::list<int, std::allocator<int>, ft::node_cache<8> > my;
+	int val;
+	for (int i = 0; i < 50; i++) {
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+	}
+	for (int i = 0; i < 30; i++) {
+		def.pop_front();
+		my.pop_front();
+	}
+	std += 8;
+	ft += my.cached_nodes();
+	for (int i = 0; i < 100; i++) {
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+		def.pop_front();
+		my.pop_front();
+	}
+	val = 3;
+	def.remove(val);
+	my.remove(val);
+	for (int i = 0; i < 5; i++) {
+		def.push_front(val);
+		my.push_front(val);
+	}
+	std += def.size();
+	ft += my.size();
+	for (std::list<int>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<int, std::allocator<int>, ft::node_cache<8> >::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	ft::list<int, std::allocator<int>, ft::node_cache<8> > copy(my);
+	std += true;
+	ft += (copy == my);
+	my.clear();
+	my.shrink_cache();
+	std += true;
+	ft += (my.cached_nodes() == 0);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void nodeCacheTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Node cache float test" << " ";
+	std::list<float> def;
+	ft::list<float, std::allocator<float>, ft::node_cache<8> > my;
+	float val;
+	for (int i = 0; i < 50; i++) {
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+	}
+	for (int i = 0; i < 30; i++) {
+		def.pop_front();
+		my.pop_front();
+	}
+	std += 8;
+	ft += my.cached_nodes();
+	for (int i = 0; i < 100; i++) {
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+		def.pop_front();
+		my.pop_front();
+	}
+	val = 3;
+	def.remove(val);
+	my.remove(val);
+	for (int i = 0; i < 5; i++) {
+		def.push_front(val);
+		my.push_front(val);
+	}
+	std += def.size();
+	ft += my.size();
+	for (std::list<float>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<float, std::allocator<float>, ft::node_cache<8> >::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	ft::list<float, std::allocator<float>, ft::node_cache<8> > copy(my);
+	std += true;
+	ft += (copy == my);
+	my.clear();
+	my.shrink_cache();
+	std += true;
+	ft += (my.cached_nodes() == 0);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void nodeCacheTestStr(std::string &std, std::string &ft) {
+	std::cout << "Node cache std::string test" << " ";
+	std::list<std::string> def;
+	ft::list<std::string, std::allocator<std::string>, ft::node_cache<8> > my;
+	std::string val;
+	for (int i = 0; i < 50; i++) {
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+	}
+	for (int i = 0; i < 30; i++) {
+		def.pop_front();
+		my.pop_front();
+	}
+	std += 8;
+	ft += my.cached_nodes();
+	for (int i = 0; i < 100; i++) {
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+		def.pop_front();
+		my.pop_front();
+	}
+	val = 3;
+	def.remove(val);
+	my.remove(val);
+	for (int i = 0; i < 5; i++) {
+		def.push_front(val);
+		my.push_front(val);
+	}
+	std += def.size();
+	ft += my.size();
+	for (std::list<std::string>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<std::string, std::allocator<std::string>, ft::node_cache<8> >::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	ft::list<std::string, std::allocator<std::string>, ft::node_cache<8> > copy(my);
+	std += true;
+	ft += (copy == my);
+	my.clear();
+	my.shrink_cache();
+	std += true;
+	ft += (my.cached_nodes() == 0);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void mergeTestInt(std::string &std, std::string &ft) {
+	std::cout << "Merge int test" << " ";
+	std::list<int> def;
+	ft::list<int> my;
+	std::list<int> mergDef;
+	ft::list<int> mergMy;
+	listPushBackElem(def, my, 10);
+	listPushBackElem(mergDef, mergMy, 10);
+	std += def.size();
+	ft += my.size();
+	for (std::list<int>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<int>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += def.size();
+	ft += my.size();
+	for (std::list<int>::iterator it = mergDef.begin(); it != mergDef.end(); it++)
+		std += *it;
+	for (ft::list<int>::iterator it = mergMy.begin(); it != mergMy.end(); it++)
+		ft += *it;
+	def.merge(mergDef);
+	my.merge(mergMy);
+	std += def.size();
+	ft += my.size();
+	for (std::list<int>::iterator it = def.begin(); it != def.end(); it++)
 		std += *it;
 	for (ft::list<int>::iterator it = my.begin(); it != my.end(); it++)
 		ft += *it;
@@ -2553,6 +3326,152 @@ void swapNonMemberTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
+//MARK: - Node handle list
+
+void extractTestInt(std::string &std, std::string &ft) {
+	std::cout << "Extract and insert node int test" << " ";
+	std::list<int> def;
+	std::list<int> defOther;
+	ft::list<int> my;
+	ft::list<int> myOther;
+	listPushBackElem(def, my, 100);
+	listPushBackElem(defOther, myOther, 10);
+	int i = 0;
+	for (std::list<int>::iterator it = def.begin(); it != def.end(); i++) {
+		std::list<int>::iterator tmp = it++;
+		if (i % 3 == 0)
+			defOther.splice(defOther.begin(), def, tmp);
+	}
+	i = 0;
+	for (ft::list<int>::iterator it = my.begin(); it != my.end(); i++) {
+		ft::list<int>::iterator tmp = it++;
+		if (i % 3 == 0)
+			myOther.insert(myOther.begin(), my.extract(tmp));
+	}
+	ft::list<int>::node_type nh = my.extract(my.begin());
+	nh.value() = 42;
+	ft += *my.insert(my.end(), std::move(nh));
+	ft += (nh.empty());
+	def.pop_front();
+	def.push_back(42);
+	std += def.back();
+	std += true;
+	std += def.size();
+	ft += my.size();
+	std += defOther.size();
+	ft += myOther.size();
+	for (std::list<int>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<int>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	for (std::list<int>::iterator it = defOther.begin(); it != defOther.end(); it++)
+		std += *it;
+	for (ft::list<int>::iterator it = myOther.begin(); it != myOther.end(); it++)
+		ft += *it;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void extractTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Extract and insert node float test" << " ";
+	std::list<float> def;
+	std::list<float> defOther;
+	ft::list<float> my;
+	ft::list<float> myOther;
+	listPushBackElem(def, my, 100);
+	listPushBackElem(defOther, myOther, 10);
+	int i = 0;
+	for (std::list<float>::iterator it = def.begin(); it != def.end(); i++) {
+		std::list<float>::iterator tmp = it++;
+		if (i % 3 == 0)
+			defOther.splice(defOther.begin(), def, tmp);
+	}
+	i = 0;
+	for (ft::list<float>::iterator it = my.begin(); it != my.end(); i++) {
+		ft::list<float>::iterator tmp = it++;
+		if (i % 3 == 0)
+			myOther.insert(myOther.begin(), my.extract(tmp));
+	}
+	ft::list<float>::node_type nh = my.extract(my.begin());
+	nh.value() = 42;
+	ft += *my.insert(my.end(), std::move(nh));
+	ft += (nh.empty());
+	def.pop_front();
+	def.push_back(42);
+	std += def.back();
+	std += true;
+	std += def.size();
+	ft += my.size();
+	std += defOther.size();
+	ft += myOther.size();
+	for (std::list<float>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<float>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	for (std::list<float>::iterator it = defOther.begin(); it != defOther.end(); it++)
+		std += *it;
+	for (ft::list<float>::iterator it = myOther.begin(); it != myOther.end(); it++)
+		ft += *it;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void extractTestStr(std::string &std, std::string &ft) {
+	std::cout << "Extract and insert node std::string test" << " ";
+	std::list<std::string> def;
+	std::list<std::string> defOther;
+	ft::list<std::string> my;
+	ft::list<std::string> myOther;
+	listPushBackElem(def, my, 100);
+	listPushBackElem(defOther, myOther, 10);
+	int i = 0;
+	for (std::list<std::string>::iterator it = def.begin(); it != def.end(); i++) {
+		std::list<std::string>::iterator tmp = it++;
+		if (i % 3 == 0)
+			defOther.splice(defOther.begin(), def, tmp);
+	}
+	i = 0;
+	for (ft::list<std::string>::iterator it = my.begin(); it != my.end(); i++) {
+		ft::list<std::string>::iterator tmp = it++;
+		if (i % 3 == 0)
+			myOther.insert(myOther.begin(), my.extract(tmp));
+	}
+	ft::list<std::string>::node_type nh = my.extract(my.begin());
+	nh.value() = "42";
+	ft += *my.insert(my.end(), std::move(nh));
+	ft += (nh.empty());
+	def.pop_front();
+	def.push_back("42");
+	std += def.back();
+	std += true;
+	std += def.size();
+	ft += my.size();
+	std += defOther.size();
+	ft += myOther.size();
+	for (std::list<std::string>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::list<std::string>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	for (std::list<std::string>::iterator it = defOther.begin(); it != defOther.end(); it++)
+		std += *it;
+	for (ft::list<std::string>::iterator it = myOther.begin(); it != myOther.end(); it++)
+		ft += *it;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
 //MARK: - List
 void  testList() {
 	std::cout << "                            CONSTRUCTOR" << std::endl;
@@ -2601,11 +3520,20 @@ void  testList() {
 	spliceTestRangeInt(std, ft);
 	spliceTestRangeFloat(std, ft);
 	spliceTestRangeStr(std, ft);
+	spliceTestLengthInt(std, ft);
+	spliceTestLengthFloat(std, ft);
+	spliceTestLengthStr(std, ft);
 	removeTestInt(std, ft);
 	removeTestFloat(std, ft);
 	removeTestStr(std, ft);
 	removeIfTest(std, ft);
 	uniqueTest(std, ft);
+	removeCountTest(std, ft);
+	removeCountTestFloat(std, ft);
+	removeCountTestStr(std, ft);
+	nodeCacheTest(std, ft);
+	nodeCacheTestFloat(std, ft);
+	nodeCacheTestStr(std, ft);
 
 	mergeTestInt(std, ft);
 	mergeTestFloat(std, ft);
@@ -2616,6 +3544,10 @@ void  testList() {
 	reverseTestInt(std, ft);
 	reverseTestFloat(std, ft);
 	reverseTestStr(std, ft);
+	std::cout << "                            NODE HANDLES" << std::endl;
+	extractTestInt(std, ft);
+	extractTestFloat(std, ft);
+	extractTestStr(std, ft);
 	std::cout << "                            NON-MEMBER FUNCTION OVERLOADS" << std::endl;
 	equalTest(std, ft);
 	equalTestFloat(std, ft);
@@ -2640,13 +3572,183 @@ void  testList() {
 	swapNonMemberTestStr(std, ft);
 }
 
-//MARK: - Defoult constructor vector
-
-void defaultCnstTestVector(std::string &std, std::string &ft) {
-	std::cout << "Default constructor int test" << " ";
-	std::vector<int> def;
-	ft::vector<int> my;
-	VectorFillStr(def, my, std, ft);
+//MARK: - Forward list
+
+void modifiersForwardListTest(std::string &std, std::string &ft) {
+	std::cout << "Insert_after, erase_after and resize int test" << " ";
+	std::forward_list<int> def;
+	ft::forward_list<int> my;
+	forwardListPushElem(def, my, 100);
+	std::vector<int> src(def.begin(), def.end());
+	int val;
+	val = 7;
+	std::forward_list<int>::iterator it = def.before_begin();
+	ft::forward_list<int>::iterator myIt = my.before_begin();
+	std::advance(it, 10);
+	std::advance(myIt, 10);
+	std += *def.insert_after(it, val);
+	ft += *my.insert_after(myIt, val);
+	std += *def.insert_after(it, 5, val);
+	ft += *my.insert_after(myIt, 5, val);
+	std += *def.insert_after(it, src.begin(), src.begin() + 20);
+	ft += *my.insert_after(myIt, src.begin(), src.begin() + 20);
+	std += *def.emplace_after(def.before_begin(), val);
+	ft += *my.emplace_after(my.before_begin(), val);
+	forwardListFillStr(def, my, std, ft);
+	std += *def.erase_after(it);
+	ft += *my.erase_after(myIt);
+	std::forward_list<int>::iterator last = it;
+	ft::forward_list<int>::iterator myLast = myIt;
+	std::advance(last, 15);
+	std::advance(myLast, 15);
+	def.erase_after(it, last);
+	my.erase_after(myIt, myLast);
+	def.pop_front();
+	my.pop_front();
+	std += def.front();
+	ft += my.front();
+	forwardListFillStr(def, my, std, ft);
+	def.resize(30);
+	my.resize(30);
+	forwardListFillStr(def, my, std, ft);
+	def.resize(60, val);
+	my.resize(60, val);
+	forwardListFillStr(def, my, std, ft);
+	std::forward_list<int> defCopy(def);
+	ft::forward_list<int> copy(my);
+	std += (defCopy == def);
+	ft += (copy == my);
+	defCopy.push_front(val);
+	copy.push_front(val);
+	std += (def < defCopy);
+	ft += (my < copy);
+	std += (defCopy >= def);
+	ft += (copy >= my);
+	def.clear();
+	my.clear();
+	forwardListFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void modifiersForwardListTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Insert_after, erase_after and resize float test" << " ";
+	std::forward_list<float> def;
+	ft::forward_list<float> my;
+	forwardListPushElem(def, my, 100);
+	std::vector<float> src(def.begin(), def.end());
+	float val;
+	val = 7;
+	std::forward_list<float>::iterator it = def.before_begin();
+	ft::forward_list<float>::iterator myIt = my.before_begin();
+	std::advance(it, 10);
+	std::advance(myIt, 10);
+	std += *def.insert_after(it, val);
+	ft += *my.insert_after(myIt, val);
+	std += *def.insert_after(it, 5, val);
+	ft += *my.insert_after(myIt, 5, val);
+	std += *def.insert_after(it, src.begin(), src.begin() + 20);
+	ft += *my.insert_after(myIt, src.begin(), src.begin() + 20);
+	std += *def.emplace_after(def.before_begin(), val);
+	ft += *my.emplace_after(my.before_begin(), val);
+	forwardListFillStr(def, my, std, ft);
+	std += *def.erase_after(it);
+	ft += *my.erase_after(myIt);
+	std::forward_list<float>::iterator last = it;
+	ft::forward_list<float>::iterator myLast = myIt;
+	std::advance(last, 15);
+	std::advance(myLast, 15);
+	def.erase_after(it, last);
+	my.erase_after(myIt, myLast);
+	def.pop_front();
+	my.pop_front();
+	std += def.front();
+	ft += my.front();
+	forwardListFillStr(def, my, std, ft);
+	def.resize(30);
+	my.resize(30);
+	forwardListFillStr(def, my, std, ft);
+	def.resize(60, val);
+	my.resize(60, val);
+	forwardListFillStr(def, my, std, ft);
+	std::forward_list<float> defCopy(def);
+	ft::forward_list<float> copy(my);
+	std += (defCopy == def);
+	ft += (copy == my);
+	defCopy.push_front(val);
+	copy.push_front(val);
+	std += (def < defCopy);
+	ft += (my < copy);
+	std += (defCopy >= def);
+	ft += (copy >= my);
+	def.clear();
+	my.clear();
+	forwardListFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void modifiersForwardListTestStr(std::string &std, std::string &ft) {
+	std::cout << "Insert_after, erase_after and resize std::string test" << " ";
+	std::forward_list<std::string> def;
+	ft::forward_list<std::string> my;
+	forwardListPushElem(def, my, 100);
+	std::vector<std::string> src(def.begin(), def.end());
+	std::string val;
+	val = 7;
+	std::forward_list<std::string>::iterator it = def.before_begin();
+	ft::forward_list<std::string>::iterator myIt = my.before_begin();
+	std::advance(it, 10);
+	std::advance(myIt, 10);
+	std += *def.insert_after(it, val);
+	ft += *my.insert_after(myIt, val);
+	std += *def.insert_after(it, 5, val);
+	ft += *my.insert_after(myIt, 5, val);
+	std += *def.insert_after(it, src.begin(), src.begin() + 20);
+	ft += *my.insert_after(myIt, src.begin(), src.begin() + 20);
+	std += *def.emplace_after(def.before_begin(), val);
+	ft += *my.emplace_after(my.before_begin(), val);
+	forwardListFillStr(def, my, std, ft);
+	std += *def.erase_after(it);
+	ft += *my.erase_after(myIt);
+	std::forward_list<std::string>::iterator last = it;
+	ft::forward_list<std::string>::iterator myLast = myIt;
+	std::advance(last, 15);
+	std::advance(myLast, 15);
+	def.erase_after(it, last);
+	my.erase_after(myIt, myLast);
+	def.pop_front();
+	my.pop_front();
+	std += def.front();
+	ft += my.front();
+	forwardListFillStr(def, my, std, ft);
+	def.resize(30);
+	my.resize(30);
+	forwardListFillStr(def, my, std, ft);
+	def.resize(60, val);
+	my.resize(60, val);
+	forwardListFillStr(def, my, std, ft);
+	std::forward_list<std::string> defCopy(def);
+	ft::forward_list<std::string> copy(my);
+	std += (defCopy == def);
+	ft += (copy == my);
+	defCopy.push_front(val);
+	copy.push_front(val);
+	std += (def < defCopy);
+	ft += (my < copy);
+	std += (defCopy >= def);
+	ft += (copy >= my);
+	def.clear();
+	my.clear();
+	forwardListFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2655,11 +3757,39 @@ void defaultCnstTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void defaultCnstTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Default constructor float test" << " ";
-	std::vector<float> def;
-	ft::vector<float> my;
-	VectorFillStr(def, my, std, ft);
+void operationsForwardListTest(std::string &std, std::string &ft) {
+	std::cout << "Remove, unique, reverse, sort and merge int test" << " ";
+	std::forward_list<int> def;
+	ft::forward_list<int> my;
+	std::forward_list<int> defOther;
+	ft::forward_list<int> myOther;
+	forwardListPushElem(def, my, 200);
+	forwardListPushElem(defOther, myOther, 100);
+	int val;
+	val = 3;
+	size_t before = std::distance(def.begin(), def.end());
+	def.remove(val);
+	std += before - std::distance(def.begin(), def.end());
+	ft += my.remove(val);
+	before = std::distance(def.begin(), def.end());
+	def.unique();
+	std += before - std::distance(def.begin(), def.end());
+	ft += my.unique();
+	def.reverse();
+	my.reverse();
+	forwardListFillStr(def, my, std, ft);
+	def.sort();
+	my.sort();
+	forwardListFillStr(def, my, std, ft);
+	defOther.sort(std::greater<int>());
+	myOther.sort(std::greater<int>());
+	forwardListFillStr(defOther, myOther, std, ft);
+	defOther.reverse();
+	myOther.reverse();
+	def.merge(defOther);
+	my.merge(myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2668,11 +3798,39 @@ void defaultCnstTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void defaultCnstTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Default constructor std::string test" << " ";
-	std::vector<std::string> def;
-	ft::vector<std::string> my;
-	VectorFillStr(def, my, std, ft);
+void operationsForwardListTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Remove, unique, reverse, sort and merge float test" << " ";
+	std::forward_list<float> def;
+	ft::forward_list<float> my;
+	std::forward_list<float> defOther;
+	ft::forward_list<float> myOther;
+	forwardListPushElem(def, my, 200);
+	forwardListPushElem(defOther, myOther, 100);
+	float val;
+	val = 3;
+	size_t before = std::distance(def.begin(), def.end());
+	def.remove(val);
+	std += before - std::distance(def.begin(), def.end());
+	ft += my.remove(val);
+	before = std::distance(def.begin(), def.end());
+	def.unique();
+	std += before - std::distance(def.begin(), def.end());
+	ft += my.unique();
+	def.reverse();
+	my.reverse();
+	forwardListFillStr(def, my, std, ft);
+	def.sort();
+	my.sort();
+	forwardListFillStr(def, my, std, ft);
+	defOther.sort(std::greater<float>());
+	myOther.sort(std::greater<float>());
+	forwardListFillStr(defOther, myOther, std, ft);
+	defOther.reverse();
+	myOther.reverse();
+	def.merge(defOther);
+	my.merge(myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2681,13 +3839,99 @@ void defaultCnstTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Fill constructor vector
+void operationsForwardListTestStr(std::string &std, std::string &ft) {
+	std::cout << "Remove, unique, reverse, sort and merge std::string test" << " ";
+	std::forward_list<std::string> def;
+	ft::forward_list<std::string> my;
+	std::forward_list<std::string> defOther;
+	ft::forward_list<std::string> myOther;
+	forwardListPushElem(def, my, 200);
+	forwardListPushElem(defOther, myOther, 100);
+	std::string val;
+	val = 3;
+	size_t before = std::distance(def.begin(), def.end());
+	def.remove(val);
+	std += before - std::distance(def.begin(), def.end());
+	ft += my.remove(val);
+	before = std::distance(def.begin(), def.end());
+	def.unique();
+	std += before - std::distance(def.begin(), def.end());
+	ft += my.unique();
+	def.reverse();
+	my.reverse();
+	forwardListFillStr(def, my, std, ft);
+	def.sort();
+	my.sort();
+	forwardListFillStr(def, my, std, ft);
+	defOther.sort(std::greater<std::string>());
+	myOther.sort(std::greater<std::string>());
+	forwardListFillStr(defOther, myOther, std, ft);
+	defOther.reverse();
+	myOther.reverse();
+	def.merge(defOther);
+	my.merge(myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
 
-void fillCnstTestVector(std::string &std, std::string &ft) {
-	std::cout << "Fill constructor int test" << " ";
-	std::vector<int> def(4, 100);
-	ft::vector<int> my(4, 100);
-	VectorFillStr(def, my, std, ft);
+void removeFrontForwardListTestStr(std::string &std, std::string &ft) {
+	std::cout << "Remove front() std::string test" << " ";
+	std::forward_list<std::string> def;
+	ft::forward_list<std::string> my;
+	forwardListPushElem(def, my, 3);
+	def.push_front(def.front());
+	my.push_front(my.front());
+	size_t before = std::distance(def.begin(), def.end());
+	def.remove(def.front());
+	std += before - std::distance(def.begin(), def.end());
+	ft += my.remove(my.front());
+	forwardListFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void spliceForwardListTest(std::string &std, std::string &ft) {
+	std::cout << "Splice_after int test" << " ";
+	std::forward_list<int> def;
+	ft::forward_list<int> my;
+	std::forward_list<int> defOther;
+	ft::forward_list<int> myOther;
+	forwardListPushElem(def, my, 100);
+	forwardListPushElem(defOther, myOther, 50);
+	std::forward_list<int>::iterator it = def.begin();
+	ft::forward_list<int>::iterator myIt = my.begin();
+	std::advance(it, 30);
+	std::advance(myIt, 30);
+	def.splice_after(it, defOther);
+	my.splice_after(myIt, myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	defOther.splice_after(defOther.before_begin(), def, it);
+	myOther.splice_after(myOther.before_begin(), my, myIt);
+	std::forward_list<int>::iterator last = def.begin();
+	ft::forward_list<int>::iterator myLast = my.begin();
+	std::advance(last, 70);
+	std::advance(myLast, 70);
+	defOther.splice_after(defOther.begin(), def, def.begin(), last);
+	myOther.splice_after(myOther.begin(), my, my.begin(), myLast);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	def.splice_after(def.before_begin(), def, it);
+	my.splice_after(my.before_begin(), my, myIt);
+	def.swap(defOther);
+	my.swap(myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2696,26 +3940,176 @@ void fillCnstTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void fillCnstTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Fill constructor float test" << " ";
-	std::vector<float> def(4, 100.42);
-	ft::vector<float> my(4, 100.42);
-	VectorFillStr(def, my, std, ft);
+void spliceForwardListTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Splice_after float test" << " ";
+	std::forward_list<float> def;
+	ft::forward_list<float> my;
+	std::forward_list<float> defOther;
+	ft::forward_list<float> myOther;
+	forwardListPushElem(def, my, 100);
+	forwardListPushElem(defOther, myOther, 50);
+	std::forward_list<float>::iterator it = def.begin();
+	ft::forward_list<float>::iterator myIt = my.begin();
+	std::advance(it, 30);
+	std::advance(myIt, 30);
+	def.splice_after(it, defOther);
+	my.splice_after(myIt, myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	defOther.splice_after(defOther.before_begin(), def, it);
+	myOther.splice_after(myOther.before_begin(), my, myIt);
+	std::forward_list<float>::iterator last = def.begin();
+	ft::forward_list<float>::iterator myLast = my.begin();
+	std::advance(last, 70);
+	std::advance(myLast, 70);
+	defOther.splice_after(defOther.begin(), def, def.begin(), last);
+	myOther.splice_after(myOther.begin(), my, my.begin(), myLast);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	def.splice_after(def.before_begin(), def, it);
+	my.splice_after(my.before_begin(), my, myIt);
+	def.swap(defOther);
+	my.swap(myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
 		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
 	std.clear();
-	ft.clear();
+	ft.clear();
+}
+
+void spliceForwardListTestStr(std::string &std, std::string &ft) {
+	std::cout << "Splice_after std::string test" << " ";
+	std::forward_list<std::string> def;
+	ft::forward_list<std::string> my;
+	std::forward_list<std::string> defOther;
+	ft::forward_list<std::string> myOther;
+	forwardListPushElem(def, my, 100);
+	forwardListPushElem(defOther, myOther, 50);
+	std::forward_list<std::string>::iterator it = def.begin();
+	ft::forward_list<std::string>::iterator myIt = my.begin();
+	std::advance(it, 30);
+	std::advance(myIt, 30);
+	def.splice_after(it, defOther);
+	my.splice_after(myIt, myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	defOther.splice_after(defOther.before_begin(), def, it);
+	myOther.splice_after(myOther.before_begin(), my, myIt);
+	std::forward_list<std::string>::iterator last = def.begin();
+	ft::forward_list<std::string>::iterator myLast = my.begin();
+	std::advance(last, 70);
+	std::advance(myLast, 70);
+	defOther.splice_after(defOther.begin(), def, def.begin(), last);
+	myOther.splice_after(myOther.begin(), my, my.begin(), myLast);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	def.splice_after(def.before_begin(), def, it);
+	my.splice_after(my.before_begin(), my, myIt);
+	def.swap(defOther);
+	my.swap(myOther);
+	forwardListFillStr(def, my, std, ft);
+	forwardListFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void testForwardList() {
+	std::string std;
+	std::string ft;
+	std::cout << "                            MODIFIERS" << std::endl;
+	modifiersForwardListTest(std, ft);
+	modifiersForwardListTestFloat(std, ft);
+	modifiersForwardListTestStr(std, ft);
+	std::cout << "                            OPERATIONS" << std::endl;
+	operationsForwardListTest(std, ft);
+	operationsForwardListTestFloat(std, ft);
+	operationsForwardListTestStr(std, ft);
+	removeFrontForwardListTestStr(std, ft);
+	spliceForwardListTest(std, ft);
+	spliceForwardListTestFloat(std, ft);
+	spliceForwardListTestStr(std, ft);
 }
 
-void fillCnstTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Fill constructor std::string test" << " ";
-	std::string set;
-	set += "100";
-	std::vector<std::string> def(4, set);
-	ft::vector<std::string> my(4, set);
-	VectorFillStr(def, my, std, ft);
+//MARK: - Unrolled list
+
+void modifiersUnrolledTest(std::string &std, std::string &ft) {
+	std::cout << "Insert, erase and resize int test" << " ";
+	std::list<int> def;
+	ft::unrolled_list<int, 4> my;
+	unrolledPushElem(def, my, 100);
+	std::vector<int> src(def.begin(), def.end());
+	int val;
+	val = 7;
+	for (int i = 0; i < 10; i++) {
+		def.push_front(val);
+		my.push_front(val);
+	}
+	std::list<int>::iterator it = def.begin();
+	ft::unrolled_list<int, 4>::iterator myIt = my.begin();
+	std::advance(it, 25);
+	std::advance(myIt, 25);
+	std += *def.insert(it, val);
+	ft += *my.insert(myIt, val);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 41);
+	std::advance(myIt, 41);
+	def.insert(it, 9, val);
+	my.insert(myIt, 9, val);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 3);
+	std::advance(myIt, 3);
+	def.insert(it, src.begin(), src.begin() + 30);
+	my.insert(myIt, src.begin(), src.begin() + 30);
+	unrolledFillStr(def, my, std, ft);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 60);
+	std::advance(myIt, 60);
+	std += *def.erase(it);
+	ft += *my.erase(myIt);
+	std::list<int>::iterator first = def.begin();
+	ft::unrolled_list<int, 4>::iterator myFirst = my.begin();
+	std::advance(first, 10);
+	std::advance(myFirst, 10);
+	std::list<int>::iterator last = first;
+	ft::unrolled_list<int, 4>::iterator myLast = myFirst;
+	std::advance(last, 45);
+	std::advance(myLast, 45);
+	std += *def.erase(first, last);
+	ft += *my.erase(myFirst, myLast);
+	def.pop_front();
+	my.pop_front();
+	def.pop_back();
+	my.pop_back();
+	std += def.front();
+	ft += my.front();
+	std += def.back();
+	ft += my.back();
+	unrolledFillStr(def, my, std, ft);
+	def.resize(20);
+	my.resize(20);
+	unrolledFillStr(def, my, std, ft);
+	def.resize(50, val);
+	my.resize(50, val);
+	unrolledFillStr(def, my, std, ft);
+	ft::unrolled_list<int, 4> copy(my);
+	std += true;
+	ft += (copy == my);
+	copy.push_back(val);
+	std += true;
+	ft += (my < copy);
+	def.clear();
+	my.clear();
+	unrolledFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2724,16 +4118,77 @@ void fillCnstTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Range constructor vector
-
-void rangeCnstTestVector(std::string &std, std::string &ft) {
-	std::cout << "Range constructor int test" << " ";
-	std::vector<int> test;
-	for (int i = 0; i < 10; i++)
-		test.push_back(i);
-	std::vector<int> def(++test.begin(), --(--test.end()));
-	ft::vector<int> my(++test.begin(), --(--test.end()));
-	VectorFillStr(def, my, std, ft);
+void modifiersUnrolledTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Insert, erase and resize float test" << " ";
+	std::list<float> def;
+	ft::unrolled_list<float, 4> my;
+	unrolledPushElem(def, my, 100);
+	std::vector<float> src(def.begin(), def.end());
+	float val;
+	val = 7;
+	for (int i = 0; i < 10; i++) {
+		def.push_front(val);
+		my.push_front(val);
+	}
+	std::list<float>::iterator it = def.begin();
+	ft::unrolled_list<float, 4>::iterator myIt = my.begin();
+	std::advance(it, 25);
+	std::advance(myIt, 25);
+	std += *def.insert(it, val);
+	ft += *my.insert(myIt, val);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 41);
+	std::advance(myIt, 41);
+	def.insert(it, 9, val);
+	my.insert(myIt, 9, val);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 3);
+	std::advance(myIt, 3);
+	def.insert(it, src.begin(), src.begin() + 30);
+	my.insert(myIt, src.begin(), src.begin() + 30);
+	unrolledFillStr(def, my, std, ft);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 60);
+	std::advance(myIt, 60);
+	std += *def.erase(it);
+	ft += *my.erase(myIt);
+	std::list<float>::iterator first = def.begin();
+	ft::unrolled_list<float, 4>::iterator myFirst = my.begin();
+	std::advance(first, 10);
+	std::advance(myFirst, 10);
+	std::list<float>::iterator last = first;
+	ft::unrolled_list<float, 4>::iterator myLast = myFirst;
+	std::advance(last, 45);
+	std::advance(myLast, 45);
+	std += *def.erase(first, last);
+	ft += *my.erase(myFirst, myLast);
+	def.pop_front();
+	my.pop_front();
+	def.pop_back();
+	my.pop_back();
+	std += def.front();
+	ft += my.front();
+	std += def.back();
+	ft += my.back();
+	unrolledFillStr(def, my, std, ft);
+	def.resize(20);
+	my.resize(20);
+	unrolledFillStr(def, my, std, ft);
+	def.resize(50, val);
+	my.resize(50, val);
+	unrolledFillStr(def, my, std, ft);
+	ft::unrolled_list<float, 4> copy(my);
+	std += true;
+	ft += (copy == my);
+	copy.push_back(val);
+	std += true;
+	ft += (my < copy);
+	def.clear();
+	my.clear();
+	unrolledFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2742,14 +4197,77 @@ void rangeCnstTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeCnstTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Range constructor float test" << " ";
-	std::vector<float> test;
-	for (int i = 0; i < 10; i++)
-		test.push_back(i + 0.42);
-	std::vector<float> def(++test.begin(), --(--test.end()));
-	ft::vector<float> my(++test.begin(), --(--test.end()));
-	VectorFillStr(def, my, std, ft);
+void modifiersUnrolledTestStr(std::string &std, std::string &ft) {
+	std::cout << "Insert, erase and resize std::string test" << " ";
+	std::list<std::string> def;
+	ft::unrolled_list<std::string, 4> my;
+	unrolledPushElem(def, my, 100);
+	std::vector<std::string> src(def.begin(), def.end());
+	std::string val;
+	val = 7;
+	for (int i = 0; i < 10; i++) {
+		def.push_front(val);
+		my.push_front(val);
+	}
+	std::list<std::string>::iterator it = def.begin();
+	ft::unrolled_list<std::string, 4>::iterator myIt = my.begin();
+	std::advance(it, 25);
+	std::advance(myIt, 25);
+	std += *def.insert(it, val);
+	ft += *my.insert(myIt, val);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 41);
+	std::advance(myIt, 41);
+	def.insert(it, 9, val);
+	my.insert(myIt, 9, val);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 3);
+	std::advance(myIt, 3);
+	def.insert(it, src.begin(), src.begin() + 30);
+	my.insert(myIt, src.begin(), src.begin() + 30);
+	unrolledFillStr(def, my, std, ft);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 60);
+	std::advance(myIt, 60);
+	std += *def.erase(it);
+	ft += *my.erase(myIt);
+	std::list<std::string>::iterator first = def.begin();
+	ft::unrolled_list<std::string, 4>::iterator myFirst = my.begin();
+	std::advance(first, 10);
+	std::advance(myFirst, 10);
+	std::list<std::string>::iterator last = first;
+	ft::unrolled_list<std::string, 4>::iterator myLast = myFirst;
+	std::advance(last, 45);
+	std::advance(myLast, 45);
+	std += *def.erase(first, last);
+	ft += *my.erase(myFirst, myLast);
+	def.pop_front();
+	my.pop_front();
+	def.pop_back();
+	my.pop_back();
+	std += def.front();
+	ft += my.front();
+	std += def.back();
+	ft += my.back();
+	unrolledFillStr(def, my, std, ft);
+	def.resize(20);
+	my.resize(20);
+	unrolledFillStr(def, my, std, ft);
+	def.resize(50, val);
+	my.resize(50, val);
+	unrolledFillStr(def, my, std, ft);
+	ft::unrolled_list<std::string, 4> copy(my);
+	std += true;
+	ft += (copy == my);
+	copy.push_back(val);
+	std += true;
+	ft += (my < copy);
+	def.clear();
+	my.clear();
+	unrolledFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2758,18 +4276,39 @@ void rangeCnstTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeCnstTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Range constructor std::string test" << " ";
-	std::vector<std::string> test;
-	std::string chr;
-	for (int i = 0; i < 10; i++) {
-		chr += i;
-		test.push_back(chr);
-		chr.clear();
-	}
-	std::vector<std::string> def(++test.begin(), test.end());
-	ft::vector<std::string> my(++test.begin(), test.end());
-	VectorFillStr(def, my, std, ft);
+void operationsUnrolledTest(std::string &std, std::string &ft) {
+	std::cout << "Remove_if, unique, reverse, sort and merge int test" << " ";
+	std::list<int> def;
+	ft::unrolled_list<int, 4> my;
+	std::list<int> defOther;
+	ft::unrolled_list<int, 4> myOther;
+	unrolledPushElem(def, my, 300);
+	unrolledPushElem(defOther, myOther, 100);
+	int val;
+	val = 3;
+	size_t before = def.size();
+	def.remove(val);
+	std += before - def.size();
+	ft += my.remove(val);
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	unrolledFillStr(def, my, std, ft);
+	def.reverse();
+	my.reverse();
+	unrolledFillStr(def, my, std, ft);
+	def.sort();
+	my.sort();
+	defOther.sort();
+	myOther.sort();
+	def.merge(defOther);
+	my.merge(myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	def.sort(std::greater<int>());
+	my.sort(std::greater<int>());
+	unrolledFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2778,19 +4317,39 @@ void rangeCnstTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Copy constructor vector
-
-void copyCnstTestVector(std::string &std, std::string &ft) {
-	std::cout << "Copy constructor int test" << " ";
-	std::vector<int> test;
-	ft::vector<int> test1;
-	for (int i = 0; i < 10; i++) {
-		test.push_back(i);
-		test1.push_back(i);
-	}
-	std::vector<int> def(test);
-	ft::vector<int> my(test1);
-	VectorFillStr(def, my, std, ft);
+void operationsUnrolledTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Remove_if, unique, reverse, sort and merge float test" << " ";
+	std::list<float> def;
+	ft::unrolled_list<float, 4> my;
+	std::list<float> defOther;
+	ft::unrolled_list<float, 4> myOther;
+	unrolledPushElem(def, my, 300);
+	unrolledPushElem(defOther, myOther, 100);
+	float val;
+	val = 3;
+	size_t before = def.size();
+	def.remove(val);
+	std += before - def.size();
+	ft += my.remove(val);
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	unrolledFillStr(def, my, std, ft);
+	def.reverse();
+	my.reverse();
+	unrolledFillStr(def, my, std, ft);
+	def.sort();
+	my.sort();
+	defOther.sort();
+	myOther.sort();
+	def.merge(defOther);
+	my.merge(myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	def.sort(std::greater<float>());
+	my.sort(std::greater<float>());
+	unrolledFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2799,17 +4358,39 @@ void copyCnstTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void copyCnstTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Copy constructor float test" << " ";
-	std::vector<float> test;
-	ft::vector<float> test1;
-	for (int i = 0; i < 10; i++) {
-		test.push_back(i + 0.42);
-		test1.push_back(i + 0.42);
-	}
-	std::vector<float> def(test);
-	ft::vector<float> my(test1);
-	VectorFillStr(def, my, std, ft);
+void operationsUnrolledTestStr(std::string &std, std::string &ft) {
+	std::cout << "Remove_if, unique, reverse, sort and merge std::string test" << " ";
+	std::list<std::string> def;
+	ft::unrolled_list<std::string, 4> my;
+	std::list<std::string> defOther;
+	ft::unrolled_list<std::string, 4> myOther;
+	unrolledPushElem(def, my, 300);
+	unrolledPushElem(defOther, myOther, 100);
+	std::string val;
+	val = 3;
+	size_t before = def.size();
+	def.remove(val);
+	std += before - def.size();
+	ft += my.remove(val);
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	unrolledFillStr(def, my, std, ft);
+	def.reverse();
+	my.reverse();
+	unrolledFillStr(def, my, std, ft);
+	def.sort();
+	my.sort();
+	defOther.sort();
+	myOther.sort();
+	def.merge(defOther);
+	my.merge(myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	def.sort(std::greater<std::string>());
+	my.sort(std::greater<std::string>());
+	unrolledFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2818,20 +4399,18 @@ void copyCnstTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void copyCnstTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Copy constructor std::string test" << " ";
-	std::vector<std::string> test;
-	ft::vector<std::string> test1;
-	std::string chr;
-	for (int i = 0; i < 10; i++) {
-		chr += rand();
-		test.push_back(chr);
-		test1.push_back(chr);
-		chr.clear();
-	}
-	std::vector<std::string> def(test);
-	ft::vector<std::string> my(test1);
-	VectorFillStr(def, my, std, ft);
+void removeFrontUnrolledTestStr(std::string &std, std::string &ft) {
+	std::cout << "Remove front() std::string test" << " ";
+	std::list<std::string> def;
+	ft::unrolled_list<std::string, 4> my;
+	unrolledPushElem(def, my, 9);
+	def.push_back(def.front());
+	my.push_back(my.front());
+	size_t before = def.size();
+	def.remove(def.front());
+	std += before - def.size();
+	ft += my.remove(my.front());
+	unrolledFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2840,21 +4419,230 @@ void copyCnstTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Assignation vector
+void spliceUnrolledTest(std::string &std, std::string &ft) {
+	std::cout << "Splice int test" << " ";
+	std::list<int> def;
+	ft::unrolled_list<int, 4> my;
+	std::list<int> defOther;
+	ft::unrolled_list<int, 4> myOther;
+	unrolledPushElem(def, my, 100);
+	unrolledPushElem(defOther, myOther, 50);
+	std::list<int>::iterator it = def.begin();
+	ft::unrolled_list<int, 4>::iterator myIt = my.begin();
+	std::advance(it, 31);
+	std::advance(myIt, 31);
+	def.splice(it, defOther);
+	my.splice(myIt, myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 17);
+	std::advance(myIt, 17);
+	defOther.splice(defOther.begin(), def, it);
+	myOther.splice(myOther.begin(), my, myIt);
+	std::list<int>::iterator first = def.begin();
+	ft::unrolled_list<int, 4>::iterator myFirst = my.begin();
+	std::list<int>::iterator last = def.begin();
+	ft::unrolled_list<int, 4>::iterator myLast = my.begin();
+	std::advance(first, 5);
+	std::advance(myFirst, 5);
+	std::advance(last, 70);
+	std::advance(myLast, 70);
+	defOther.splice(defOther.end(), def, first, last);
+	myOther.splice(myOther.end(), my, myFirst, myLast);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	first = defOther.begin();
+	myFirst = myOther.begin();
+	last = defOther.begin();
+	myLast = myOther.begin();
+	std::advance(first, 2);
+	std::advance(myFirst, 2);
+	std::advance(last, 30);
+	std::advance(myLast, 30);
+	defOther.splice(defOther.end(), defOther, first, last);
+	myOther.splice(myOther.end(), myOther, myFirst, myLast);
+	def.swap(defOther);
+	my.swap(myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void spliceUnrolledTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Splice float test" << " ";
+	std::list<float> def;
+	ft::unrolled_list<float, 4> my;
+	std::list<float> defOther;
+	ft::unrolled_list<float, 4> myOther;
+	unrolledPushElem(def, my, 100);
+	unrolledPushElem(defOther, myOther, 50);
+	std::list<float>::iterator it = def.begin();
+	ft::unrolled_list<float, 4>::iterator myIt = my.begin();
+	std::advance(it, 31);
+	std::advance(myIt, 31);
+	def.splice(it, defOther);
+	my.splice(myIt, myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 17);
+	std::advance(myIt, 17);
+	defOther.splice(defOther.begin(), def, it);
+	myOther.splice(myOther.begin(), my, myIt);
+	std::list<float>::iterator first = def.begin();
+	ft::unrolled_list<float, 4>::iterator myFirst = my.begin();
+	std::list<float>::iterator last = def.begin();
+	ft::unrolled_list<float, 4>::iterator myLast = my.begin();
+	std::advance(first, 5);
+	std::advance(myFirst, 5);
+	std::advance(last, 70);
+	std::advance(myLast, 70);
+	defOther.splice(defOther.end(), def, first, last);
+	myOther.splice(myOther.end(), my, myFirst, myLast);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	first = defOther.begin();
+	myFirst = myOther.begin();
+	last = defOther.begin();
+	myLast = myOther.begin();
+	std::advance(first, 2);
+	std::advance(myFirst, 2);
+	std::advance(last, 30);
+	std::advance(myLast, 30);
+	defOther.splice(defOther.end(), defOther, first, last);
+	myOther.splice(myOther.end(), myOther, myFirst, myLast);
+	def.swap(defOther);
+	my.swap(myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void spliceUnrolledTestStr(std::string &std, std::string &ft) {
+	std::cout << "Splice std::string test" << " ";
+	std::list<std::string> def;
+	ft::unrolled_list<std::string, 4> my;
+	std::list<std::string> defOther;
+	ft::unrolled_list<std::string, 4> myOther;
+	unrolledPushElem(def, my, 100);
+	unrolledPushElem(defOther, myOther, 50);
+	std::list<std::string>::iterator it = def.begin();
+	ft::unrolled_list<std::string, 4>::iterator myIt = my.begin();
+	std::advance(it, 31);
+	std::advance(myIt, 31);
+	def.splice(it, defOther);
+	my.splice(myIt, myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	it = def.begin();
+	myIt = my.begin();
+	std::advance(it, 17);
+	std::advance(myIt, 17);
+	defOther.splice(defOther.begin(), def, it);
+	myOther.splice(myOther.begin(), my, myIt);
+	std::list<std::string>::iterator first = def.begin();
+	ft::unrolled_list<std::string, 4>::iterator myFirst = my.begin();
+	std::list<std::string>::iterator last = def.begin();
+	ft::unrolled_list<std::string, 4>::iterator myLast = my.begin();
+	std::advance(first, 5);
+	std::advance(myFirst, 5);
+	std::advance(last, 70);
+	std::advance(myLast, 70);
+	defOther.splice(defOther.end(), def, first, last);
+	myOther.splice(myOther.end(), my, myFirst, myLast);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	first = defOther.begin();
+	myFirst = myOther.begin();
+	last = defOther.begin();
+	myLast = myOther.begin();
+	std::advance(first, 2);
+	std::advance(myFirst, 2);
+	std::advance(last, 30);
+	std::advance(myLast, 30);
+	defOther.splice(defOther.end(), defOther, first, last);
+	myOther.splice(myOther.end(), myOther, myFirst, myLast);
+	def.swap(defOther);
+	my.swap(myOther);
+	unrolledFillStr(def, my, std, ft);
+	unrolledFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void testUnrolledList() {
+	std::string std;
+	std::string ft;
+	std::cout << "                            MODIFIERS" << std::endl;
+	modifiersUnrolledTest(std, ft);
+	modifiersUnrolledTestFloat(std, ft);
+	modifiersUnrolledTestStr(std, ft);
+	std::cout << "                            OPERATIONS" << std::endl;
+	operationsUnrolledTest(std, ft);
+	operationsUnrolledTestFloat(std, ft);
+	operationsUnrolledTestStr(std, ft);
+	removeFrontUnrolledTestStr(std, ft);
+	spliceUnrolledTest(std, ft);
+	spliceUnrolledTestFloat(std, ft);
+	spliceUnrolledTestStr(std, ft);
+}
 
-void assignTestVector(std::string &std, std::string &ft) {
-	std::cout << "Assign int test" << " ";
-	std::vector<int> def;
-	std::vector<int> toAssign;
-	ft::vector<int> my;
-	ft::vector<int> myAssign;
-	for (int i = 0; i < 10; i++) {
-		toAssign.push_back(i);
-		myAssign.push_back(i);
-	}
-	def = toAssign;
-	my = myAssign;
-	VectorFillStr(def, my, std, ft);
+//MARK: - Intrusive list
+
+void modifiersIntrusiveTest(std::string &std, std::string &ft) {
+	std::cout << "Push, insert and erase int test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<int>, &IntrusiveElem<int>::hook> List;
+	std::vector<IntrusiveElem<int> > storage;
+	std::list<int> def;
+	List my;
+	intrusivePushBackElem(def, my, storage, 100);
+	IntrusiveElem<int> front;
+	IntrusiveElem<int> middle;
+	front.value = 7;
+	middle.value = 8;
+	def.push_front(front.value);
+	my.push_front(front);
+	std::list<int>::iterator it = def.begin();
+	std::advance(it, 50);
+	def.insert(it, middle.value);
+	my.insert(List::iterator_to(storage[49]), middle);
+	it = def.begin();
+	std::advance(it, 11);
+	def.erase(it);
+	my.erase(storage[10]);
+	std += storage[10].hook.is_linked();
+	ft += storage[10].hook.is_linked();
+	def.pop_back();
+	my.pop_back();
+	def.pop_front();
+	my.pop_front();
+	std += front.hook.is_linked();
+	ft += front.hook.is_linked();
+	std += def.front();
+	ft += my.front().value;
+	std += def.back();
+	ft += my.back().value;
+	intrusiveFillStr(def, my, std, ft);
+	my.clear();
+	def.clear();
+	intrusiveFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2863,19 +4651,43 @@ void assignTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Assign float test" << " ";
-	std::vector<float> def;
-	std::vector<float> toAssign;
-	ft::vector<float> my;
-	ft::vector<float> myAssign;
-	for (int i = 0; i < 10; i++) {
-		toAssign.push_back(i + 0.42);
-		myAssign.push_back(i + 0.42);
-	}
-	def = toAssign;
-	my = myAssign;
-	VectorFillStr(def, my, std, ft);
+void modifiersIntrusiveTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Push, insert and erase float test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<float>, &IntrusiveElem<float>::hook> List;
+	std::vector<IntrusiveElem<float> > storage;
+	std::list<float> def;
+	List my;
+	intrusivePushBackElem(def, my, storage, 100);
+	IntrusiveElem<float> front;
+	IntrusiveElem<float> middle;
+	front.value = 7;
+	middle.value = 8;
+	def.push_front(front.value);
+	my.push_front(front);
+	std::list<float>::iterator it = def.begin();
+	std::advance(it, 50);
+	def.insert(it, middle.value);
+	my.insert(List::iterator_to(storage[49]), middle);
+	it = def.begin();
+	std::advance(it, 11);
+	def.erase(it);
+	my.erase(storage[10]);
+	std += storage[10].hook.is_linked();
+	ft += storage[10].hook.is_linked();
+	def.pop_back();
+	my.pop_back();
+	def.pop_front();
+	my.pop_front();
+	std += front.hook.is_linked();
+	ft += front.hook.is_linked();
+	std += def.front();
+	ft += my.front().value;
+	std += def.back();
+	ft += my.back().value;
+	intrusiveFillStr(def, my, std, ft);
+	my.clear();
+	def.clear();
+	intrusiveFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2884,22 +4696,43 @@ void assignTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Assign std::string test" << " ";
-	std::vector<std::string> def;
-	std::vector<std::string> toAssign;
-	ft::vector<std::string> my;
-	ft::vector<std::string> myAssign;
-	std::string chr;
-	for (int i = 0; i < 10; i++) {
-		chr += rand();
-		toAssign.push_back(chr);
-		myAssign.push_back(chr);
-		chr.clear();
-	}
-	def = toAssign;
-	my = myAssign;
-	VectorFillStr(def, my, std, ft);
+void modifiersIntrusiveTestStr(std::string &std, std::string &ft) {
+	std::cout << "Push, insert and erase std::string test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<std::string>, &IntrusiveElem<std::string>::hook> List;
+	std::vector<IntrusiveElem<std::string> > storage;
+	std::list<std::string> def;
+	List my;
+	intrusivePushBackElem(def, my, storage, 100);
+	IntrusiveElem<std::string> front;
+	IntrusiveElem<std::string> middle;
+	front.value = 7;
+	middle.value = 8;
+	def.push_front(front.value);
+	my.push_front(front);
+	std::list<std::string>::iterator it = def.begin();
+	std::advance(it, 50);
+	def.insert(it, middle.value);
+	my.insert(List::iterator_to(storage[49]), middle);
+	it = def.begin();
+	std::advance(it, 11);
+	def.erase(it);
+	my.erase(storage[10]);
+	std += storage[10].hook.is_linked();
+	ft += storage[10].hook.is_linked();
+	def.pop_back();
+	my.pop_back();
+	def.pop_front();
+	my.pop_front();
+	std += front.hook.is_linked();
+	ft += front.hook.is_linked();
+	std += def.front();
+	ft += my.front().value;
+	std += def.back();
+	ft += my.back().value;
+	intrusiveFillStr(def, my, std, ft);
+	my.clear();
+	def.clear();
+	intrusiveFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2908,40 +4741,58 @@ void assignTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Iterator vector
+void operationsIntrusiveTest(std::string &std, std::string &ft) {
+	std::cout << "Remove_if, unique and reverse int test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<int>, &IntrusiveElem<int>::hook> List;
+	std::vector<IntrusiveElem<int> > storage;
+	std::list<int> def;
+	List my;
+	intrusivePushBackElem(def, my, storage, 200);
+	int val;
+	val = 3;
+	size_t before = def.size();
+	def.remove(val);
+	std += before - def.size();
+	IntrusiveElem<int> toRemove;
+	toRemove.value = val;
+	ft += my.remove(toRemove);
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	def.reverse();
+	my.reverse();
+	intrusiveFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
 
-void iteratorTestVector(std::string &std, std::string &ft, int number) {
-	std::vector<int> testStd;
-	ft::vector<int> testFt;
-	std::cout << "All iterator test" << " ";
-	for (int l = 0; l < number; l++) {
-		testStd.push_back(l);
-		testFt.push_back(l);
-	}
-	std::vector<int>::iterator it = testStd.begin();
-	std::vector<int>::iterator ite = testStd.end();
-	ft::vector<int>::iterator itm = testFt.begin();
-	ft::vector<int>::iterator item = testFt.end();
-	while (it != ite) {
-		std += *it;
-		it++;
-	}
-	while (itm != item) {
-		ft += *itm;
-		itm++;
-	}
-	it = testStd.begin();
-	itm = testFt.begin();
-	ite--;
-	item--;
-	while (ite != it) {
-		std += *ite;
-		ite--;
-	}
-	while (item != itm) {
-		ft += *item;
-		item--;
-	}
+void operationsIntrusiveTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Remove_if, unique and reverse float test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<float>, &IntrusiveElem<float>::hook> List;
+	std::vector<IntrusiveElem<float> > storage;
+	std::list<float> def;
+	List my;
+	intrusivePushBackElem(def, my, storage, 200);
+	float val;
+	val = 3;
+	size_t before = def.size();
+	def.remove(val);
+	std += before - def.size();
+	IntrusiveElem<float> toRemove;
+	toRemove.value = val;
+	ft += my.remove(toRemove);
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	def.reverse();
+	my.reverse();
+	intrusiveFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2950,40 +4801,71 @@ void iteratorTestVector(std::string &std, std::string &ft, int number) {
 	ft.clear();
 }
 
-//MARK: - Const iterator vector
+void operationsIntrusiveTestStr(std::string &std, std::string &ft) {
+	std::cout << "Remove_if, unique and reverse std::string test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<std::string>, &IntrusiveElem<std::string>::hook> List;
+	std::vector<IntrusiveElem<std::string> > storage;
+	std::list<std::string> def;
+	List my;
+	intrusivePushBackElem(def, my, storage, 200);
+	std::string val;
+	val = 3;
+	size_t before = def.size();
+	def.remove(val);
+	std += before - def.size();
+	IntrusiveElem<std::string> toRemove;
+	toRemove.value = val;
+	ft += my.remove(toRemove);
+	before = def.size();
+	def.unique();
+	std += before - def.size();
+	ft += my.unique();
+	def.reverse();
+	my.reverse();
+	intrusiveFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
 
-void constIteratorTestVector(std::string &std, std::string &ft, int number) {
-	std::vector<int> testStd;
-	ft::vector<int> testFt;
-	std::cout << "All const_iterator test" << " ";
-	for (int l = 0; l < number; l++) {
-		testStd.push_back(l);
-		testFt.push_back(l);
-	}
-	std::vector<int>::const_iterator it = testStd.cbegin();
-	std::vector<int>::const_iterator ite = testStd.cend();
-	ft::vector<int>::const_iterator itm = testFt.cbegin();
-	ft::vector<int>::const_iterator item = testFt.cend();
-	while (it != ite) {
-		std += *it;
-		it++;
-	}
-	while (itm != item) {
-		ft += *itm;
-		itm++;
-	}
-	it = testStd.cbegin();
-	itm = testFt.cbegin();
-	ite--;
-	item--;
-	while (ite != it) {
-		std += *ite;
-		ite--;
-	}
-	while (item != itm) {
-		ft += *item;
-		item--;
-	}
+void sortIntrusiveTest(std::string &std, std::string &ft) {
+	std::cout << "Sort, merge and splice int test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<int>, &IntrusiveElem<int>::hook> List;
+	std::vector<IntrusiveElem<int> > storage;
+	std::vector<IntrusiveElem<int> > storageOther;
+	std::list<int> def;
+	std::list<int> defOther;
+	List my;
+	List myOther;
+	intrusivePushBackElem(def, my, storage, 200);
+	intrusivePushBackElem(defOther, myOther, storageOther, 100);
+	def.sort();
+	my.sort();
+	defOther.sort();
+	myOther.sort();
+	def.merge(defOther);
+	my.merge(myOther);
+	intrusiveFillStr(def, my, std, ft);
+	intrusiveFillStr(defOther, myOther, std, ft);
+	std::list<int>::iterator first = def.begin();
+	std::list<int>::iterator last = def.begin();
+	List::iterator myFirst = my.begin();
+	List::iterator myLast = my.begin();
+	std::advance(first, 20);
+	std::advance(last, 120);
+	std::advance(myFirst, 20);
+	std::advance(myLast, 120);
+	defOther.splice(defOther.end(), def, first, last);
+	myOther.splice(myOther.end(), my, myFirst, myLast);
+	defOther.splice(defOther.begin(), def, def.begin());
+	myOther.splice(myOther.begin(), my, my.begin());
+	def.splice(def.begin(), defOther);
+	my.splice(my.begin(), myOther);
+	intrusiveFillStr(def, my, std, ft);
+	intrusiveFillStr(defOther, myOther, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -2992,42 +4874,41 @@ void constIteratorTestVector(std::string &std, std::string &ft, int number) {
 	ft.clear();
 }
 
-//MARK: - Reverse iterator vector
-
-void reverseIteratorTestVector(std::string &std, std::string &ft, int number) {
-	std::vector<int> testStd;
-	ft::vector<int> testFt;
-	std::cout << "All reverse_iterator test" << " ";
-	for (int l = 0; l < number; l++) {
-		testStd.push_back(l);
-		testFt.push_back(l);
-	}
-	std::vector<int>::reverse_iterator it = testStd.rbegin();
-	std::vector<int>::reverse_iterator ite = testStd.rend();
-	ft::vector<int>::reverse_iterator itm = testFt.rbegin();
-	ft::vector<int>::reverse_iterator item = testFt.rend();
-	it++;
-	itm++;
-	while (it != ite) {
-		std += *it;
-		it++;
-	}
-	while (itm != item) {
-		ft += *itm;
-		itm++;
-	}
-	it = testStd.rbegin();
-	itm = testFt.rbegin();
-	ite--;
-	item--;
-	while (ite != it) {
-		std += *ite;
-		ite--;
-	}
-	while (item != itm) {
-		ft += *item;
-		item--;
-	}
+void sortIntrusiveTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Sort, merge and splice float test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<float>, &IntrusiveElem<float>::hook> List;
+	std::vector<IntrusiveElem<float> > storage;
+	std::vector<IntrusiveElem<float> > storageOther;
+	std::list<float> def;
+	std::list<float> defOther;
+	List my;
+	List myOther;
+	intrusivePushBackElem(def, my, storage, 200);
+	intrusivePushBackElem(defOther, myOther, storageOther, 100);
+	def.sort();
+	my.sort();
+	defOther.sort();
+	myOther.sort();
+	def.merge(defOther);
+	my.merge(myOther);
+	intrusiveFillStr(def, my, std, ft);
+	intrusiveFillStr(defOther, myOther, std, ft);
+	std::list<float>::iterator first = def.begin();
+	std::list<float>::iterator last = def.begin();
+	List::iterator myFirst = my.begin();
+	List::iterator myLast = my.begin();
+	std::advance(first, 20);
+	std::advance(last, 120);
+	std::advance(myFirst, 20);
+	std::advance(myLast, 120);
+	defOther.splice(defOther.end(), def, first, last);
+	myOther.splice(myOther.end(), my, myFirst, myLast);
+	defOther.splice(defOther.begin(), def, def.begin());
+	myOther.splice(myOther.begin(), my, my.begin());
+	def.splice(def.begin(), defOther);
+	my.splice(my.begin(), myOther);
+	intrusiveFillStr(def, my, std, ft);
+	intrusiveFillStr(defOther, myOther, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3036,42 +4917,41 @@ void reverseIteratorTestVector(std::string &std, std::string &ft, int number) {
 	ft.clear();
 }
 
-//MARK: - Const reverse iterator vector
-
-void constReverseIteratorTestVector(std::string &std, std::string &ft, int number) {
-	std::vector<int> testStd;
-	ft::vector<int> testFt;
-	std::cout << "All const_reverse_iterator test" << " ";
-	for (int l = 0; l < number; l++) {
-		testStd.push_back(l);
-		testFt.push_back(l);
-	}
-	std::vector<int>::const_reverse_iterator it = testStd.crbegin();
-	std::vector<int>::const_reverse_iterator ite = testStd.crend();
-	ft::vector<int>::const_reverse_iterator itm = testFt.crbegin();
-	ft::vector<int>::const_reverse_iterator item = testFt.crend();
-	it++;
-	itm++;
-	while (it != ite) {
-		std += *it;
-		it++;
-	}
-	while (itm != item) {
-		ft += *itm;
-		itm++;
-	}
-	it = testStd.crbegin();
-	itm = testFt.crbegin();
-	ite--;
-	item--;
-	while (ite != it) {
-		std += *ite;
-		ite--;
-	}
-	while (item != itm) {
-		ft += *item;
-		item--;
-	}
+void sortIntrusiveTestStr(std::string &std, std::string &ft) {
+	std::cout << "Sort, merge and splice std::string test" << " ";
+	typedef ft::intrusive_list<IntrusiveElem<std::string>, &IntrusiveElem<std::string>::hook> List;
+	std::vector<IntrusiveElem<std::string> > storage;
+	std::vector<IntrusiveElem<std::string> > storageOther;
+	std::list<std::string> def;
+	std::list<std::string> defOther;
+	List my;
+	List myOther;
+	intrusivePushBackElem(def, my, storage, 200);
+	intrusivePushBackElem(defOther, myOther, storageOther, 100);
+	def.sort();
+	my.sort();
+	defOther.sort();
+	myOther.sort();
+	def.merge(defOther);
+	my.merge(myOther);
+	intrusiveFillStr(def, my, std, ft);
+	intrusiveFillStr(defOther, myOther, std, ft);
+	std::list<std::string>::iterator first = def.begin();
+	std::list<std::string>::iterator last = def.begin();
+	List::iterator myFirst = my.begin();
+	List::iterator myLast = my.begin();
+	std::advance(first, 20);
+	std::advance(last, 120);
+	std::advance(myFirst, 20);
+	std::advance(myLast, 120);
+	defOther.splice(defOther.end(), def, first, last);
+	myOther.splice(myOther.end(), my, myFirst, myLast);
+	defOther.splice(defOther.begin(), def, def.begin());
+	myOther.splice(myOther.begin(), my, my.begin());
+	def.splice(def.begin(), defOther);
+	my.splice(my.begin(), myOther);
+	intrusiveFillStr(def, my, std, ft);
+	intrusiveFillStr(defOther, myOther, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3080,13 +4960,28 @@ void constReverseIteratorTestVector(std::string &std, std::string &ft, int numbe
 	ft.clear();
 }
 
-//MARK: - Size vector
+void testIntrusiveList() {
+	std::string std;
+	std::string ft;
+	std::cout << "                            MODIFIERS" << std::endl;
+	modifiersIntrusiveTest(std, ft);
+	modifiersIntrusiveTestFloat(std, ft);
+	modifiersIntrusiveTestStr(std, ft);
+	std::cout << "                            OPERATIONS" << std::endl;
+	operationsIntrusiveTest(std, ft);
+	operationsIntrusiveTestFloat(std, ft);
+	operationsIntrusiveTestStr(std, ft);
+	sortIntrusiveTest(std, ft);
+	sortIntrusiveTestFloat(std, ft);
+	sortIntrusiveTestStr(std, ft);
+}
 
-void sizeTest(std::string &std, std::string &ft) {
-	std::cout << "Size int test" << " ";
+//MARK: - Defoult constructor vector
+
+void defaultCnstTestVector(std::string &std, std::string &ft) {
+	std::cout << "Default constructor int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 100);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3096,11 +4991,10 @@ void sizeTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void sizeTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Size float test" << " ";
+void defaultCnstTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Default constructor float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 100);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3110,11 +5004,10 @@ void sizeTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void sizeTestStr(std::string &std, std::string &ft) {
-	std::cout << "Size std::string test" << " ";
+void defaultCnstTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Default constructor std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 100);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3124,15 +5017,13 @@ void sizeTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Max size vector
+//MARK: - Fill constructor vector
 
-void maxSizeTest(std::string &std, std::string &ft) {
-	std::cout << "Max size int test" << " ";
-	std::vector<int> def;
-	ft::vector<int> my;
-	VectorPushBackElem(def, my, 1000);
-	std += def.max_size();
-	ft += my.max_size();
+void fillCnstTestVector(std::string &std, std::string &ft) {
+	std::cout << "Fill constructor int test" << " ";
+	std::vector<int> def(4, 100);
+	ft::vector<int> my(4, 100);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3141,13 +5032,11 @@ void maxSizeTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void maxSizeTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Max size float test" << " ";
-	std::vector<float> def;
-	ft::vector<float> my;
-	VectorPushBackElem(def, my, 1000);
-	std += def.max_size();
-	ft += my.max_size();
+void fillCnstTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Fill constructor float test" << " ";
+	std::vector<float> def(4, 100.42);
+	ft::vector<float> my(4, 100.42);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3156,13 +5045,13 @@ void maxSizeTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void maxSizeTestStr(std::string &std, std::string &ft) {
-	std::cout << "Max size std::string test" << " ";
-	std::vector<std::string> def;
-	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 1000);
-	std += def.max_size();
-	ft += my.max_size();
+void fillCnstTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Fill constructor std::string test" << " ";
+	std::string set;
+	set += "100";
+	std::vector<std::string> def(4, set);
+	ft::vector<std::string> my(4, set);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3171,19 +5060,15 @@ void maxSizeTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Resize vector
+//MARK: - Range constructor vector
 
-void resizeTestIntVector(std::string &std, std::string &ft) {
-	std::cout << "Resize int test" << " ";
-	std::vector<int> def;
-	ft::vector<int> my;
-	VectorPushBackElem(def, my, 100);
-	VectorFillStr(def, my, std, ft);
-	def.resize(80);
-	my.resize(80);
-	VectorFillStr(def, my, std, ft);
-	def.resize(90);
-	my.resize(90);
+void rangeCnstTestVector(std::string &std, std::string &ft) {
+	std::cout << "Range constructor int test" << " ";
+	std::vector<int> test;
+	for (int i = 0; i < 10; i++)
+		test.push_back(i);
+	std::vector<int> def(++test.begin(), --(--test.end()));
+	ft::vector<int> my(++test.begin(), --(--test.end()));
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3193,17 +5078,13 @@ void resizeTestIntVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void resizeTestFloatVector(std::string &std, std::string &ft) {
-	std::cout << "Resize float test" << " ";
-	std::vector<float> def;
-	ft::vector<float> my;
-	VectorPushBackElem(def, my, 100);
-	VectorFillStr(def, my, std, ft);
-	def.resize(80);
-	my.resize(80);
-	VectorFillStr(def, my, std, ft);
-	def.resize(90);
-	my.resize(90);
+void rangeCnstTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Range constructor float test" << " ";
+	std::vector<float> test;
+	for (int i = 0; i < 10; i++)
+		test.push_back(i + 0.42);
+	std::vector<float> def(++test.begin(), --(--test.end()));
+	ft::vector<float> my(++test.begin(), --(--test.end()));
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3213,17 +5094,17 @@ void resizeTestFloatVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void resizeTestStrVector(std::string &std, std::string &ft) {
-	std::cout << "Resize std::string test" << " ";
-	std::vector<std::string> def;
-	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 100);
-	VectorFillStr(def, my, std, ft);
-	def.resize(80);
-	my.resize(80);
-	VectorFillStr(def, my, std, ft);
-	def.resize(90);
-	my.resize(90);
+void rangeCnstTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Range constructor std::string test" << " ";
+	std::vector<std::string> test;
+	std::string chr;
+	for (int i = 0; i < 10; i++) {
+		chr += i;
+		test.push_back(chr);
+		chr.clear();
+	}
+	std::vector<std::string> def(++test.begin(), test.end());
+	ft::vector<std::string> my(++test.begin(), test.end());
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3233,16 +5114,18 @@ void resizeTestStrVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Capacity vector
+//MARK: - Copy constructor vector
 
-void capacityTestVector(std::string &std, std::string &ft) {
-	std::cout << "Capacity int test" << " ";
-	std::vector<int> def;
-	ft::vector<int> my;
-	VectorFillStr(def, my, std, ft);
-	VectorPushBackElem(def, my, 1);
-	VectorFillStr(def, my, std, ft);
-	VectorPushBackElem(def, my, 10);
+void copyCnstTestVector(std::string &std, std::string &ft) {
+	std::cout << "Copy constructor int test" << " ";
+	std::vector<int> test;
+	ft::vector<int> test1;
+	for (int i = 0; i < 10; i++) {
+		test.push_back(i);
+		test1.push_back(i);
+	}
+	std::vector<int> def(test);
+	ft::vector<int> my(test1);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3252,14 +5135,16 @@ void capacityTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void capacityTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Capacity float test" << " ";
-	std::vector<float> def;
-	ft::vector<float> my;
-	VectorFillStr(def, my, std, ft);
-	VectorPushBackElem(def, my, 1);
-	VectorFillStr(def, my, std, ft);
-	VectorPushBackElem(def, my, 10);
+void copyCnstTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Copy constructor float test" << " ";
+	std::vector<float> test;
+	ft::vector<float> test1;
+	for (int i = 0; i < 10; i++) {
+		test.push_back(i + 0.42);
+		test1.push_back(i + 0.42);
+	}
+	std::vector<float> def(test);
+	ft::vector<float> my(test1);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3269,14 +5154,19 @@ void capacityTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void capacityTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Capacity std::string test" << " ";
-	std::vector<std::string> def;
-	ft::vector<std::string> my;
-	VectorFillStr(def, my, std, ft);
-	VectorPushBackElem(def, my, 1);
-	VectorFillStr(def, my, std, ft);
-	VectorPushBackElem(def, my, 10);
+void copyCnstTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Copy constructor std::string test" << " ";
+	std::vector<std::string> test;
+	ft::vector<std::string> test1;
+	std::string chr;
+	for (int i = 0; i < 10; i++) {
+		chr += rand();
+		test.push_back(chr);
+		test1.push_back(chr);
+		chr.clear();
+	}
+	std::vector<std::string> def(test);
+	ft::vector<std::string> my(test1);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3286,17 +5176,21 @@ void capacityTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Empty vector
+//MARK: - Assignation vector
 
-void emptyVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Empty int test" << " ";
+void assignTestVector(std::string &std, std::string &ft) {
+	std::cout << "Assign int test" << " ";
 	std::vector<int> def;
+	std::vector<int> toAssign;
 	ft::vector<int> my;
-	std += def.empty();
-	ft += my.empty();
-	VectorPushBackElem(def, my, 10);
-	std += def.empty();
-	ft += my.empty();
+	ft::vector<int> myAssign;
+	for (int i = 0; i < 10; i++) {
+		toAssign.push_back(i);
+		myAssign.push_back(i);
+	}
+	def = toAssign;
+	my = myAssign;
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3305,15 +5199,19 @@ void emptyVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void emptyVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Empty float test" << " ";
+void assignTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Assign float test" << " ";
 	std::vector<float> def;
+	std::vector<float> toAssign;
 	ft::vector<float> my;
-	std += def.empty();
-	ft += my.empty();
-	VectorPushBackElem(def, my, 10);
-	std += def.empty();
-	ft += my.empty();
+	ft::vector<float> myAssign;
+	for (int i = 0; i < 10; i++) {
+		toAssign.push_back(i + 0.42);
+		myAssign.push_back(i + 0.42);
+	}
+	def = toAssign;
+	my = myAssign;
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3322,15 +5220,22 @@ void emptyVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void emptyVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Empty std::string test" << " ";
+void assignTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Assign std::string test" << " ";
 	std::vector<std::string> def;
+	std::vector<std::string> toAssign;
 	ft::vector<std::string> my;
-	std += def.empty();
-	ft += my.empty();
-	VectorPushBackElem(def, my, 10);
-	std += def.empty();
-	ft += my.empty();
+	ft::vector<std::string> myAssign;
+	std::string chr;
+	for (int i = 0; i < 10; i++) {
+		chr += rand();
+		toAssign.push_back(chr);
+		myAssign.push_back(chr);
+		chr.clear();
+	}
+	def = toAssign;
+	my = myAssign;
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3339,23 +5244,36 @@ void emptyVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Reserve vector
-
-void reserveVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Reserve int test" << " ";
+void reuseAssignTestVector(std::string &std, std::string &ft) {
+	std::cout << "Capacity reusing assign int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
+	std::vector<int> source;
+	ft::vector<int> mySource;
 	VectorPushBackElem(def, my, 100);
-	std += def.capacity();
-	ft += my.capacity();
-	def.reserve(500);
-	my.reserve(500);
-	std += def.capacity();
-	ft += my.capacity();
-	def.reserve(1);
-	my.reserve(1);
-	std += def.capacity();
-	ft += my.capacity();
+	VectorPushBackElem(source, mySource, 50);
+	def = source;
+	my = mySource;
+	VectorFillStr(def, my, std, ft);
+	def.assign(30, source[7]);
+	my.assign(30, mySource[7]);
+	VectorFillStr(def, my, std, ft);
+	def.assign(70, def[3]);
+	my.assign(70, my[3]);
+	VectorFillStr(def, my, std, ft);
+	def.assign(source.begin() + 5, source.end());
+	my.assign(source.begin() + 5, source.end());
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(source, mySource, 150);
+	def = source;
+	my = mySource;
+	VectorFillStr(def, my, std, ft);
+	def.assign(source.begin(), source.begin() + 150);
+	my.assign(source.begin(), source.begin() + 150);
+	VectorFillStr(def, my, std, ft);
+	def.assign(500, source[0]);
+	my.assign(500, mySource[0]);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3364,21 +5282,36 @@ void reserveVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void reserveVectorFloatTest(std::string &std, std::string &ft) {
-	std::cout << "Reserve float test" << " ";
+void reuseAssignTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Capacity reusing assign float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
+	std::vector<float> source;
+	ft::vector<float> mySource;
 	VectorPushBackElem(def, my, 100);
-	std += def.capacity();
-	ft += my.capacity();
-	def.reserve(500);
-	my.reserve(500);
-	std += def.capacity();
-	ft += my.capacity();
-	def.reserve(1);
-	my.reserve(1);
-	std += def.capacity();
-	ft += my.capacity();
+	VectorPushBackElem(source, mySource, 50);
+	def = source;
+	my = mySource;
+	VectorFillStr(def, my, std, ft);
+	def.assign(30, source[7]);
+	my.assign(30, mySource[7]);
+	VectorFillStr(def, my, std, ft);
+	def.assign(70, def[3]);
+	my.assign(70, my[3]);
+	VectorFillStr(def, my, std, ft);
+	def.assign(source.begin() + 5, source.end());
+	my.assign(source.begin() + 5, source.end());
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(source, mySource, 150);
+	def = source;
+	my = mySource;
+	VectorFillStr(def, my, std, ft);
+	def.assign(source.begin(), source.begin() + 150);
+	my.assign(source.begin(), source.begin() + 150);
+	VectorFillStr(def, my, std, ft);
+	def.assign(500, source[0]);
+	my.assign(500, mySource[0]);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3387,21 +5320,36 @@ void reserveVectorFloatTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void reserveVectorStrTest(std::string &std, std::string &ft) {
-	std::cout << "Reserve std::string test" << " ";
+void reuseAssignTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Capacity reusing assign std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
+	std::vector<std::string> source;
+	ft::vector<std::string> mySource;
 	VectorPushBackElem(def, my, 100);
-	std += def.capacity();
-	ft += my.capacity();
-	def.reserve(500);
-	my.reserve(500);
-	std += def.capacity();
-	ft += my.capacity();
-	def.reserve(1);
-	my.reserve(1);
-	std += def.capacity();
-	ft += my.capacity();
+	VectorPushBackElem(source, mySource, 50);
+	def = source;
+	my = mySource;
+	VectorFillStr(def, my, std, ft);
+	def.assign(30, source[7]);
+	my.assign(30, mySource[7]);
+	VectorFillStr(def, my, std, ft);
+	def.assign(70, def[3]);
+	my.assign(70, my[3]);
+	VectorFillStr(def, my, std, ft);
+	def.assign(source.begin() + 5, source.end());
+	my.assign(source.begin() + 5, source.end());
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(source, mySource, 150);
+	def = source;
+	my = mySource;
+	VectorFillStr(def, my, std, ft);
+	def.assign(source.begin(), source.begin() + 150);
+	my.assign(source.begin(), source.begin() + 150);
+	VectorFillStr(def, my, std, ft);
+	def.assign(500, source[0]);
+	my.assign(500, mySource[0]);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3410,21 +5358,40 @@ void reserveVectorStrTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Operator [] vector
+//MARK: - Iterator vector
 
-void squareBracketsTest(std::string &std, std::string &ft) {
-	std::cout << "Operator [] int test" << " ";
-	std::vector<int> def;
-	ft::vector<int> my;
-	VectorPushBackElem(def, my, 100);
-	std += def[50];
-	ft += my[50];
-	std += def[20];
-	ft += my[20];
-	std += def[10];
-	ft += my[10];
-	std += def[90];
-	ft += my[90];
+void iteratorTestVector(std::string &std, std::string &ft, int number) {
+	std::vector<int> testStd;
+	ft::vector<int> testFt;
+	std::cout << "All iterator test" << " ";
+	for (int l = 0; l < number; l++) {
+		testStd.push_back(l);
+		testFt.push_back(l);
+	}
+	std::vector<int>::iterator it = testStd.begin();
+	std::vector<int>::iterator ite = testStd.end();
+	ft::vector<int>::iterator itm = testFt.begin();
+	ft::vector<int>::iterator item = testFt.end();
+	while (it != ite) {
+		std += *it;
+		it++;
+	}
+	while (itm != item) {
+		ft += *itm;
+		itm++;
+	}
+	it = testStd.begin();
+	itm = testFt.begin();
+	ite--;
+	item--;
+	while (ite != it) {
+		std += *ite;
+		ite--;
+	}
+	while (item != itm) {
+		ft += *item;
+		item--;
+	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3433,19 +5400,40 @@ void squareBracketsTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void squareBracketsTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Operator [] float test" << " ";
-	std::vector<float> def;
-	ft::vector<float> my;
-	VectorPushBackElem(def, my, 100);
-	std += def[50];
-	ft += my[50];
-	std += def[20];
-	ft += my[20];
-	std += def[10];
-	ft += my[10];
-	std += def[90];
-	ft += my[90];
+//MARK: - Const iterator vector
+
+void constIteratorTestVector(std::string &std, std::string &ft, int number) {
+	std::vector<int> testStd;
+	ft::vector<int> testFt;
+	std::cout << "All const_iterator test" << " ";
+	for (int l = 0; l < number; l++) {
+		testStd.push_back(l);
+		testFt.push_back(l);
+	}
+	std::vector<int>::const_iterator it = testStd.cbegin();
+	std::vector<int>::const_iterator ite = testStd.cend();
+	ft::vector<int>::const_iterator itm = testFt.cbegin();
+	ft::vector<int>::const_iterator item = testFt.cend();
+	while (it != ite) {
+		std += *it;
+		it++;
+	}
+	while (itm != item) {
+		ft += *itm;
+		itm++;
+	}
+	it = testStd.cbegin();
+	itm = testFt.cbegin();
+	ite--;
+	item--;
+	while (ite != it) {
+		std += *ite;
+		ite--;
+	}
+	while (item != itm) {
+		ft += *item;
+		item--;
+	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3454,19 +5442,42 @@ void squareBracketsTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void squareBracketsTestStr(std::string &std, std::string &ft) {
-	std::cout << "Operator [] std::string test" << " ";
-	std::vector<std::string> def;
-	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 100);
-	std += def[50];
-	ft += my[50];
-	std += def[20];
-	ft += my[20];
-	std += def[10];
-	ft += my[10];
-	std += def[90];
-	ft += my[90];
+//MARK: - Reverse iterator vector
+
+void reverseIteratorTestVector(std::string &std, std::string &ft, int number) {
+	std::vector<int> testStd;
+	ft::vector<int> testFt;
+	std::cout << "All reverse_iterator test" << " ";
+	for (int l = 0; l < number; l++) {
+		testStd.push_back(l);
+		testFt.push_back(l);
+	}
+	std::vector<int>::reverse_iterator it = testStd.rbegin();
+	std::vector<int>::reverse_iterator ite = testStd.rend();
+	ft::vector<int>::reverse_iterator itm = testFt.rbegin();
+	ft::vector<int>::reverse_iterator item = testFt.rend();
+	it++;
+	itm++;
+	while (it != ite) {
+		std += *it;
+		it++;
+	}
+	while (itm != item) {
+		ft += *itm;
+		itm++;
+	}
+	it = testStd.rbegin();
+	itm = testFt.rbegin();
+	ite--;
+	item--;
+	while (ite != it) {
+		std += *ite;
+		ite--;
+	}
+	while (item != itm) {
+		ft += *item;
+		item--;
+	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3475,25 +5486,96 @@ void squareBracketsTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - At vector
+//MARK: - Const reverse iterator vector
 
-void atTest(std::string &std, std::string &ft) {
-	std::cout << "At int test" << " ";
+void constReverseIteratorTestVector(std::string &std, std::string &ft, int number) {
+	std::vector<int> testStd;
+	ft::vector<int> testFt;
+	std::cout << "All const_reverse_iterator test" << " ";
+	for (int l = 0; l < number; l++) {
+		testStd.push_back(l);
+		testFt.push_back(l);
+	}
+	std::vector<int>::const_reverse_iterator it = testStd.crbegin();
+	std::vector<int>::const_reverse_iterator ite = testStd.crend();
+	ft::vector<int>::const_reverse_iterator itm = testFt.crbegin();
+	ft::vector<int>::const_reverse_iterator item = testFt.crend();
+	it++;
+	itm++;
+	while (it != ite) {
+		std += *it;
+		it++;
+	}
+	while (itm != item) {
+		ft += *itm;
+		itm++;
+	}
+	it = testStd.crbegin();
+	itm = testFt.crbegin();
+	ite--;
+	item--;
+	while (ite != it) {
+		std += *ite;
+		ite--;
+	}
+	while (item != itm) {
+		ft += *item;
+		item--;
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Std algorithms vector
+
+void algorithmIteratorTestVector(std::string &std, std::string &ft) {
+	std::cout << "Std algorithms on iterators int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 100);
-	std += def.at(50);
-	ft += my.at(50);
-	std += def.at(20);
-	ft += my.at(20);
-	std += def.at(10);
-	ft += my.at(10);
-	std += def.at(90);
-	ft += my.at(90);
-	def.at(20) = 1;
-	my.at(20) = 1;
-	std += def.at(20);
-	ft += my.at(20);
+	VectorPushBackElem(def, my, 500);
+	std::sort(def.begin(), def.end());
+	std::sort(my.begin(), my.end());
+	VectorFillStr(def, my, std, ft);
+	int val = def[250];
+	std += *std::lower_bound(def.begin(), def.end(), val);
+	ft += *std::lower_bound(my.begin(), my.end(), val);
+	std += std::upper_bound(def.begin(), def.end(), val) - def.begin();
+	ft += std::upper_bound(my.begin(), my.end(), val) - my.begin();
+	std::reverse(def.begin(), def.end());
+	std::reverse(my.begin(), my.end());
+	std::nth_element(def.begin(), def.begin() + 100, def.end());
+	std::nth_element(my.begin(), my.begin() + 100, my.end());
+	std += def[100];
+	ft += my[100];
+	std::sort(def.rbegin(), def.rend());
+	std::sort(my.rbegin(), my.rend());
+	VectorFillStr(def, my, std, ft);
+	std::vector<int>::iterator it = def.begin() + 10;
+	ft::vector<int>::iterator myIt = my.begin() + 10;
+	std::vector<int>::const_iterator cit = it;
+	ft::vector<int>::const_iterator myCit = myIt;
+	std += (cit == it);
+	ft += (myCit == myIt);
+	std += (def.end() - cit);
+	ft += (my.end() - myCit);
+	std += *(2 + it);
+	ft += *(2 + myIt);
+	std += it[5];
+	ft += myIt[5];
+	std += (it < it + 1) + (it - 3 >= def.begin());
+	ft += (myIt < myIt + 1) + (myIt - 3 >= my.begin());
+	std += def.rbegin()[3];
+	ft += my.rbegin()[3];
+	std += (def.rend() - def.rbegin());
+	ft += (my.rend() - my.rbegin());
+	std += *std::max_element(def.begin(), def.end());
+	ft += *std::max_element(my.begin(), my.end());
+	std += std::iterator_traits<std::vector<int>::const_iterator>::difference_type(def.end() - def.begin());
+	ft += std::iterator_traits<ft::vector<int>::const_iterator>::difference_type(my.end() - my.begin());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3502,23 +5584,50 @@ void atTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void atTestFloat(std::string &std, std::string &ft) {
-	std::cout << "At float test" << " ";
+void algorithmIteratorTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Std algorithms on iterators float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 100);
-	std += def.at(50);
-	ft += my.at(50);
-	std += def.at(20);
-	ft += my.at(20);
-	std += def.at(10);
-	ft += my.at(10);
-	std += def.at(90);
-	ft += my.at(90);
-	def.at(20) = 1;
-	my.at(20) = 1;
-	std += def.at(20);
-	ft += my.at(20);
+	VectorPushBackElem(def, my, 500);
+	std::sort(def.begin(), def.end());
+	std::sort(my.begin(), my.end());
+	VectorFillStr(def, my, std, ft);
+	float val = def[250];
+	std += *std::lower_bound(def.begin(), def.end(), val);
+	ft += *std::lower_bound(my.begin(), my.end(), val);
+	std += std::upper_bound(def.begin(), def.end(), val) - def.begin();
+	ft += std::upper_bound(my.begin(), my.end(), val) - my.begin();
+	std::reverse(def.begin(), def.end());
+	std::reverse(my.begin(), my.end());
+	std::nth_element(def.begin(), def.begin() + 100, def.end());
+	std::nth_element(my.begin(), my.begin() + 100, my.end());
+	std += def[100];
+	ft += my[100];
+	std::sort(def.rbegin(), def.rend());
+	std::sort(my.rbegin(), my.rend());
+	VectorFillStr(def, my, std, ft);
+	std::vector<float>::iterator it = def.begin() + 10;
+	ft::vector<float>::iterator myIt = my.begin() + 10;
+	std::vector<float>::const_iterator cit = it;
+	ft::vector<float>::const_iterator myCit = myIt;
+	std += (cit == it);
+	ft += (myCit == myIt);
+	std += (def.end() - cit);
+	ft += (my.end() - myCit);
+	std += *(2 + it);
+	ft += *(2 + myIt);
+	std += it[5];
+	ft += myIt[5];
+	std += (it < it + 1) + (it - 3 >= def.begin());
+	ft += (myIt < myIt + 1) + (myIt - 3 >= my.begin());
+	std += def.rbegin()[3];
+	ft += my.rbegin()[3];
+	std += (def.rend() - def.rbegin());
+	ft += (my.rend() - my.rbegin());
+	std += *std::max_element(def.begin(), def.end());
+	ft += *std::max_element(my.begin(), my.end());
+	std += std::iterator_traits<std::vector<float>::const_iterator>::difference_type(def.end() - def.begin());
+	ft += std::iterator_traits<ft::vector<float>::const_iterator>::difference_type(my.end() - my.begin());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3527,23 +5636,50 @@ void atTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void atTestStr(std::string &std, std::string &ft) {
-	std::cout << "At std::string test" << " ";
+void algorithmIteratorTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Std algorithms on iterators std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 100);
-	std += def.at(50);
-	ft += my.at(50);
-	std += def.at(20);
-	ft += my.at(20);
-	std += def.at(10);
-	ft += my.at(10);
-	std += def.at(90);
-	ft += my.at(90);
-	def.at(20) = "1";
-	my.at(20) = "1";
-	std += def.at(20);
-	ft += my.at(20);
+	VectorPushBackElem(def, my, 500);
+	std::sort(def.begin(), def.end());
+	std::sort(my.begin(), my.end());
+	VectorFillStr(def, my, std, ft);
+	std::string val = def[250];
+	std += *std::lower_bound(def.begin(), def.end(), val);
+	ft += *std::lower_bound(my.begin(), my.end(), val);
+	std += std::upper_bound(def.begin(), def.end(), val) - def.begin();
+	ft += std::upper_bound(my.begin(), my.end(), val) - my.begin();
+	std::reverse(def.begin(), def.end());
+	std::reverse(my.begin(), my.end());
+	std::nth_element(def.begin(), def.begin() + 100, def.end());
+	std::nth_element(my.begin(), my.begin() + 100, my.end());
+	std += def[100];
+	ft += my[100];
+	std::sort(def.rbegin(), def.rend());
+	std::sort(my.rbegin(), my.rend());
+	VectorFillStr(def, my, std, ft);
+	std::vector<std::string>::iterator it = def.begin() + 10;
+	ft::vector<std::string>::iterator myIt = my.begin() + 10;
+	std::vector<std::string>::const_iterator cit = it;
+	ft::vector<std::string>::const_iterator myCit = myIt;
+	std += (cit == it);
+	ft += (myCit == myIt);
+	std += (def.end() - cit);
+	ft += (my.end() - myCit);
+	std += *(2 + it);
+	ft += *(2 + myIt);
+	std += it[5];
+	ft += myIt[5];
+	std += (it < it + 1) + (it - 3 >= def.begin());
+	ft += (myIt < myIt + 1) + (myIt - 3 >= my.begin());
+	std += def.rbegin()[3];
+	ft += my.rbegin()[3];
+	std += (def.rend() - def.rbegin());
+	ft += (my.rend() - my.rbegin());
+	std += *std::max_element(def.begin(), def.end());
+	ft += *std::max_element(my.begin(), my.end());
+	std += std::iterator_traits<std::vector<std::string>::const_iterator>::difference_type(def.end() - def.begin());
+	ft += std::iterator_traits<ft::vector<std::string>::const_iterator>::difference_type(my.end() - my.begin());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3552,21 +5688,14 @@ void atTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Front vector
+//MARK: - Size vector
 
-void frontTest(std::string &std, std::string &ft) {
-	std::cout << "Front int test" << " ";
+void sizeTest(std::string &std, std::string &ft) {
+	std::cout << "Size int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 1);
-	std += def.front();
-	ft += my.front();
-	VectorPushBackElem(def, my, 10);
-	std += def.front();
-	ft += my.front();
-	VectorPushBackElem(def, my, 1);
-	std += def.front();
-	ft += my.front();
+	VectorPushBackElem(def, my, 100);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3575,19 +5704,12 @@ void frontTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void frontTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Front float test" << " ";
+void sizeTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Size float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 1);
-	std += def.front();
-	ft += my.front();
-	VectorPushBackElem(def, my, 10);
-	std += def.front();
-	ft += my.front();
-	VectorPushBackElem(def, my, 1);
-	std += def.front();
-	ft += my.front();
+	VectorPushBackElem(def, my, 100);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3596,19 +5718,12 @@ void frontTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void frontTestStr(std::string &std, std::string &ft) {
-	std::cout << "Front std::string test" << " ";
+void sizeTestStr(std::string &std, std::string &ft) {
+	std::cout << "Size std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 1);
-	std += def.front();
-	ft += my.front();
-	VectorPushBackElem(def, my, 10);
-	std += def.front();
-	ft += my.front();
-	VectorPushBackElem(def, my, 1);
-	std += def.front();
-	ft += my.front();
+	VectorPushBackElem(def, my, 100);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3617,25 +5732,15 @@ void frontTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Back vector
+//MARK: - Max size vector
 
-void backTest(std::string &std, std::string &ft) {
-	std::cout << "Back int test" << " ";
+void maxSizeTest(std::string &std, std::string &ft) {
+	std::cout << "Max size int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 1);
-	std += def.back();
-	ft += my.back();
-	def.clear();
-	my.clear();
-	VectorPushBackElem(def, my, 10);
-	std += def.back();
-	ft += my.back();
-	def.clear();
-	my.clear();
-	VectorPushBackElem(def, my, 1);
-	std += def.back();
-	ft += my.back();
+	VectorPushBackElem(def, my, 1000);
+	std += def.max_size();
+	ft += my.max_size();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3644,23 +5749,13 @@ void backTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void backTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Back float test" << " ";
+void maxSizeTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Max size float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 1);
-	std += def.back();
-	ft += my.back();
-	def.clear();
-	my.clear();
-	VectorPushBackElem(def, my, 10);
-	std += def.back();
-	ft += my.back();
-	def.clear();
-	my.clear();
-	VectorPushBackElem(def, my, 1);
-	std += def.back();
-	ft += my.back();
+	VectorPushBackElem(def, my, 1000);
+	std += def.max_size();
+	ft += my.max_size();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3669,23 +5764,13 @@ void backTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void backTestStr(std::string &std, std::string &ft) {
-	std::cout << "Back std::string test" << " ";
+void maxSizeTestStr(std::string &std, std::string &ft) {
+	std::cout << "Max size std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 1);
-	std += def.back();
-	ft += my.back();
-	def.clear();
-	my.clear();
-	VectorPushBackElem(def, my, 10);
-	std += def.back();
-	ft += my.back();
-	def.clear();
-	my.clear();
-	VectorPushBackElem(def, my, 1);
-	std += def.back();
-	ft += my.back();
+	VectorPushBackElem(def, my, 1000);
+	std += def.max_size();
+	ft += my.max_size();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3694,19 +5779,19 @@ void backTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Range assign vector
+//MARK: - Resize vector
 
-void assignRangeTest(std::string &std, std::string &ft) {
-	std::cout << "Assign range int test" << " ";
+void resizeTestIntVector(std::string &std, std::string &ft) {
+	std::cout << "Resize int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> toAssign;
-	VectorPushBackElem(def, my, 10);
+	VectorPushBackElem(def, my, 100);
 	VectorFillStr(def, my, std, ft);
-	for (int i = 0; i < 8; i++)
-		toAssign.push_back(rand());
-	def.assign(++(++toAssign.begin()), --toAssign.end());
-	my.assign(++(++toAssign.begin()), --toAssign.end());
+	def.resize(80);
+	my.resize(80);
+	VectorFillStr(def, my, std, ft);
+	def.resize(90);
+	my.resize(90);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3716,17 +5801,17 @@ void assignRangeTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignRangeTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Assign range float test" << " ";
+void resizeTestFloatVector(std::string &std, std::string &ft) {
+	std::cout << "Resize float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	std::vector<float> toAssign;
-	VectorPushBackElem(def, my, 10);
+	VectorPushBackElem(def, my, 100);
 	VectorFillStr(def, my, std, ft);
-	for (int i = 0; i < 10; i++)
-		toAssign.push_back(rand());
-	def.assign(++(++toAssign.begin()), --toAssign.end());
-	my.assign(++(++toAssign.begin()), --toAssign.end());
+	def.resize(80);
+	my.resize(80);
+	VectorFillStr(def, my, std, ft);
+	def.resize(90);
+	my.resize(90);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3736,21 +5821,17 @@ void assignRangeTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignRangeTestStr(std::string &std, std::string &ft) {
-	std::cout << "Assign range std::string test" << " ";
+void resizeTestStrVector(std::string &std, std::string &ft) {
+	std::cout << "Resize std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	std::vector<std::string> toAssign;
-	std::string test;
-	VectorPushBackElem(def, my, 10);
+	VectorPushBackElem(def, my, 100);
 	VectorFillStr(def, my, std, ft);
-	for (int i = 0; i < 10; i++) {
-		test += rand();
-		toAssign.push_back(test);
-		test.clear();
-	}
-	def.assign(++(++toAssign.begin()), --toAssign.end());
-	my.assign(++(++toAssign.begin()), --toAssign.end());
+	def.resize(80);
+	my.resize(80);
+	VectorFillStr(def, my, std, ft);
+	def.resize(90);
+	my.resize(90);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3760,14 +5841,37 @@ void assignRangeTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Fill assign vector
-
-void assignFillTest(std::string &std, std::string &ft) {
-	std::cout << "Assign fill int test" << " ";
+void inPlaceResizeTestIntVector(std::string &std, std::string &ft) {
+	std::cout << "In place resize int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	def.assign(10, 42);
-	my.assign(10, 42);
+	VectorPushBackElem(def, my, 100);
+	const int* data = &my[0];
+	def.resize(99);
+	my.resize(99);
+	VectorFillStr(def, my, std, ft);
+	def.resize(100, def[5]);
+	my.resize(100, my[5]);
+	VectorFillStr(def, my, std, ft);
+	def.resize(20);
+	my.resize(20);
+	def.resize(120);
+	my.resize(120);
+	VectorFillStr(def, my, std, ft);
+	std += true;
+	ft += (data == &my[0]);
+	def.resize(10);
+	my.resize_default_init(10);
+	VectorFillStr(def, my, std, ft);
+	def.resize(64);
+	my.resize_default_init(64);
+	for (size_t i = 10; i < 64; i++) {
+		def[i] = def[i % 10];
+		my[i] = my[i % 10];
+	}
+	VectorFillStr(def, my, std, ft);
+	def.resize(256, def[1]);
+	my.resize(256, my[1]);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3777,12 +5881,37 @@ void assignFillTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignFillTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Assign fill float test" << " ";
+void inPlaceResizeTestFloatVector(std::string &std, std::string &ft) {
+	std::cout << "In place resize float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	def.assign(10, 42.21);
-	my.assign(10, 42.21);
+	VectorPushBackElem(def, my, 100);
+	const float* data = &my[0];
+	def.resize(99);
+	my.resize(99);
+	VectorFillStr(def, my, std, ft);
+	def.resize(100, def[5]);
+	my.resize(100, my[5]);
+	VectorFillStr(def, my, std, ft);
+	def.resize(20);
+	my.resize(20);
+	def.resize(120);
+	my.resize(120);
+	VectorFillStr(def, my, std, ft);
+	std += true;
+	ft += (data == &my[0]);
+	def.resize(10);
+	my.resize_default_init(10);
+	VectorFillStr(def, my, std, ft);
+	def.resize(64);
+	my.resize_default_init(64);
+	for (size_t i = 10; i < 64; i++) {
+		def[i] = def[i % 10];
+		my[i] = my[i % 10];
+	}
+	VectorFillStr(def, my, std, ft);
+	def.resize(256, def[1]);
+	my.resize(256, my[1]);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3792,12 +5921,37 @@ void assignFillTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignFillTestStr(std::string &std, std::string &ft) {
-	std::cout << "Assign fill std::string test" << " ";
+void inPlaceResizeTestStrVector(std::string &std, std::string &ft) {
+	std::cout << "In place resize std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	def.assign(10, "42");
-	my.assign(10, "42");
+	VectorPushBackElem(def, my, 100);
+	const std::string* data = &my[0];
+	def.resize(99);
+	my.resize(99);
+	VectorFillStr(def, my, std, ft);
+	def.resize(100, def[5]);
+	my.resize(100, my[5]);
+	VectorFillStr(def, my, std, ft);
+	def.resize(20);
+	my.resize(20);
+	def.resize(120);
+	my.resize(120);
+	VectorFillStr(def, my, std, ft);
+	std += true;
+	ft += (data == &my[0]);
+	def.resize(10);
+	my.resize_default_init(10);
+	VectorFillStr(def, my, std, ft);
+	def.resize(64);
+	my.resize_default_init(64);
+	for (size_t i = 10; i < 64; i++) {
+		def[i] = def[i % 10];
+		my[i] = my[i % 10];
+	}
+	VectorFillStr(def, my, std, ft);
+	def.resize(256, def[1]);
+	my.resize(256, my[1]);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3807,13 +5961,16 @@ void assignFillTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Push back vector
+//MARK: - Capacity vector
 
-void pushBackVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Push back int test" << " ";
+void capacityTestVector(std::string &std, std::string &ft) {
+	std::cout << "Capacity int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 1);
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 10);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3823,11 +5980,14 @@ void pushBackVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void pushBackVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Push back float test" << " ";
+void capacityTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Capacity float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 1);
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 10);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3837,11 +5997,14 @@ void pushBackVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void pushBackVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Push back std::string test" << " ";
+void capacityTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Capacity std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 1);
+	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 10);
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3851,19 +6014,17 @@ void pushBackVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Pop back vector
+//MARK: - Empty vector
 
-void popBackVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Pop back int test" << " ";
+void emptyVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Empty int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 1000);
-	VectorFillStr(def, my, std, ft);
-	for (int i = 0; i < 20; i++) {
-		def.pop_back();
-		my.pop_back();
-		VectorFillStr(def, my, std, ft);
-	}
+	std += def.empty();
+	ft += my.empty();
+	VectorPushBackElem(def, my, 10);
+	std += def.empty();
+	ft += my.empty();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3872,17 +6033,15 @@ void popBackVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void popBackVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Pop back float test" << " ";
+void emptyVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Empty float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 1000);
-	VectorFillStr(def, my, std, ft);
-	for (int i = 0; i < 20; i++) {
-		def.pop_back();
-		my.pop_back();
-		VectorFillStr(def, my, std, ft);
-	}
+	std += def.empty();
+	ft += my.empty();
+	VectorPushBackElem(def, my, 10);
+	std += def.empty();
+	ft += my.empty();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3891,17 +6050,15 @@ void popBackVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void popBackVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Pop back std::string test" << " ";
+void emptyVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Empty std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 1000);
-	VectorFillStr(def, my, std, ft);
-	for (int i = 0; i < 20; i++) {
-		def.pop_back();
-		my.pop_back();
-		VectorFillStr(def, my, std, ft);
-	}
+	std += def.empty();
+	ft += my.empty();
+	VectorPushBackElem(def, my, 10);
+	std += def.empty();
+	ft += my.empty();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -3910,19 +6067,24 @@ void popBackVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Insert vector
+//MARK: - Reserve vector
 
-void singleInsertVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Single insert int test" << " ";
+void reserveVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Reserve int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 10);
-	std::vector<int>::iterator it = ++def.begin();
-	ft::vector<int>::iterator mit = ++my.begin();
-	it = def.insert(it, 42);
-	mit = my.insert(mit, 42);
-	VectorFillStr(def, my, std, ft);
-	if (std == ft && *it == *mit)
+	VectorPushBackElem(def, my, 100);
+	std += def.capacity();
+	ft += my.capacity();
+	def.reserve(500);
+	my.reserve(500);
+	std += def.capacity();
+	ft += my.capacity();
+	def.reserve(1);
+	my.reserve(1);
+	std += def.capacity();
+	ft += my.capacity();
+	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
 		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
@@ -3930,17 +6092,22 @@ void singleInsertVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void singleInsertVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Single insert float test" << " ";
+void reserveVectorFloatTest(std::string &std, std::string &ft) {
+	std::cout << "Reserve float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 10);
-	std::vector<float>::iterator it = ++def.begin();
-	ft::vector<float>::iterator mit = ++my.begin();
-	it = def.insert(it, 42.21);
-	mit = my.insert(mit, 42.21);
-	VectorFillStr(def, my, std, ft);
-	if (std == ft && *it == *mit)
+	VectorPushBackElem(def, my, 100);
+	std += def.capacity();
+	ft += my.capacity();
+	def.reserve(500);
+	my.reserve(500);
+	std += def.capacity();
+	ft += my.capacity();
+	def.reserve(1);
+	my.reserve(1);
+	std += def.capacity();
+	ft += my.capacity();
+	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
 		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
@@ -3948,19 +6115,22 @@ void singleInsertVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void singleInsertVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Single insert std::string test" << " ";
+void reserveVectorStrTest(std::string &std, std::string &ft) {
+	std::cout << "Reserve std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 10);
-	std::vector<std::string>::iterator it = ++def.begin();
-	ft::vector<std::string>::iterator mit = ++my.begin();
-	std::string test;
-	test += "42";
-	it = def.insert(it, test);
-	mit = my.insert(mit, test);
-	VectorFillStr(def, my, std, ft);
-	if (std == ft && *it == *mit)
+	VectorPushBackElem(def, my, 100);
+	std += def.capacity();
+	ft += my.capacity();
+	def.reserve(500);
+	my.reserve(500);
+	std += def.capacity();
+	ft += my.capacity();
+	def.reserve(1);
+	my.reserve(1);
+	std += def.capacity();
+	ft += my.capacity();
+	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
 		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
@@ -3968,13 +6138,21 @@ void singleInsertVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void fillInsertVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Fill insert int test" << " ";
+//MARK: - Shrink to fit vector
+
+void shrinkToFitVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Shrink to fit int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 10);
-	def.insert(def.begin() + 5, 5, 21);
-	my.insert(my.begin() + 5, 5, 21);
+	VectorPushBackElem(def, my, 100);
+	VectorPopBackElem(def, my, 70);
+	def.shrink_to_fit();
+	my.shrink_to_fit();
+	VectorFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	def.shrink_to_fit();
+	my.shrink_to_fit();
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -3984,13 +6162,19 @@ void fillInsertVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void fillInsertVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Fill insert float test" << " ";
+void shrinkToFitVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Shrink to fit float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 10);
-	def.insert(def.begin() + 5, 5, 21.42);
-	my.insert(my.begin() + 5, 5, 21.42);
+	VectorPushBackElem(def, my, 100);
+	VectorPopBackElem(def, my, 70);
+	def.shrink_to_fit();
+	my.shrink_to_fit();
+	VectorFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	def.shrink_to_fit();
+	my.shrink_to_fit();
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -4000,13 +6184,19 @@ void fillInsertVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void fillInsertVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Fill insert std::string test" << " ";
+void shrinkToFitVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Shrink to fit std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 10);
-	def.insert(def.begin() + 5, 5, "21");
-	my.insert(my.begin() + 5, 5, "21");
+	VectorPushBackElem(def, my, 100);
+	VectorPopBackElem(def, my, 70);
+	def.shrink_to_fit();
+	my.shrink_to_fit();
+	VectorFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	def.shrink_to_fit();
+	my.shrink_to_fit();
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -4016,17 +6206,22 @@ void fillInsertVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeInsertVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Range insert int test" << " ";
-	std::vector<int> test;
+
+//MARK: - Operator [] vector
+
+void squareBracketsTest(std::string &std, std::string &ft) {
+	std::cout << "Operator [] int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
 	VectorPushBackElem(def, my, 100);
-	for (int i = 0; i < 10; i++)
-		test.push_back(rand());
-	def.insert(def.begin() + 10, test.begin(), test.end());
-	my.insert(my.begin() + 10, test.begin(), test.end());
-	VectorFillStr(def, my, std, ft);
+	std += def[50];
+	ft += my[50];
+	std += def[20];
+	ft += my[20];
+	std += def[10];
+	ft += my[10];
+	std += def[90];
+	ft += my[90];
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4035,17 +6230,19 @@ void rangeInsertVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeInsertVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Range insert float test" << " ";
-	std::vector<float> test;
+void squareBracketsTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Operator [] float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
 	VectorPushBackElem(def, my, 100);
-	for (int i = 0; i < 10; i++)
-		test.push_back(rand());
-	def.insert(def.begin() + 10, test.begin(), test.end());
-	my.insert(my.begin() + 10, test.begin(), test.end());
-	VectorFillStr(def, my, std, ft);
+	std += def[50];
+	ft += my[50];
+	std += def[20];
+	ft += my[20];
+	std += def[10];
+	ft += my[10];
+	std += def[90];
+	ft += my[90];
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4054,21 +6251,19 @@ void rangeInsertVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeInsertVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Range insert std::string test" << " ";
-	std::vector<std::string> test;
+void squareBracketsTestStr(std::string &std, std::string &ft) {
+	std::cout << "Operator [] std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	std::string str;
 	VectorPushBackElem(def, my, 100);
-	for (int i = 0; i < 10; i++) {
-		str += rand();
-		test.push_back(str);
-		str.clear();
-	}
-	def.insert(def.begin() + 10, test.begin(), test.end());
-	my.insert(my.begin() + 10, test.begin(), test.end());
-	VectorFillStr(def, my, std, ft);
+	std += def[50];
+	ft += my[50];
+	std += def[20];
+	ft += my[20];
+	std += def[10];
+	ft += my[10];
+	std += def[90];
+	ft += my[90];
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4077,16 +6272,25 @@ void rangeInsertVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Erase vector
+//MARK: - At vector
 
-void singleEraseVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Single erase int test" << " ";
+void atTest(std::string &std, std::string &ft) {
+	std::cout << "At int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
 	VectorPushBackElem(def, my, 100);
-	def.erase(def.begin() + 40);
-	my.erase(my.begin() + 40);
-	VectorFillStr(def, my, std, ft);
+	std += def.at(50);
+	ft += my.at(50);
+	std += def.at(20);
+	ft += my.at(20);
+	std += def.at(10);
+	ft += my.at(10);
+	std += def.at(90);
+	ft += my.at(90);
+	def.at(20) = 1;
+	my.at(20) = 1;
+	std += def.at(20);
+	ft += my.at(20);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4095,14 +6299,23 @@ void singleEraseVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void singleEraseVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Single erase float test" << " ";
+void atTestFloat(std::string &std, std::string &ft) {
+	std::cout << "At float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
 	VectorPushBackElem(def, my, 100);
-	def.erase(def.begin() + 40);
-	my.erase(my.begin() + 40);
-	VectorFillStr(def, my, std, ft);
+	std += def.at(50);
+	ft += my.at(50);
+	std += def.at(20);
+	ft += my.at(20);
+	std += def.at(10);
+	ft += my.at(10);
+	std += def.at(90);
+	ft += my.at(90);
+	def.at(20) = 1;
+	my.at(20) = 1;
+	std += def.at(20);
+	ft += my.at(20);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4111,14 +6324,23 @@ void singleEraseVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void singleEraseVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Single erase std::string test" << " ";
+void atTestStr(std::string &std, std::string &ft) {
+	std::cout << "At std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
 	VectorPushBackElem(def, my, 100);
-	def.erase(def.begin() + 40);
-	my.erase(my.begin() + 40);
-	VectorFillStr(def, my, std, ft);
+	std += def.at(50);
+	ft += my.at(50);
+	std += def.at(20);
+	ft += my.at(20);
+	std += def.at(10);
+	ft += my.at(10);
+	std += def.at(90);
+	ft += my.at(90);
+	def.at(20) = "1";
+	my.at(20) = "1";
+	std += def.at(20);
+	ft += my.at(20);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4127,14 +6349,21 @@ void singleEraseVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeEraseVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Range erase int test" << " ";
+//MARK: - Front vector
+
+void frontTest(std::string &std, std::string &ft) {
+	std::cout << "Front int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 100);
-	def.erase(def.begin() + 40, def.begin() + 60);
-	my.erase(my.begin() + 40, my.begin() + 60);
-	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 1);
+	std += def.front();
+	ft += my.front();
+	VectorPushBackElem(def, my, 10);
+	std += def.front();
+	ft += my.front();
+	VectorPushBackElem(def, my, 1);
+	std += def.front();
+	ft += my.front();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4143,14 +6372,19 @@ void rangeEraseVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeEraseVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Range erase float test" << " ";
+void frontTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Front float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 100);
-	def.erase(def.begin() + 40, def.begin() + 60);
-	my.erase(my.begin() + 40, my.begin() + 60);
-	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 1);
+	std += def.front();
+	ft += my.front();
+	VectorPushBackElem(def, my, 10);
+	std += def.front();
+	ft += my.front();
+	VectorPushBackElem(def, my, 1);
+	std += def.front();
+	ft += my.front();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4159,14 +6393,19 @@ void rangeEraseVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeEraseVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Range erase std::string test" << " ";
+void frontTestStr(std::string &std, std::string &ft) {
+	std::cout << "Front std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 100);
-	def.erase(def.begin() + 40, def.begin() + 60);
-	my.erase(my.begin() + 40, my.begin() + 60);
-	VectorFillStr(def, my, std, ft);
+	VectorPushBackElem(def, my, 1);
+	std += def.front();
+	ft += my.front();
+	VectorPushBackElem(def, my, 10);
+	std += def.front();
+	ft += my.front();
+	VectorPushBackElem(def, my, 1);
+	std += def.front();
+	ft += my.front();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4175,22 +6414,25 @@ void rangeEraseVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Swap vector
+//MARK: - Back vector
 
-void swapVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Swap int test" << " ";
+void backTest(std::string &std, std::string &ft) {
+	std::cout << "Back int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> toSwap;
-	ft::vector<int> mySwap;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(toSwap, mySwap, 50);
-	VectorFillStr(def, my, std, ft);
-	VectorFillStr(toSwap, mySwap, std, ft);
-	def.swap(toSwap);
-	my.swap(mySwap);
-	VectorFillStr(def, my, std, ft);
-	VectorFillStr(toSwap, mySwap, std, ft);
+	VectorPushBackElem(def, my, 1);
+	std += def.back();
+	ft += my.back();
+	def.clear();
+	my.clear();
+	VectorPushBackElem(def, my, 10);
+	std += def.back();
+	ft += my.back();
+	def.clear();
+	my.clear();
+	VectorPushBackElem(def, my, 1);
+	std += def.back();
+	ft += my.back();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4199,20 +6441,23 @@ void swapVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void swapVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Swap float test" << " ";
+void backTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Back float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	std::vector<float> toSwap;
-	ft::vector<float> mySwap;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(toSwap, mySwap, 50);
-	VectorFillStr(def, my, std, ft);
-	VectorFillStr(toSwap, mySwap, std, ft);
-	def.swap(toSwap);
-	my.swap(mySwap);
-	VectorFillStr(def, my, std, ft);
-	VectorFillStr(toSwap, mySwap, std, ft);
+	VectorPushBackElem(def, my, 1);
+	std += def.back();
+	ft += my.back();
+	def.clear();
+	my.clear();
+	VectorPushBackElem(def, my, 10);
+	std += def.back();
+	ft += my.back();
+	def.clear();
+	my.clear();
+	VectorPushBackElem(def, my, 1);
+	std += def.back();
+	ft += my.back();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4221,38 +6466,44 @@ void swapVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void swapVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Swap std::string test" << " ";
+void backTestStr(std::string &std, std::string &ft) {
+	std::cout << "Back std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	std::vector<std::string> toSwap;
-	ft::vector<std::string> mySwap;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(toSwap, mySwap, 50);
-	VectorFillStr(def, my, std, ft);
-	VectorFillStr(toSwap, mySwap, std, ft);
-	def.swap(toSwap);
-	my.swap(mySwap);
-	VectorFillStr(def, my, std, ft);
-	VectorFillStr(toSwap, mySwap, std, ft);
-	if (std == ft)
-		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
-	else
-		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	VectorPushBackElem(def, my, 1);
+	std += def.back();
+	ft += my.back();
+	def.clear();
+	my.clear();
+	VectorPushBackElem(def, my, 10);
+	std += def.back();
+	ft += my.back();
+	def.clear();
+	my.clear();
+	VectorPushBackElem(def, my, 1);
+	std += def.back();
+	ft += my.back();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
 	std.clear();
 	ft.clear();
 }
 
-//MARK: - Clear vector
+//MARK: - Range assign vector
 
-void clearVectorTest(std::string &std, std::string &ft) {
-	std::cout << "Clear int test" << " ";
+void assignRangeTest(std::string &std, std::string &ft) {
+	std::cout << "Assign range int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	VectorPushBackElem(def, my, 100);
+	std::vector<int> toAssign;
+	VectorPushBackElem(def, my, 10);
 	VectorFillStr(def, my, std, ft);
-	def.clear();
-	my.clear();
+	for (int i = 0; i < 8; i++)
+		toAssign.push_back(rand());
+	def.assign(++(++toAssign.begin()), --toAssign.end());
+	my.assign(++(++toAssign.begin()), --toAssign.end());
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -4262,14 +6513,17 @@ void clearVectorTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void clearVectorTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Clear float test" << " ";
+void assignRangeTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Assign range float test" << " ";
 	std::vector<float> def;
 	ft::vector<float> my;
-	VectorPushBackElem(def, my, 100);
+	std::vector<float> toAssign;
+	VectorPushBackElem(def, my, 10);
 	VectorFillStr(def, my, std, ft);
-	def.clear();
-	my.clear();
+	for (int i = 0; i < 10; i++)
+		toAssign.push_back(rand());
+	def.assign(++(++toAssign.begin()), --toAssign.end());
+	my.assign(++(++toAssign.begin()), --toAssign.end());
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -4279,14 +6533,21 @@ void clearVectorTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void clearVectorTestStr(std::string &std, std::string &ft) {
-	std::cout << "Clear std::string test" << " ";
+void assignRangeTestStr(std::string &std, std::string &ft) {
+	std::cout << "Assign range std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	VectorPushBackElem(def, my, 100);
+	std::vector<std::string> toAssign;
+	std::string test;
+	VectorPushBackElem(def, my, 10);
 	VectorFillStr(def, my, std, ft);
-	def.clear();
-	my.clear();
+	for (int i = 0; i < 10; i++) {
+		test += rand();
+		toAssign.push_back(test);
+		test.clear();
+	}
+	def.assign(++(++toAssign.begin()), --toAssign.end());
+	my.assign(++(++toAssign.begin()), --toAssign.end());
 	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -4296,24 +6557,15 @@ void clearVectorTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Non member vector
+//MARK: - Fill assign vector
 
-void equalTestVector(std::string &std, std::string &ft) {
-	std::cout << "Equal int test" << " ";
+void assignFillTest(std::string &std, std::string &ft) {
+	std::cout << "Assign fill int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> def1;
-	ft::vector<int> my1;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(def1, my1, 50);
-	std += (def1 == def);
-	std += (def == def1);
-	std += (def == def);
-	std += (def1 == def1);
-	ft += (my1 == my);
-	ft += (my == my1);
-	ft += (my == my);
-	ft += (my1 == my1);
+	def.assign(10, 42);
+	my.assign(10, 42);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4322,22 +6574,13 @@ void equalTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void equalTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Equal float test" << " ";
-	std::vector<float> defFloat;
-	ft::vector<float> myFloat;
-	std::vector<float> defFloat1;
-	ft::vector<float> myFloat1;
-	VectorPushBackElem(defFloat, myFloat, 100);
-	VectorPushBackElem(defFloat1, myFloat1, 50);
-	std += (defFloat1 == defFloat);
-	std += (defFloat == defFloat1);
-	std += (defFloat == defFloat);
-	std += (defFloat1 == defFloat1);
-	ft += (myFloat1 == myFloat);
-	ft += (myFloat == myFloat1);
-	ft += (myFloat == myFloat);
-	ft += (myFloat1 == myFloat1);
+void assignFillTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Assign fill float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	def.assign(10, 42.21);
+	my.assign(10, 42.21);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4346,22 +6589,13 @@ void equalTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void equalTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Equal std::string test" << " ";
-	std::vector<std::string> defStr;
-	ft::vector<std::string> myStr;
-	std::vector<std::string> defStr1;
-	ft::vector<std::string> myStr1;
-	VectorPushBackElem(defStr, myStr, 100);
-	VectorPushBackElem(defStr1, myStr1, 50);
-	std += (defStr1 == defStr);
-	std += (defStr == defStr1);
-	std += (defStr == defStr);
-	std += (defStr1 == defStr1);
-	ft += (myStr1 == myStr);
-	ft += (myStr == myStr1);
-	ft += (myStr == myStr);
-	ft += (myStr1 == myStr1);
+void assignFillTestStr(std::string &std, std::string &ft) {
+	std::cout << "Assign fill std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	def.assign(10, "42");
+	my.assign(10, "42");
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4370,22 +6604,14 @@ void equalTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void nonEqualTestVector(std::string &std, std::string &ft) {
-	std::cout << "Non equal int test" << " ";
+//MARK: - Push back vector
+
+void pushBackVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Push back int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> def1;
-	ft::vector<int> my1;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(def1, my1, 50);
-	std += (def1 != def);
-	std += (def != def1);
-	std += (def != def);
-	std += (def1 != def1);
-	ft += (my1 != my);
-	ft += (my != my1);
-	ft += (my != my);
-	ft += (my1 != my1);
+	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4394,22 +6620,12 @@ void nonEqualTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void nonEqualTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Non equal float test" << " ";
-	std::vector<float> defFloat;
-	ft::vector<float> myFloat;
-	std::vector<float> defFloat1;
-	ft::vector<float> myFloat1;
-	VectorPushBackElem(defFloat, myFloat, 100);
-	VectorPushBackElem(defFloat1, myFloat1, 50);
-	std += (defFloat1 != defFloat);
-	std += (defFloat != defFloat1);
-	std += (defFloat != defFloat);
-	std += (defFloat1 != defFloat1);
-	ft += (myFloat1 != myFloat);
-	ft += (myFloat != myFloat1);
-	ft += (myFloat != myFloat);
-	ft += (myFloat1 != myFloat1);
+void pushBackVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Push back float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4418,22 +6634,12 @@ void nonEqualTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void nonEqualTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Non equal std::string test" << " ";
-	std::vector<std::string> defStr;
-	ft::vector<std::string> myStr;
-	std::vector<std::string> defStr1;
-	ft::vector<std::string> myStr1;
-	VectorPushBackElem(defStr, myStr, 100);
-	VectorPushBackElem(defStr1, myStr1, 50);
-	std += (defStr1 != defStr);
-	std += (defStr != defStr1);
-	std += (defStr != defStr);
-	std += (defStr1 != defStr1);
-	ft += (myStr1 != myStr);
-	ft += (myStr != myStr1);
-	ft += (myStr != myStr);
-	ft += (myStr1 != myStr1);
+void pushBackVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Push back std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4442,22 +6648,19 @@ void nonEqualTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lessTestVector(std::string &std, std::string &ft) {
-	std::cout << "Less int test" << " ";
+//MARK: - Pop back vector
+
+void popBackVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Pop back int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> def1;
-	ft::vector<int> my1;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(def1, my1, 50);
-	std += (def1 < def);
-	ft += (my1 < my);
-	std += (def < def1);
-	ft += (my < my1);
-	std += (def < def);
-	ft += (my < my);
-	std += (def1 < def1);
-	ft += (my1 < my1);
+	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
+	for (int i = 0; i < 20; i++) {
+		def.pop_back();
+		my.pop_back();
+		VectorFillStr(def, my, std, ft);
+	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4466,22 +6669,17 @@ void lessTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lessTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Less float test" << " ";
-	std::vector<float> defFloat;
-	ft::vector<float> myFloat;
-	std::vector<float> defFloat1;
-	ft::vector<float> myFloat1;
-	VectorPushBackElem(defFloat, myFloat, 100);
-	VectorPushBackElem(defFloat1, myFloat1, 50);
-	std += (defFloat1 < defFloat);
-	ft += (myFloat1 < myFloat);
-	std += (defFloat < defFloat1);
-	ft += (myFloat < myFloat1);
-	std += (defFloat < defFloat);
-	ft += (myFloat < myFloat);
-	std += (defFloat1 < defFloat1);
-	ft += (myFloat1 < myFloat1);
+void popBackVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Pop back float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
+	for (int i = 0; i < 20; i++) {
+		def.pop_back();
+		my.pop_back();
+		VectorFillStr(def, my, std, ft);
+	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4490,22 +6688,17 @@ void lessTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lessTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Less std::string test" << " ";
+void popBackVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Pop back std::string test" << " ";
 	std::vector<std::string> def;
 	ft::vector<std::string> my;
-	std::vector<std::string> def1;
-	ft::vector<std::string> my1;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(def1, my1, 50);
-	std += (def < def1);
-	ft += (my < my1);
-	std += (def1 < def);
-	ft += (my1 < my);
-	std += (def < def);
-	ft += (my < my);
-	std += (def1 < def1);
-	ft += (my1 < my1);
+	VectorPushBackElem(def, my, 1000);
+	VectorFillStr(def, my, std, ft);
+	for (int i = 0; i < 20; i++) {
+		def.pop_back();
+		my.pop_back();
+		VectorFillStr(def, my, std, ft);
+	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4514,23 +6707,19 @@ void lessTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lessOrEqualTestVector(std::string &std, std::string &ft) {
-	std::cout << "Less or equal int test" << " ";
+//MARK: - Insert vector
+
+void singleInsertVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Single insert int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> def1;
-	ft::vector<int> my1;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(def1, my1, 50);
-	std += (def1 <= def);
-	std += (def <= def1);
-	std += (def <= def);
-	std += (def1 <= def1);
-	ft += (my1 <= my);
-	ft += (my <= my1);
-	ft += (my <= my);
-	ft += (my1 <= my1);
-	if (std == ft)
+	VectorPushBackElem(def, my, 10);
+	std::vector<int>::iterator it = ++def.begin();
+	ft::vector<int>::iterator mit = ++my.begin();
+	it = def.insert(it, 42);
+	mit = my.insert(mit, 42);
+	VectorFillStr(def, my, std, ft);
+	if (std == ft && *it == *mit)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
 		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
@@ -4538,23 +6727,17 @@ void lessOrEqualTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lessOrEqualTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Less or equal float test" << " ";
-	std::vector<float> defFloat;
-	ft::vector<float> myFloat;
-	std::vector<float> defFloat1;
-	ft::vector<float> myFloat1;
-	VectorPushBackElem(defFloat, myFloat, 100);
-	VectorPushBackElem(defFloat1, myFloat1, 50);
-	std += (defFloat1 <= defFloat);
-	std += (defFloat <= defFloat1);
-	std += (defFloat <= defFloat);
-	std += (defFloat1 <= defFloat1);
-	ft += (myFloat1 <= myFloat);
-	ft += (myFloat <= myFloat1);
-	ft += (myFloat <= myFloat);
-	ft += (myFloat1 <= myFloat1);
-	if (std == ft)
+void singleInsertVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Single insert float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 10);
+	std::vector<float>::iterator it = ++def.begin();
+	ft::vector<float>::iterator mit = ++my.begin();
+	it = def.insert(it, 42.21);
+	mit = my.insert(mit, 42.21);
+	VectorFillStr(def, my, std, ft);
+	if (std == ft && *it == *mit)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
 		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
@@ -4562,23 +6745,19 @@ void lessOrEqualTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lessOrEqualTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Less or equal std::string test" << " ";
-	std::vector<std::string> defStr;
-	ft::vector<std::string> myStr;
-	std::vector<std::string> defStr1;
-	ft::vector<std::string> myStr1;
-	VectorPushBackElem(defStr, myStr, 100);
-	VectorPushBackElem(defStr1, myStr1, 50);
-	std += (defStr1 <= defStr);
-	std += (defStr <= defStr1);
-	std += (defStr <= defStr);
-	std += (defStr1 <= defStr1);
-	ft += (myStr1 <= myStr);
-	ft += (myStr <= myStr1);
-	ft += (myStr <= myStr);
-	ft += (myStr1 <= myStr1);
-	if (std == ft)
+void singleInsertVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Single insert std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	VectorPushBackElem(def, my, 10);
+	std::vector<std::string>::iterator it = ++def.begin();
+	ft::vector<std::string>::iterator mit = ++my.begin();
+	std::string test;
+	test += "42";
+	it = def.insert(it, test);
+	mit = my.insert(mit, test);
+	VectorFillStr(def, my, std, ft);
+	if (std == ft && *it == *mit)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
 		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
@@ -4586,22 +6765,14 @@ void lessOrEqualTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void greaterTestVector(std::string &std, std::string &ft) {
-	std::cout << "Greater int test" << " ";
+void fillInsertVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Fill insert int test" << " ";
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> def1;
-	ft::vector<int> my1;
-	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(def1, my1, 50);
-	std += (def1 > def);
-	std += (def > def1);
-	std += (def > def);
-	std += (def1 > def1);
-	ft += (my1 > my);
-	ft += (my > my1);
-	ft += (my > my);
-	ft += (my1 > my1);
+	VectorPushBackElem(def, my, 10);
+	def.insert(def.begin() + 5, 5, 21);
+	my.insert(my.begin() + 5, 5, 21);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4610,22 +6781,14 @@ void greaterTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void greaterTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Greater float test" << " ";
-	std::vector<float> defFloat;
-	ft::vector<float> myFloat;
-	std::vector<float> defFloat1;
-	ft::vector<float> myFloat1;
-	VectorPushBackElem(defFloat, myFloat, 100);
-	VectorPushBackElem(defFloat1, myFloat1, 50);
-	std += (defFloat > defFloat1);
-	std += (defFloat1 > defFloat);
-	std += (defFloat > defFloat);
-	std += (defFloat1 > defFloat1);
-	ft += (myFloat > myFloat1);
-	ft += (myFloat1 > myFloat);
-	ft += (myFloat > myFloat);
-	ft += (myFloat1 > myFloat1);
+void fillInsertVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Fill insert float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 10);
+	def.insert(def.begin() + 5, 5, 21.42);
+	my.insert(my.begin() + 5, 5, 21.42);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4634,22 +6797,14 @@ void greaterTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void greaterTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Greater std::string test" << " ";
-	std::vector<std::string> defStr;
-	ft::vector<std::string> myStr;
-	std::vector<std::string> defStr1;
-	ft::vector<std::string> myStr1;
-	VectorPushBackElem(defStr, myStr, 100);
-	VectorPushBackElem(defStr1, myStr1, 50);
-	std += (defStr > defStr1);
-	std += (defStr1 > defStr);
-	std += (defStr > defStr);
-	std += (defStr1 > defStr1);
-	ft += (myStr > myStr1);
-	ft += (myStr1 > myStr);
-	ft += (myStr > myStr);
-	ft += (myStr1 > myStr1);
+void fillInsertVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Fill insert std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	VectorPushBackElem(def, my, 10);
+	def.insert(def.begin() + 5, 5, "21");
+	my.insert(my.begin() + 5, 5, "21");
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4658,22 +6813,17 @@ void greaterTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void greaterOrEqualTestVector(std::string &std, std::string &ft) {
-	std::cout << "Greater or equal int test" << " ";
+void rangeInsertVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Range insert int test" << " ";
+	std::vector<int> test;
 	std::vector<int> def;
 	ft::vector<int> my;
-	std::vector<int> def1;
-	ft::vector<int> my1;
 	VectorPushBackElem(def, my, 100);
-	VectorPushBackElem(def1, my1, 50);
-	std += (def >= def1);
-	std += (def1 >= def);
-	std += (def >= def);
-	std += (def1 >= def1);
-	ft += (my >= my1);
-	ft += (my1 >= my);
-	ft += (my >= my);
-	ft += (my1 >= my1);
+	for (int i = 0; i < 10; i++)
+		test.push_back(rand());
+	def.insert(def.begin() + 10, test.begin(), test.end());
+	my.insert(my.begin() + 10, test.begin(), test.end());
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4682,22 +6832,17 @@ void greaterOrEqualTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void greaterOrEqualTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Greater or equal float test" << " ";
-	std::vector<float> defFloat;
-	ft::vector<float> myFloat;
-	std::vector<float> defFloat1;
-	ft::vector<float> myFloat1;
-	VectorPushBackElem(defFloat, myFloat, 100);
-	VectorPushBackElem(defFloat1, myFloat1, 50);
-	std += (defFloat >= defFloat1);
-	std += (defFloat1 >= defFloat);
-	std += (defFloat >= defFloat);
-	std += (defFloat1 >= defFloat1);
-	ft += (myFloat >= myFloat1);
-	ft += (myFloat1 >= myFloat);
-	ft += (myFloat >= myFloat);
-	ft += (myFloat1 >= myFloat1);
+void rangeInsertVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Range insert float test" << " ";
+	std::vector<float> test;
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 100);
+	for (int i = 0; i < 10; i++)
+		test.push_back(rand());
+	def.insert(def.begin() + 10, test.begin(), test.end());
+	my.insert(my.begin() + 10, test.begin(), test.end());
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4706,22 +6851,21 @@ void greaterOrEqualTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void greaterOrEqualTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Greater or equal std::string test" << " ";
-	std::vector<std::string> defStr;
-	ft::vector<std::string> myStr;
-	std::vector<std::string> defStr1;
-	ft::vector<std::string> myStr1;
-	VectorPushBackElem(defStr, myStr, 100);
-	VectorPushBackElem(defStr1, myStr1, 50);
-	std += (defStr >= defStr1);
-	std += (defStr1 >= defStr);
-	std += (defStr >= defStr);
-	std += (defStr1 >= defStr1);
-	ft += (myStr >= myStr1);
-	ft += (myStr1 >= myStr);
-	ft += (myStr >= myStr);
-	ft += (myStr1 >= myStr1);
+void rangeInsertVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Range insert std::string test" << " ";
+	std::vector<std::string> test;
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	std::string str;
+	VectorPushBackElem(def, my, 100);
+	for (int i = 0; i < 10; i++) {
+		str += rand();
+		test.push_back(str);
+		str.clear();
+	}
+	def.insert(def.begin() + 10, test.begin(), test.end());
+	my.insert(my.begin() + 10, test.begin(), test.end());
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4730,40 +6874,45 @@ void greaterOrEqualTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void swapNonMemberTestVector(std::string &std, std::string &ft) {
-	std::cout << "Non member swap int test" << " ";
-	std::vector<int> def;
-	std::vector<int> toSwap;
-	ft::vector<int> my;
-	ft::vector<int> mySwap;
-	VectorPushBackElem(def, my, 10);
-	VectorPushBackElem(toSwap, mySwap, 10);
+void streamRangeTestVector(std::string &std, std::string &ft) {
+	std::cout << "Range from input and bidirectional iterators int test" << " ";
+	std::vector<int> source;
+	ft::vector<int> mySource;
+	VectorPushBackElem(source, mySource, 50);
+	std::ostringstream text;
+	for (size_t i = 0; i < source.size(); i++)
+		text << source[i] << ' ';
+	std::istringstream defIn(text.str());
+	std::istringstream myIn(text.str());
+	std::vector<int> def((std::istream_iterator<int>(defIn)), std::istream_iterator<int>());
+	ft::vector<int> my((std::istream_iterator<int>(myIn)), std::istream_iterator<int>());
+	VectorFillStr(def, my, std, ft);
+	std::istringstream defAssign(text.str());
+	std::istringstream myAssign(text.str());
+	def.assign(std::istream_iterator<int>(defAssign), std::istream_iterator<int>());
+	my.assign(std::istream_iterator<int>(myAssign), std::istream_iterator<int>());
+	VectorFillStr(def, my, std, ft);
+	std::istringstream defInsert(text.str());
+	std::istringstream myInsert(text.str());
+	def.insert(def.begin() + 7, std::istream_iterator<int>(defInsert), std::istream_iterator<int>());
+	my.insert(my.begin() + 7, std::istream_iterator<int>(myInsert), std::istream_iterator<int>());
+	for (size_t i = 0; i < def.size(); i++)
+		std += def[i];
+	for (size_t i = 0; i < my.size(); i++)
+		ft += my[i];
 	std += def.size();
 	ft += my.size();
-	for (std::vector<int>::iterator it = def.begin(); it != def.end(); it++)
-		std += *it;
-	for (ft::vector<int>::iterator it = my.begin(); it != my.end(); it++)
-		ft += *it;
-	std += toSwap.size();
-	ft += mySwap.size();
-	for (std::vector<int>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
-		std += *it;
-	for (ft::vector<int>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
-		ft += *it;
-	std::swap(def, toSwap);
-	ft::swap(my, mySwap);
+	std::list<int> chain(source.begin(), source.begin() + 20);
+	def.insert(def.begin() + 3, chain.begin(), chain.end());
+	my.insert(my.begin() + 3, chain.begin(), chain.end());
+	def.insert(def.end(), chain.rbegin(), chain.rend());
+	my.insert(my.end(), chain.rbegin(), chain.rend());
+	for (size_t i = 0; i < def.size(); i++)
+		std += def[i];
+	for (size_t i = 0; i < my.size(); i++)
+		ft += my[i];
 	std += def.size();
 	ft += my.size();
-	for (std::vector<int>::iterator it = def.begin(); it != def.end(); it++)
-		std += *it;
-	for (ft::vector<int>::iterator it = my.begin(); it != my.end(); it++)
-		ft += *it;
-	std += toSwap.size();
-	ft += mySwap.size();
-	for (std::vector<int>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
-		std += *it;
-	for (ft::vector<int>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
-		ft += *it;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4772,40 +6921,45 @@ void swapNonMemberTestVector(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void swapNonMemberTestVectorFloat(std::string &std, std::string &ft) {
-	std::cout << "Non member swap float test" << " ";
-	std::vector<float> def;
-	std::vector<float> toSwap;
-	ft::vector<float> my;
-	ft::vector<float> mySwap;
-	VectorPushBackElem(def, my, 10);
-	VectorPushBackElem(toSwap, mySwap, 10);
+void streamRangeTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Range from input and bidirectional iterators float test" << " ";
+	std::vector<float> source;
+	ft::vector<float> mySource;
+	VectorPushBackElem(source, mySource, 50);
+	std::ostringstream text;
+	for (size_t i = 0; i < source.size(); i++)
+		text << source[i] << ' ';
+	std::istringstream defIn(text.str());
+	std::istringstream myIn(text.str());
+	std::vector<float> def((std::istream_iterator<float>(defIn)), std::istream_iterator<float>());
+	ft::vector<float> my((std::istream_iterator<float>(myIn)), std::istream_iterator<float>());
+	VectorFillStr(def, my, std, ft);
+	std::istringstream defAssign(text.str());
+	std::istringstream myAssign(text.str());
+	def.assign(std::istream_iterator<float>(defAssign), std::istream_iterator<float>());
+	my.assign(std::istream_iterator<float>(myAssign), std::istream_iterator<float>());
+	VectorFillStr(def, my, std, ft);
+	std::istringstream defInsert(text.str());
+	std::istringstream myInsert(text.str());
+	def.insert(def.begin() + 7, std::istream_iterator<float>(defInsert), std::istream_iterator<float>());
+	my.insert(my.begin() + 7, std::istream_iterator<float>(myInsert), std::istream_iterator<float>());
+	for (size_t i = 0; i < def.size(); i++)
+		std += def[i];
+	for (size_t i = 0; i < my.size(); i++)
+		ft += my[i];
 	std += def.size();
 	ft += my.size();
-	for (std::vector<float>::iterator it = def.begin(); it != def.end(); it++)
-		std += *it;
-	for (ft::vector<float>::iterator it = my.begin(); it != my.end(); it++)
-		ft += *it;
-	std += toSwap.size();
-	ft += mySwap.size();
-	for (std::vector<float>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
-		std += *it;
-	for (ft::vector<float>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
-		ft += *it;
-	std::swap(def, toSwap);
-	ft::swap(my, mySwap);
+	std::list<float> chain(source.begin(), source.begin() + 20);
+	def.insert(def.begin() + 3, chain.begin(), chain.end());
+	my.insert(my.begin() + 3, chain.begin(), chain.end());
+	def.insert(def.end(), chain.rbegin(), chain.rend());
+	my.insert(my.end(), chain.rbegin(), chain.rend());
+	for (size_t i = 0; i < def.size(); i++)
+		std += def[i];
+	for (size_t i = 0; i < my.size(); i++)
+		ft += my[i];
 	std += def.size();
 	ft += my.size();
-	for (std::vector<float>::iterator it = def.begin(); it != def.end(); it++)
-		std += *it;
-	for (ft::vector<float>::iterator it = my.begin(); it != my.end(); it++)
-		ft += *it;
-	std += toSwap.size();
-	ft += mySwap.size();
-	for (std::vector<float>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
-		std += *it;
-	for (ft::vector<float>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
-		ft += *it;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4814,40 +6968,45 @@ void swapNonMemberTestVectorFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void swapNonMemberTestVectorStr(std::string &std, std::string &ft) {
-	std::cout << "Non member swap std::string test" << " ";
-	std::vector<std::string> def;
-	std::vector<std::string> toSwap;
-	ft::vector<std::string> my;
-	ft::vector<std::string> mySwap;
-	VectorPushBackElem(def, my, 10);
-	VectorPushBackElem(toSwap, mySwap, 10);
+void streamRangeTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Range from input and bidirectional iterators std::string test" << " ";
+	std::vector<std::string> source;
+	ft::vector<std::string> mySource;
+	VectorPushBackElem(source, mySource, 50);
+	std::ostringstream text;
+	for (size_t i = 0; i < source.size(); i++)
+		text << source[i] << ' ';
+	std::istringstream defIn(text.str());
+	std::istringstream myIn(text.str());
+	std::vector<std::string> def((std::istream_iterator<std::string>(defIn)), std::istream_iterator<std::string>());
+	ft::vector<std::string> my((std::istream_iterator<std::string>(myIn)), std::istream_iterator<std::string>());
+	VectorFillStr(def, my, std, ft);
+	std::istringstream defAssign(text.str());
+	std::istringstream myAssign(text.str());
+	def.assign(std::istream_iterator<std::string>(defAssign), std::istream_iterator<std::string>());
+	my.assign(std::istream_iterator<std::string>(myAssign), std::istream_iterator<std::string>());
+	VectorFillStr(def, my, std, ft);
+	std::istringstream defInsert(text.str());
+	std::istringstream myInsert(text.str());
+	def.insert(def.begin() + 7, std::istream_iterator<std::string>(defInsert), std::istream_iterator<std::string>());
+	my.insert(my.begin() + 7, std::istream_iterator<std::string>(myInsert), std::istream_iterator<std::string>());
+	for (size_t i = 0; i < def.size(); i++)
+		std += def[i];
+	for (size_t i = 0; i < my.size(); i++)
+		ft += my[i];
 	std += def.size();
 	ft += my.size();
-	for (std::vector<std::string>::iterator it = def.begin(); it != def.end(); it++)
-		std += *it;
-	for (ft::vector<std::string>::iterator it = my.begin(); it != my.end(); it++)
-		ft += *it;
-	std += toSwap.size();
-	ft += mySwap.size();
-	for (std::vector<std::string>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
-		std += *it;
-	for (ft::vector<std::string>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
-		ft += *it;
-	std::swap(def, toSwap);
-	ft::swap(my, mySwap);
+	std::list<std::string> chain(source.begin(), source.begin() + 20);
+	def.insert(def.begin() + 3, chain.begin(), chain.end());
+	my.insert(my.begin() + 3, chain.begin(), chain.end());
+	def.insert(def.end(), chain.rbegin(), chain.rend());
+	my.insert(my.end(), chain.rbegin(), chain.rend());
+	for (size_t i = 0; i < def.size(); i++)
+		std += def[i];
+	for (size_t i = 0; i < my.size(); i++)
+		ft += my[i];
 	std += def.size();
 	ft += my.size();
-	for (std::vector<std::string>::iterator it = def.begin(); it != def.end(); it++)
-		std += *it;
-	for (ft::vector<std::string>::iterator it = my.begin(); it != my.end(); it++)
-		ft += *it;
-	std += toSwap.size();
-	ft += mySwap.size();
-	for (std::vector<std::string>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
-		std += *it;
-	for (ft::vector<std::string>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
-		ft += *it;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4856,130 +7015,32 @@ void swapNonMemberTestVectorStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Vector
+//MARK: - Erase vector
 
-void testVector() {
-	std::cout << "                            CONSTRUCTOR" << std::endl;
-	std::string std;
-	std::string ft;
-	defaultCnstTestVector(std, ft);
-	defaultCnstTestVectorFloat(std, ft);
-	defaultCnstTestVectorStr(std, ft);
-	fillCnstTestVector(std, ft);
-	fillCnstTestVectorFloat(std, ft);
-	fillCnstTestVectorStr(std, ft);
-	rangeCnstTestVector(std, ft);
-	rangeCnstTestVectorFloat(std, ft);
-	rangeCnstTestVectorStr(std, ft);
-	copyCnstTestVector(std, ft);
-	copyCnstTestVectorFloat(std, ft);
-	copyCnstTestVectorStr(std, ft);
-	std::cout << "                            ASSIGNATION" << std::endl;
-	assignTestVector(std, ft);
-	assignTestVectorFloat(std, ft);
-	assignTestVectorStr(std, ft);
-	std::cout << "                            ITERATORS" << std::endl;
-	iteratorTestVector(std, ft, 1000);
-	constIteratorTestVector(std, ft, 1000);
-	reverseIteratorTestVector(std, ft, 10);
-	constReverseIteratorTestVector(std, ft, 10);
-	std::cout << "                            CAPACITY" << std::endl;
-	sizeTest(std, ft);
-	sizeTestFloat(std, ft);
-	sizeTestStr(std, ft);
-	maxSizeTest(std, ft);
-	maxSizeTestFloat(std, ft);
-	maxSizeTestStr(std, ft);
-	resizeTestIntVector(std, ft);
-	resizeTestFloatVector(std, ft);
-	resizeTestStrVector(std, ft);
-	capacityTestVector(std, ft);
-	capacityTestVectorFloat(std, ft);
-	capacityTestVectorStr(std, ft);
-	emptyVectorTest(std, ft);
-	emptyVectorTestFloat(std, ft);
-	emptyVectorTestStr(std, ft);
-	reserveVectorTest(std, ft);
-	reserveVectorFloatTest(std, ft);
-	reserveVectorStrTest(std, ft);
-	std::cout << "                            ELEMENT ACCESS" << std::endl;
-	squareBracketsTest(std, ft);
-	squareBracketsTestFloat(std, ft);
-	squareBracketsTestStr(std, ft);
-	atTest(std, ft);
-	atTestFloat(std, ft);
-	atTestStr(std, ft);
-	frontTest(std, ft);
-	frontTestFloat(std, ft);
-	frontTestStr(std, ft);
-	backTest(std, ft);
-	backTestFloat(std, ft);
-	backTestStr(std, ft);
-	std::cout << "                            MODIFIERS" << std::endl;
-	assignRangeTest(std, ft);
-	assignRangeTestFloat(std, ft);
-	assignRangeTestStr(std, ft);
-	assignFillTest(std, ft);
-	assignFillTestFloat(std, ft);
-	assignFillTestStr(std, ft);
-	pushBackVectorTest(std, ft);
-	pushBackVectorTestFloat(std, ft);
-	pushBackVectorTestStr(std, ft);
-	popBackVectorTest(std, ft);
-	popBackVectorTestFloat(std, ft);
-	popBackVectorTestStr(std, ft);
-	singleInsertVectorTest(std, ft);
-	singleInsertVectorTestFloat(std, ft);
-	singleInsertVectorTestStr(std, ft);
-	fillInsertVectorTest(std, ft);
-	fillInsertVectorTestFloat(std, ft);
-	fillInsertVectorTestStr(std, ft);
-	rangeInsertVectorTest(std, ft);
-	rangeInsertVectorTestFloat(std, ft);
-	rangeInsertVectorTestStr(std, ft);
-	singleEraseVectorTest(std, ft);
-	singleEraseVectorTestFloat(std, ft);
-	singleEraseVectorTestStr(std, ft);
-	rangeEraseVectorTest(std, ft);
-	rangeEraseVectorTestFloat(std, ft);
-	rangeEraseVectorTestStr(std, ft);
-	swapVectorTest(std, ft);
-	swapVectorTestFloat(std, ft);
-	swapVectorTestStr(std, ft);
-	clearVectorTest(std, ft);
-	clearVectorTestFloat(std, ft);
-	clearVectorTestStr(std, ft);
-	std::cout << "                            NON MEMBER FUNCTIONS OVERLOADS" << std::endl;
-	equalTestVector(std, ft);
-	equalTestVectorFloat(std, ft);
-	equalTestVectorStr(std, ft);
-	nonEqualTestVector(std, ft);
-	nonEqualTestVectorFloat(std, ft);
-	nonEqualTestVectorStr(std, ft);
-	lessTestVector(std, ft);
-	lessTestVectorFloat(std, ft);
-	lessTestVectorStr(std, ft);
-	lessOrEqualTestVector(std, ft);
-	lessOrEqualTestVectorFloat(std, ft);
-	lessOrEqualTestVectorStr(std, ft);
-	greaterTestVector(std, ft);
-	greaterTestVectorFloat(std, ft);
-	greaterTestVectorStr(std, ft);
-	greaterOrEqualTestVector(std, ft);
-	greaterOrEqualTestVectorFloat(std, ft);
-	greaterOrEqualTestVectorStr(std, ft);
-	swapNonMemberTestVector(std, ft);
-	swapNonMemberTestVectorFloat(std, ft);
-	swapNonMemberTestVectorStr(std, ft);
+void singleEraseVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Single erase int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	VectorPushBackElem(def, my, 100);
+	def.erase(def.begin() + 40);
+	my.erase(my.begin() + 40);
+	VectorFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
 }
 
-//MARK: - Default constructor map
-
-void defaultCnstTestMap(std::string &std, std::string &ft) {
-	std::cout << "Default constructor int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapFillStr(def, my, std, ft);
+void singleEraseVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Single erase float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 100);
+	def.erase(def.begin() + 40);
+	my.erase(my.begin() + 40);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -4988,11 +7049,14 @@ void defaultCnstTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void defaultCnstTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Default constructor float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapFillStr(def, my, std, ft);
+void singleEraseVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Single erase std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	VectorPushBackElem(def, my, 100);
+	def.erase(def.begin() + 40);
+	my.erase(my.begin() + 40);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5001,11 +7065,14 @@ void defaultCnstTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void defaultCnstTestMapStr(std::string &std, std::string &ft) {
-	std::cout << "Default constructor std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapFillStr(def, my, std, ft);
+void rangeEraseVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Range erase int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	VectorPushBackElem(def, my, 100);
+	def.erase(def.begin() + 40, def.begin() + 60);
+	my.erase(my.begin() + 40, my.begin() + 60);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5014,18 +7081,14 @@ void defaultCnstTestMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Range constructor map
-
-void rangeCnstTestMap(std::string &std, std::string &ft) {
-	std::cout << "Range constructor int test" << " ";
-	std::map<int, int> test;
-	for (int i = 0; i < 100; i++) {
-		std::pair<int, int> res(rand(), rand());
-		test.insert(res);
-	}
-	std::map<int, int> def(++test.begin(), --test.end());
-	ft::map<int, int> my(++test.begin(), --test.end());
-	mapFillStr(def, my, std, ft);
+void rangeEraseVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Range erase float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 100);
+	def.erase(def.begin() + 40, def.begin() + 60);
+	my.erase(my.begin() + 40, my.begin() + 60);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5034,16 +7097,14 @@ void rangeCnstTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeCnstTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Range constructor float test" << " ";
-	std::map<float, float> test;
-	for (int i = 0; i < 100; i++) {
-		std::pair<float, float> res(rand(), rand());
-		test.insert(res);
-	}
-	std::map<float, float> def(++test.begin(), --test.end());
-	ft::map<float, float> my(++test.begin(), --test.end());
-	mapFillStr(def, my, std, ft);
+void rangeEraseVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Range erase std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	VectorPushBackElem(def, my, 100);
+	def.erase(def.begin() + 40, def.begin() + 60);
+	my.erase(my.begin() + 40, my.begin() + 60);
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5052,20 +7113,22 @@ void rangeCnstTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeCnstTestMapStr(std::string &std, std::string &ft) {
-	std::cout << "Range constructor std::string test" << " ";
-	std::map<std::string, std::string> test;
-	std::string key;
-	std::string value;
-	for (int i = 0; i < 100; i++) {
-		key += rand();
-		value += rand();
-		std::pair<std::string, std::string> res(key, value);
-		test.insert(res);
-	}
-	std::map<std::string, std::string> def(++test.begin(), --test.end());
-	ft::map<std::string, std::string> my(++test.begin(), --test.end());
-	mapFillStr(def, my, std, ft);
+//MARK: - Swap vector
+
+void swapVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Swap int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	std::vector<int> toSwap;
+	ft::vector<int> mySwap;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(toSwap, mySwap, 50);
+	VectorFillStr(def, my, std, ft);
+	VectorFillStr(toSwap, mySwap, std, ft);
+	def.swap(toSwap);
+	my.swap(mySwap);
+	VectorFillStr(def, my, std, ft);
+	VectorFillStr(toSwap, mySwap, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5074,14 +7137,20 @@ void rangeCnstTestMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Copy constructor map
-
-void copyCnstTestMap(std::string &std, std::string &ft) {
-	std::cout << "Copy constructor int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
+void swapVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Swap float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	std::vector<float> toSwap;
+	ft::vector<float> mySwap;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(toSwap, mySwap, 50);
+	VectorFillStr(def, my, std, ft);
+	VectorFillStr(toSwap, mySwap, std, ft);
+	def.swap(toSwap);
+	my.swap(mySwap);
+	VectorFillStr(def, my, std, ft);
+	VectorFillStr(toSwap, mySwap, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5090,12 +7159,20 @@ void copyCnstTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void copyCnstTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Copy constructor float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
+void swapVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Swap std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	std::vector<std::string> toSwap;
+	ft::vector<std::string> mySwap;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(toSwap, mySwap, 50);
+	VectorFillStr(def, my, std, ft);
+	VectorFillStr(toSwap, mySwap, std, ft);
+	def.swap(toSwap);
+	my.swap(mySwap);
+	VectorFillStr(def, my, std, ft);
+	VectorFillStr(toSwap, mySwap, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5104,12 +7181,17 @@ void copyCnstTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void copyCnstTestMapStr(std::string &std, std::string &ft) {
-	std::cout << "Copy constructor std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
+//MARK: - Clear vector
+
+void clearVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Clear int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	VectorPushBackElem(def, my, 100);
+	VectorFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5118,21 +7200,15 @@ void copyCnstTestMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Assignation map
-
-void assignTestMap(std::string &std, std::string &ft) {
-	std::cout << "Assignation int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	std::map<int, int> test;
-	ft::map<int, int> myTest;
-	mapInsertElem(test, myTest, 100);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(test, myTest, std, ft);
-	def = test;
-	my = myTest;
-	mapFillStr(def, my, std, ft);
-	mapFillStr(test, myTest, std, ft);
+void clearVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Clear float test" << " ";
+	std::vector<float> def;
+	ft::vector<float> my;
+	VectorPushBackElem(def, my, 100);
+	VectorFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5141,19 +7217,15 @@ void assignTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Assignation float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	std::map<float, float> test;
-	ft::map<float, float> myTest;
-	mapInsertElem(test, myTest, 100);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(test, myTest, std, ft);
-	def = test;
-	my = myTest;
-	mapFillStr(def, my, std, ft);
-	mapFillStr(test, myTest, std, ft);
+void clearVectorTestStr(std::string &std, std::string &ft) {
+	std::cout << "Clear std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	VectorPushBackElem(def, my, 100);
+	VectorFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5162,19 +7234,18 @@ void assignTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void assignTestMapStr(std::string &std, std::string &ft) {
-	std::cout << "Assignation std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	std::map<std::string, std::string> test;
-	ft::map<std::string, std::string> myTest;
-	mapInsertElem(test, myTest, 100);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(test, myTest, std, ft);
-	def = test;
-	my = myTest;
-	mapFillStr(def, my, std, ft);
-	mapFillStr(test, myTest, std, ft);
+void lifetimeTestVector(std::string &std, std::string &ft) {
+	std::cout << "Element lifetime test" << " ";
+	{
+		std::vector<LiveCounter> def;
+		lifetimeSteps(def, std);
+	}
+	std += LiveCounter::live;
+	{
+		ft::vector<LiveCounter> my;
+		lifetimeSteps(my, ft);
+	}
+	ft += LiveCounter::live;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5183,43 +7254,24 @@ void assignTestMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Iterator map
+//MARK: - Non member vector
 
-void iteratorTestMap(std::string &std, std::string &ft, int number) {
-	std::map<int,int> testStd;
-	ft::map<int,int> testFt;
-	std::cout << "All iterator test" << " ";
-	for (int i = 0; i < number; i++) {
-		std::pair<int, int> res(rand(), rand());
-		testStd.insert(res);
-		testFt.insert(res);
-	}
-	std::map<int,int>::iterator it = testStd.begin();
-	std::map<int,int>::iterator ite = testStd.end();
-	ft::map<int,int>::iterator itm = testFt.begin();
-	ft::map<int,int>::iterator item = testFt.end();
-	while (it != ite) {
-		std += it->first;
-		std += it->second;
-		it++;
-	}
-	while (itm != item) {
-		ft += itm->first;
-		ft += itm->second;
-		itm++;
-	}
-	it = testStd.begin();
-	itm = testFt.begin();
-	while (ite != it) {
-		ite--;
-		std += ite->first;
-		std += ite->second;
-	}
-	while (item != itm) {
-		item--;
-		ft += item->first;
-		ft += item->second;
-	}
+void equalTestVector(std::string &std, std::string &ft) {
+	std::cout << "Equal int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	std::vector<int> def1;
+	ft::vector<int> my1;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(def1, my1, 50);
+	std += (def1 == def);
+	std += (def == def1);
+	std += (def == def);
+	std += (def1 == def1);
+	ft += (my1 == my);
+	ft += (my == my1);
+	ft += (my == my);
+	ft += (my1 == my1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5228,43 +7280,22 @@ void iteratorTestMap(std::string &std, std::string &ft, int number) {
 	ft.clear();
 }
 
-//MARK: - Const iteratot map
-
-void constIteratorTestMap(std::string &std, std::string &ft, int number) {
-	std::map<int,int> testStd;
-	ft::map<int,int> testFt;
-	std::cout << "All const_iterator test" << " ";
-	for (int i = 0; i < number; i++) {
-		std::pair<int, int> res(rand(), rand());
-		testStd.insert(res);
-		testFt.insert(res);
-	}
-	std::map<int,int>::const_iterator it = testStd.cbegin();
-	std::map<int,int>::const_iterator ite = testStd.cend();
-	ft::map<int,int>::const_iterator itm = testFt.cbegin();
-	ft::map<int,int>::const_iterator item = testFt.cend();
-	while (it != ite) {
-		std += it->first;
-		std += it->second;
-		it++;
-	}
-	while (itm != item) {
-		ft += itm->first;
-		ft += itm->second;
-		itm++;
-	}
-	it = testStd.cbegin();
-	itm = testFt.cbegin();
-	while (ite != it) {
-		ite--;
-		std += ite->first;
-		std += ite->second;
-	}
-	while (item != itm) {
-		item--;
-		ft += item->first;
-		ft += item->second;
-	}
+void equalTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Equal float test" << " ";
+	std::vector<float> defFloat;
+	ft::vector<float> myFloat;
+	std::vector<float> defFloat1;
+	ft::vector<float> myFloat1;
+	VectorPushBackElem(defFloat, myFloat, 100);
+	VectorPushBackElem(defFloat1, myFloat1, 50);
+	std += (defFloat1 == defFloat);
+	std += (defFloat == defFloat1);
+	std += (defFloat == defFloat);
+	std += (defFloat1 == defFloat1);
+	ft += (myFloat1 == myFloat);
+	ft += (myFloat == myFloat1);
+	ft += (myFloat == myFloat);
+	ft += (myFloat1 == myFloat1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5273,43 +7304,22 @@ void constIteratorTestMap(std::string &std, std::string &ft, int number) {
 	ft.clear();
 }
 
-//MARK: - Reverse iteratot map
-
-void reverseIteratorTestMap(std::string &std, std::string &ft, int number) {
-	std::map<int,int> testStd;
-	ft::map<int,int> testFt;
-	std::cout << "All reverse_iterator test" << " ";
-	for (int i = 0; i < number; i++) {
-		std::pair<int, int> res(rand(), rand());
-		testStd.insert(res);
-		testFt.insert(res);
-	}
-	std::map<int,int>::reverse_iterator it = testStd.rbegin();
-	std::map<int,int>::reverse_iterator ite = testStd.rend();
-	ft::map<int,int>::reverse_iterator itm = testFt.rbegin();
-	ft::map<int,int>::reverse_iterator item = testFt.rend();
-	while (it != ite) {
-		std += it->first;
-		std += it->second;
-		it++;
-	}
-	while (itm != item) {
-		ft += itm->first;
-		ft += itm->second;
-		itm++;
-	}
-	it = testStd.rbegin();
-	itm = testFt.rbegin();
-	while (ite != it) {
-		ite--;
-		std += ite->first;
-		std += ite->second;
-	}
-	while (item != itm) {
-		item--;
-		ft += item->first;
-		ft += item->second;
-	}
+void equalTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Equal std::string test" << " ";
+	std::vector<std::string> defStr;
+	ft::vector<std::string> myStr;
+	std::vector<std::string> defStr1;
+	ft::vector<std::string> myStr1;
+	VectorPushBackElem(defStr, myStr, 100);
+	VectorPushBackElem(defStr1, myStr1, 50);
+	std += (defStr1 == defStr);
+	std += (defStr == defStr1);
+	std += (defStr == defStr);
+	std += (defStr1 == defStr1);
+	ft += (myStr1 == myStr);
+	ft += (myStr == myStr1);
+	ft += (myStr == myStr);
+	ft += (myStr1 == myStr1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5318,43 +7328,22 @@ void reverseIteratorTestMap(std::string &std, std::string &ft, int number) {
 	ft.clear();
 }
 
-//MARK: - Const reverse iteratot map
-
-void constReverseIteratorTestMap(std::string &std, std::string &ft, int number) {
-	std::map<int,int> testStd;
-	ft::map<int,int> testFt;
-	std::cout << "All const_reverse_iterator test" << " ";
-	for (int i = 0; i < number; i++) {
-		std::pair<int, int> res(rand(), rand());
-		testStd.insert(res);
-		testFt.insert(res);
-	}
-	std::map<int,int>::const_reverse_iterator it = testStd.crbegin();
-	std::map<int,int>::const_reverse_iterator ite = testStd.crend();
-	ft::map<int,int>::const_reverse_iterator itm = testFt.crbegin();
-	ft::map<int,int>::const_reverse_iterator item = testFt.crend();
-	while (it != ite) {
-		std += it->first;
-		std += it->second;
-		it++;
-	}
-	while (itm != item) {
-		ft += itm->first;
-		ft += itm->second;
-		itm++;
-	}
-	it = testStd.crbegin();
-	itm = testFt.crbegin();
-	while (ite != it) {
-		ite--;
-		std += ite->first;
-		std += ite->second;
-	}
-	while (item != itm) {
-		item--;
-		ft += item->first;
-		ft += item->second;
-	}
+void nonEqualTestVector(std::string &std, std::string &ft) {
+	std::cout << "Non equal int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	std::vector<int> def1;
+	ft::vector<int> my1;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(def1, my1, 50);
+	std += (def1 != def);
+	std += (def != def1);
+	std += (def != def);
+	std += (def1 != def1);
+	ft += (my1 != my);
+	ft += (my != my1);
+	ft += (my != my);
+	ft += (my1 != my1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5363,17 +7352,22 @@ void constReverseIteratorTestMap(std::string &std, std::string &ft, int number)
 	ft.clear();
 }
 
-//MARK: - Empty map
-
-void emptyMapTest(std::string &std, std::string &ft) {
-	std::cout << "Empty int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	std += def.empty();
-	ft += my.empty();
-	mapInsertElem(def, my, 10);
-	std += def.empty();
-	ft += my.empty();
+void nonEqualTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Non equal float test" << " ";
+	std::vector<float> defFloat;
+	ft::vector<float> myFloat;
+	std::vector<float> defFloat1;
+	ft::vector<float> myFloat1;
+	VectorPushBackElem(defFloat, myFloat, 100);
+	VectorPushBackElem(defFloat1, myFloat1, 50);
+	std += (defFloat1 != defFloat);
+	std += (defFloat != defFloat1);
+	std += (defFloat != defFloat);
+	std += (defFloat1 != defFloat1);
+	ft += (myFloat1 != myFloat);
+	ft += (myFloat != myFloat1);
+	ft += (myFloat != myFloat);
+	ft += (myFloat1 != myFloat1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5382,15 +7376,22 @@ void emptyMapTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void emptyMapTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Empty float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	std += def.empty();
-	ft += my.empty();
-	mapInsertElem(def, my, 10);
-	std += def.empty();
-	ft += my.empty();
+void nonEqualTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Non equal std::string test" << " ";
+	std::vector<std::string> defStr;
+	ft::vector<std::string> myStr;
+	std::vector<std::string> defStr1;
+	ft::vector<std::string> myStr1;
+	VectorPushBackElem(defStr, myStr, 100);
+	VectorPushBackElem(defStr1, myStr1, 50);
+	std += (defStr1 != defStr);
+	std += (defStr != defStr1);
+	std += (defStr != defStr);
+	std += (defStr1 != defStr1);
+	ft += (myStr1 != myStr);
+	ft += (myStr != myStr1);
+	ft += (myStr != myStr);
+	ft += (myStr1 != myStr1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5399,15 +7400,22 @@ void emptyMapTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void emptyMapTestStr(std::string &std, std::string &ft) {
-	std::cout << "Empty std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	std += def.empty();
-	ft += my.empty();
-	mapInsertElem(def, my, 10);
-	std += def.empty();
-	ft += my.empty();
+void lessTestVector(std::string &std, std::string &ft) {
+	std::cout << "Less int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	std::vector<int> def1;
+	ft::vector<int> my1;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(def1, my1, 50);
+	std += (def1 < def);
+	ft += (my1 < my);
+	std += (def < def1);
+	ft += (my < my1);
+	std += (def < def);
+	ft += (my < my);
+	std += (def1 < def1);
+	ft += (my1 < my1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5416,17 +7424,22 @@ void emptyMapTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Size map
-
-void sizeMapTest(std::string &std, std::string &ft) {
-	std::cout << "Size int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	std += def.size();
-	ft += my.size();
-	mapInsertElem(def, my, 10);
-	std += def.size();
-	ft += my.size();
+void lessTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Less float test" << " ";
+	std::vector<float> defFloat;
+	ft::vector<float> myFloat;
+	std::vector<float> defFloat1;
+	ft::vector<float> myFloat1;
+	VectorPushBackElem(defFloat, myFloat, 100);
+	VectorPushBackElem(defFloat1, myFloat1, 50);
+	std += (defFloat1 < defFloat);
+	ft += (myFloat1 < myFloat);
+	std += (defFloat < defFloat1);
+	ft += (myFloat < myFloat1);
+	std += (defFloat < defFloat);
+	ft += (myFloat < myFloat);
+	std += (defFloat1 < defFloat1);
+	ft += (myFloat1 < myFloat1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5435,32 +7448,22 @@ void sizeMapTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void sizeMapTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Size float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	std += def.size();
-	ft += my.size();
-	mapInsertElem(def, my, 10);
-	std += def.size();
-	ft += my.size();
-	if (std == ft)
-		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
-	else
-		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
-	std.clear();
-	ft.clear();
-}
-
-void sizeMapTestStr(std::string &std, std::string &ft) {
-	std::cout << "Size std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	std += def.size();
-	ft += my.size();
-	mapInsertElem(def, my, 10);
-	std += def.size();
-	ft += my.size();
+void lessTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Less std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	std::vector<std::string> def1;
+	ft::vector<std::string> my1;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(def1, my1, 50);
+	std += (def < def1);
+	ft += (my < my1);
+	std += (def1 < def);
+	ft += (my1 < my);
+	std += (def < def);
+	ft += (my < my);
+	std += (def1 < def1);
+	ft += (my1 < my1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5469,14 +7472,22 @@ void sizeMapTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Max size map
-
-void maxSizeTestMap(std::string &std, std::string &ft) {
-	std::cout << "Max size int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	std += def.max_size();
-	ft += my.max_size();
+void lessOrEqualTestVector(std::string &std, std::string &ft) {
+	std::cout << "Less or equal int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	std::vector<int> def1;
+	ft::vector<int> my1;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(def1, my1, 50);
+	std += (def1 <= def);
+	std += (def <= def1);
+	std += (def <= def);
+	std += (def1 <= def1);
+	ft += (my1 <= my);
+	ft += (my <= my1);
+	ft += (my <= my);
+	ft += (my1 <= my1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5485,12 +7496,22 @@ void maxSizeTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void maxSizeTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Max size float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	std += def.max_size();
-	ft += my.max_size();
+void lessOrEqualTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Less or equal float test" << " ";
+	std::vector<float> defFloat;
+	ft::vector<float> myFloat;
+	std::vector<float> defFloat1;
+	ft::vector<float> myFloat1;
+	VectorPushBackElem(defFloat, myFloat, 100);
+	VectorPushBackElem(defFloat1, myFloat1, 50);
+	std += (defFloat1 <= defFloat);
+	std += (defFloat <= defFloat1);
+	std += (defFloat <= defFloat);
+	std += (defFloat1 <= defFloat1);
+	ft += (myFloat1 <= myFloat);
+	ft += (myFloat <= myFloat1);
+	ft += (myFloat <= myFloat);
+	ft += (myFloat1 <= myFloat1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5499,22 +7520,22 @@ void maxSizeTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Operator [] map
-
-void squareBracketsTestMap(std::string &std, std::string &ft) {
-	std::cout << "Opetator[] int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::pair<int, int> test(21, 42);
-	def.insert(test);
-	my.insert(test);
-	std += def[21];
-	ft += my[21];
-	std += def[42];
-	ft += my[42];
-	std += def[42];
-	ft += my[42];
+void lessOrEqualTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Less or equal std::string test" << " ";
+	std::vector<std::string> defStr;
+	ft::vector<std::string> myStr;
+	std::vector<std::string> defStr1;
+	ft::vector<std::string> myStr1;
+	VectorPushBackElem(defStr, myStr, 100);
+	VectorPushBackElem(defStr1, myStr1, 50);
+	std += (defStr1 <= defStr);
+	std += (defStr <= defStr1);
+	std += (defStr <= defStr);
+	std += (defStr1 <= defStr1);
+	ft += (myStr1 <= myStr);
+	ft += (myStr <= myStr1);
+	ft += (myStr <= myStr);
+	ft += (myStr1 <= myStr1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5523,20 +7544,22 @@ void squareBracketsTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void squareBracketsTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Opetator[] float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::pair<float, float> test(21, 42);
-	def.insert(test);
-	my.insert(test);
-	std += def[21];
-	ft += my[21];
-	std += def[42];
-	ft += my[42];
-	std += def[42];
-	ft += my[42];
+void greaterTestVector(std::string &std, std::string &ft) {
+	std::cout << "Greater int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	std::vector<int> def1;
+	ft::vector<int> my1;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(def1, my1, 50);
+	std += (def1 > def);
+	std += (def > def1);
+	std += (def > def);
+	std += (def1 > def1);
+	ft += (my1 > my);
+	ft += (my > my1);
+	ft += (my > my);
+	ft += (my1 > my1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5545,20 +7568,22 @@ void squareBracketsTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void squareBracketsTestMapStr(std::string &std, std::string &ft) {
-	std::cout << "Opetator[] std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::string, std::string> test("21", "42");
-	def.insert(test);
-	my.insert(test);
-	std += def["21"];
-	ft += my["21"];
-	std += def["42"];
-	ft += my["42"];
-	std += def["42"];
-	ft += my["42"];
+void greaterTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Greater float test" << " ";
+	std::vector<float> defFloat;
+	ft::vector<float> myFloat;
+	std::vector<float> defFloat1;
+	ft::vector<float> myFloat1;
+	VectorPushBackElem(defFloat, myFloat, 100);
+	VectorPushBackElem(defFloat1, myFloat1, 50);
+	std += (defFloat > defFloat1);
+	std += (defFloat1 > defFloat);
+	std += (defFloat > defFloat);
+	std += (defFloat1 > defFloat1);
+	ft += (myFloat > myFloat1);
+	ft += (myFloat1 > myFloat);
+	ft += (myFloat > myFloat);
+	ft += (myFloat1 > myFloat1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5567,17 +7592,22 @@ void squareBracketsTestMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Insert map
-
-void singleInsertMap(std::string &std, std::string &ft) {
-	std::cout << "Single insert int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapFillStr(def, my, std, ft);
-	std::pair<int, int> test(42, 21);
-	def.insert(test);
-	my.insert(test);
-	mapFillStr(def, my, std, ft);
+void greaterTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Greater std::string test" << " ";
+	std::vector<std::string> defStr;
+	ft::vector<std::string> myStr;
+	std::vector<std::string> defStr1;
+	ft::vector<std::string> myStr1;
+	VectorPushBackElem(defStr, myStr, 100);
+	VectorPushBackElem(defStr1, myStr1, 50);
+	std += (defStr > defStr1);
+	std += (defStr1 > defStr);
+	std += (defStr > defStr);
+	std += (defStr1 > defStr1);
+	ft += (myStr > myStr1);
+	ft += (myStr1 > myStr);
+	ft += (myStr > myStr);
+	ft += (myStr1 > myStr1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5586,15 +7616,22 @@ void singleInsertMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void singleInsertMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Single insert float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapFillStr(def, my, std, ft);
-	std::pair<float, float> test(42.21, 21.42);
-	def.insert(test);
-	my.insert(test);
-	mapFillStr(def, my, std, ft);
+void greaterOrEqualTestVector(std::string &std, std::string &ft) {
+	std::cout << "Greater or equal int test" << " ";
+	std::vector<int> def;
+	ft::vector<int> my;
+	std::vector<int> def1;
+	ft::vector<int> my1;
+	VectorPushBackElem(def, my, 100);
+	VectorPushBackElem(def1, my1, 50);
+	std += (def >= def1);
+	std += (def1 >= def);
+	std += (def >= def);
+	std += (def1 >= def1);
+	ft += (my >= my1);
+	ft += (my1 >= my);
+	ft += (my >= my);
+	ft += (my1 >= my1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5603,15 +7640,22 @@ void singleInsertMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void singleInsertMapStr(std::string &std, std::string &ft) {
-	std::cout << "Single insert std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapFillStr(def, my, std, ft);
-	std::pair<std::string, std::string> test("42", "21");
-	def.insert(test);
-	my.insert(test);
-	mapFillStr(def, my, std, ft);
+void greaterOrEqualTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Greater or equal float test" << " ";
+	std::vector<float> defFloat;
+	ft::vector<float> myFloat;
+	std::vector<float> defFloat1;
+	ft::vector<float> myFloat1;
+	VectorPushBackElem(defFloat, myFloat, 100);
+	VectorPushBackElem(defFloat1, myFloat1, 50);
+	std += (defFloat >= defFloat1);
+	std += (defFloat1 >= defFloat);
+	std += (defFloat >= defFloat);
+	std += (defFloat1 >= defFloat1);
+	ft += (myFloat >= myFloat1);
+	ft += (myFloat1 >= myFloat);
+	ft += (myFloat >= myFloat);
+	ft += (myFloat1 >= myFloat1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5620,49 +7664,22 @@ void singleInsertMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void withHitInsertMap(std::string &std, std::string &ft) {
-	std::cout << "With hit insert int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapFillStr(def, my, std, ft);
-	std::pair<int, int> test(42, 21);
-	def.insert(def.begin(),test);
-	my.insert(my.begin(), test);
-	mapFillStr(def, my, std, ft);
-	if (std == ft)
-		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
-	else
-		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
-	std.clear();
-	ft.clear();
-}
-
-void withHitInsertMapFloat(std::string &std, std::string &ft) {
-	std::cout << "With hit insert float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapFillStr(def, my, std, ft);
-	std::pair<float, float> test(42.21, 21.42);
-	def.insert(def.begin(),test);
-	my.insert(my.begin(), test);
-	mapFillStr(def, my, std, ft);
-	if (std == ft)
-		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
-	else
-		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
-	std.clear();
-	ft.clear();
-}
-
-void withHitInsertMapStr(std::string &std, std::string &ft) {
-	std::cout << "With hit insert std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapFillStr(def, my, std, ft);
-	std::pair<std::string, std::string> test("42", "21");
-	def.insert(def.begin(),test);
-	my.insert(my.begin(), test);
-	mapFillStr(def, my, std, ft);
+void greaterOrEqualTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Greater or equal std::string test" << " ";
+	std::vector<std::string> defStr;
+	ft::vector<std::string> myStr;
+	std::vector<std::string> defStr1;
+	ft::vector<std::string> myStr1;
+	VectorPushBackElem(defStr, myStr, 100);
+	VectorPushBackElem(defStr1, myStr1, 50);
+	std += (defStr >= defStr1);
+	std += (defStr1 >= defStr);
+	std += (defStr >= defStr);
+	std += (defStr1 >= defStr1);
+	ft += (myStr >= myStr1);
+	ft += (myStr1 >= myStr);
+	ft += (myStr >= myStr);
+	ft += (myStr1 >= myStr1);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5671,18 +7688,238 @@ void withHitInsertMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeInsertMapTest(std::string &std, std::string &ft) {
-	std::cout << "Range insert int test" << " ";
-	std::map<int, int> test;
-	for (int i = 0; i < 100; i++) {
-		std::pair<int, int> l(rand(), rand());
-		test.insert(l);
+void simdSearchTestVector(std::string &std, std::string &ft) {
+	std::cout << "SIMD search and compare int test" << " ";
+	size_t sizes[] = {0, 1, 7, 16, 33, 100};
+	ft::simd::level levels[] = {ft::simd::scalar_level, ft::simd::sse2_level, ft::simd::avx2_level};
+	for (size_t l = 0; l < 3; l++) {
+		ft::simd::set_level(levels[l]);
+		for (size_t s = 0; s < 6; s++) {
+			std::vector<int> def;
+			ft::vector<int> my;
+			parallelPushElem(def, my, sizes[s]);
+			int val = def.size() > 3 ? def[3] : int();
+			std += std::find(def.begin(), def.end(), val) - def.begin();
+			ft += ft::find(my, val) - my.cbegin();
+			std += std::count(def.begin(), def.end(), val);
+			ft += ft::count(my, val);
+			std += std::min_element(def.begin(), def.end()) - def.begin();
+			ft += ft::min_element(my) - my.cbegin();
+			std += std::max_element(def.begin(), def.end()) - def.begin();
+			ft += ft::max_element(my) - my.cbegin();
+			std::vector<int> defCopy(def);
+			ft::vector<int> myCopy(my);
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			if (sizes[s] != 0) {
+				defCopy[sizes[s] / 2] = 30;
+				myCopy[sizes[s] / 2] = 30;
+			}
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (defCopy < def);
+			ft += (myCopy < my);
+			defCopy.push_back(val);
+			myCopy.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (def >= defCopy);
+			ft += (my >= myCopy);
+		}
 	}
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	def.insert(test.begin(), test.end());
-	my.insert(test.begin(), test.end());
-	mapFillStr(def, my, std, ft);
+	ft::simd::set_level(ft::simd::supported_level());
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void simdSearchTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "SIMD search and compare float test" << " ";
+	size_t sizes[] = {0, 1, 7, 16, 33, 100};
+	ft::simd::level levels[] = {ft::simd::scalar_level, ft::simd::sse2_level, ft::simd::avx2_level};
+	for (size_t l = 0; l < 3; l++) {
+		ft::simd::set_level(levels[l]);
+		for (size_t s = 0; s < 6; s++) {
+			std::vector<float> def;
+			ft::vector<float> my;
+			parallelPushElem(def, my, sizes[s]);
+			float val = def.size() > 3 ? def[3] : float();
+			std += std::find(def.begin(), def.end(), val) - def.begin();
+			ft += ft::find(my, val) - my.cbegin();
+			std += std::count(def.begin(), def.end(), val);
+			ft += ft::count(my, val);
+			std += std::min_element(def.begin(), def.end()) - def.begin();
+			ft += ft::min_element(my) - my.cbegin();
+			std += std::max_element(def.begin(), def.end()) - def.begin();
+			ft += ft::max_element(my) - my.cbegin();
+			std::vector<float> defCopy(def);
+			ft::vector<float> myCopy(my);
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			if (sizes[s] != 0) {
+				defCopy[sizes[s] / 2] = 30;
+				myCopy[sizes[s] / 2] = 30;
+			}
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (defCopy < def);
+			ft += (myCopy < my);
+			defCopy.push_back(val);
+			myCopy.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (def >= defCopy);
+			ft += (my >= myCopy);
+		}
+	}
+	ft::simd::set_level(ft::simd::supported_level());
+	std::vector<float> def(40, 1.0f);
+	ft::vector<float> my(40, 1.0f);
+	std::vector<float> defCopy(def);
+	ft::vector<float> myCopy(my);
+	def[5] = 0.0f;
+	my[5] = 0.0f;
+	defCopy[5] = -0.0f;
+	myCopy[5] = -0.0f;
+	std += (def == defCopy);
+	ft += (my == myCopy);
+	def[20] = std::numeric_limits<float>::quiet_NaN();
+	my[20] = std::numeric_limits<float>::quiet_NaN();
+	defCopy[20] = std::numeric_limits<float>::quiet_NaN();
+	myCopy[20] = std::numeric_limits<float>::quiet_NaN();
+	std += (def == defCopy);
+	ft += (my == myCopy);
+	defCopy[30] = 2.0f;
+	myCopy[30] = 2.0f;
+	std += (def < defCopy);
+	ft += (my < myCopy);
+	std += std::min_element(def.begin(), def.end()) - def.begin();
+	ft += ft::min_element(my) - my.cbegin();
+	std += std::max_element(defCopy.begin(), defCopy.end()) - defCopy.begin();
+	ft += ft::max_element(myCopy) - myCopy.cbegin();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void simdSearchTestVectorChar(std::string &std, std::string &ft) {
+	std::cout << "SIMD search and compare char test" << " ";
+	size_t sizes[] = {0, 1, 7, 16, 33, 100};
+	ft::simd::level levels[] = {ft::simd::scalar_level, ft::simd::sse2_level, ft::simd::avx2_level};
+	for (size_t l = 0; l < 3; l++) {
+		ft::simd::set_level(levels[l]);
+		for (size_t s = 0; s < 6; s++) {
+			std::vector<char> def;
+			ft::vector<char> my;
+			parallelPushElem(def, my, sizes[s]);
+			char val = def.size() > 3 ? def[3] : char();
+			std += std::find(def.begin(), def.end(), val) - def.begin();
+			ft += ft::find(my, val) - my.cbegin();
+			std += std::count(def.begin(), def.end(), val);
+			ft += ft::count(my, val);
+			std += std::min_element(def.begin(), def.end()) - def.begin();
+			ft += ft::min_element(my) - my.cbegin();
+			std += std::max_element(def.begin(), def.end()) - def.begin();
+			ft += ft::max_element(my) - my.cbegin();
+			std::vector<char> defCopy(def);
+			ft::vector<char> myCopy(my);
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			if (sizes[s] != 0) {
+				defCopy[sizes[s] / 2] = 30;
+				myCopy[sizes[s] / 2] = 30;
+			}
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (defCopy < def);
+			ft += (myCopy < my);
+			defCopy.push_back(val);
+			myCopy.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (def >= defCopy);
+			ft += (my >= myCopy);
+		}
+	}
+	ft::simd::set_level(ft::simd::supported_level());
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void simdSearchTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "SIMD search and compare std::string test" << " ";
+	size_t sizes[] = {0, 1, 7, 16, 33, 100};
+	ft::simd::level levels[] = {ft::simd::scalar_level, ft::simd::sse2_level, ft::simd::avx2_level};
+	for (size_t l = 0; l < 3; l++) {
+		ft::simd::set_level(levels[l]);
+		for (size_t s = 0; s < 6; s++) {
+			std::vector<std::string> def;
+			ft::vector<std::string> my;
+			parallelPushElem(def, my, sizes[s]);
+			std::string val = def.size() > 3 ? def[3] : std::string();
+			std += std::find(def.begin(), def.end(), val) - def.begin();
+			ft += ft::find(my, val) - my.cbegin();
+			std += std::count(def.begin(), def.end(), val);
+			ft += ft::count(my, val);
+			std += std::min_element(def.begin(), def.end()) - def.begin();
+			ft += ft::min_element(my) - my.cbegin();
+			std += std::max_element(def.begin(), def.end()) - def.begin();
+			ft += ft::max_element(my) - my.cbegin();
+			std::vector<std::string> defCopy(def);
+			ft::vector<std::string> myCopy(my);
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			if (sizes[s] != 0) {
+				defCopy[sizes[s] / 2] = 30;
+				myCopy[sizes[s] / 2] = 30;
+			}
+			std += (def == defCopy);
+			ft += (my == myCopy);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (defCopy < def);
+			ft += (myCopy < my);
+			defCopy.push_back(val);
+			myCopy.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			def.push_back(val);
+			my.push_back(val);
+			std += (def < defCopy);
+			ft += (my < myCopy);
+			std += (def >= defCopy);
+			ft += (my >= myCopy);
+		}
+	}
+	ft::simd::set_level(ft::simd::supported_level());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5691,18 +7928,47 @@ void rangeInsertMapTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeInsertMapTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Range insert float test" << " ";
-	std::map<float, float> test;
+void alignedStorageTestVector(std::string &std, std::string &ft) {
+	std::cout << "Aligned storage int test" << " ";
+	std::vector<int> def;
+	ft::vector<int, ft::aligned_allocator<int, 64>, ft::aligned_growth<64> > my;
+	bool aligned = true;
 	for (int i = 0; i < 100; i++) {
-		std::pair<float, float> l(rand(), rand());
-		test.insert(l);
+		int val;
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+		aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+		aligned = aligned && my.capacity() * sizeof(int) % 64 == 0;
 	}
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	def.insert(test.begin(), test.end());
-	my.insert(test.begin(), test.end());
-	mapFillStr(def, my, std, ft);
+	def.insert(def.begin() + 10, 50, def[3]);
+	my.insert(my.begin() + 10, 50, my[3]);
+	aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+	def.erase(def.begin(), def.begin() + 7);
+	my.erase(my.begin(), my.begin() + 7);
+	my.shrink_to_fit();
+	def.shrink_to_fit();
+	aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+	aligned = aligned && my.capacity() * sizeof(int) % 64 == 0;
+	std += true;
+	ft += aligned;
+	std += def.size();
+	ft += my.size();
+	for (size_t i = 0; i < def.size(); i++) {
+		std += (def[i] == def[(i * 7) % def.size()]);
+		ft += (my[i] == my[(i * 7) % my.size()]);
+		std += (def[i] < def[(i * 3) % def.size()]);
+		ft += (my[i] < my[(i * 3) % my.size()]);
+	}
+	ft::vector<int, ft::aligned_allocator<int, 64>, ft::aligned_growth<64> > myCopy(my);
+	std += true;
+	ft += (reinterpret_cast<size_t>(myCopy.begin().data) % 64 == 0 && my == myCopy);
+	std += true;
+	ft += myCopy.capacity() * sizeof(int) % 64 == 0;
+	struct Triple { int a; int b; int c; };
+	ft::vector<Triple, ft::aligned_allocator<Triple, 64>, ft::aligned_growth<64> > triples(10, Triple());
+	std += true;
+	ft += (triples.capacity() >= 10 && triples.capacity() * sizeof(Triple) % 64 == 0);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5711,22 +7977,43 @@ void rangeInsertMapTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void rangeInsertMapTestStr(std::string &std, std::string &ft) {
-	std::cout << "Range insert std::string test" << " ";
-	std::map<std::string, std::string> test;
+void alignedStorageTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Aligned storage float test" << " ";
+	std::vector<float> def;
+	ft::vector<float, ft::aligned_allocator<float, 64>, ft::aligned_growth<64> > my;
+	bool aligned = true;
 	for (int i = 0; i < 100; i++) {
-		std::string l1;
-		std::string l2;
-		l1 += rand();
-		l2 += rand();
-		std::pair<std::string, std::string> l(l1, l2);
-		test.insert(l);
+		float val;
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+		aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+		aligned = aligned && my.capacity() * sizeof(float) % 64 == 0;
 	}
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	def.insert(test.begin(), test.end());
-	my.insert(test.begin(), test.end());
-	mapFillStr(def, my, std, ft);
+	def.insert(def.begin() + 10, 50, def[3]);
+	my.insert(my.begin() + 10, 50, my[3]);
+	aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+	def.erase(def.begin(), def.begin() + 7);
+	my.erase(my.begin(), my.begin() + 7);
+	my.shrink_to_fit();
+	def.shrink_to_fit();
+	aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+	aligned = aligned && my.capacity() * sizeof(float) % 64 == 0;
+	std += true;
+	ft += aligned;
+	std += def.size();
+	ft += my.size();
+	for (size_t i = 0; i < def.size(); i++) {
+		std += (def[i] == def[(i * 7) % def.size()]);
+		ft += (my[i] == my[(i * 7) % my.size()]);
+		std += (def[i] < def[(i * 3) % def.size()]);
+		ft += (my[i] < my[(i * 3) % my.size()]);
+	}
+	ft::vector<float, ft::aligned_allocator<float, 64>, ft::aligned_growth<64> > myCopy(my);
+	std += true;
+	ft += (reinterpret_cast<size_t>(myCopy.begin().data) % 64 == 0 && my == myCopy);
+	std += true;
+	ft += myCopy.capacity() * sizeof(float) % 64 == 0;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5735,42 +8022,43 @@ void rangeInsertMapTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Erase map
-
-void eraseSingleMapTest(std::string &std, std::string &ft) {
-	std::cout << "Single erase int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
-	std::map<int, int>::iterator it = def.begin();
-	ft::map<int, int>::iterator mit = my.begin();
-	for (int i = 0; i < 10; i++) {
-		it++;
-		mit++;
-	}
-	for (int i = 0; i < 40; i++) {
-		std::map<int, int>::iterator tmp = it;
-		ft::map<int, int>::iterator mtmp = mit;
-		it++;
-		mit++;
-		def.erase(tmp);
-		my.erase(mtmp);
-		mapFillStr(def, my, std, ft);
+void alignedStorageTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Aligned storage std::string test" << " ";
+	std::vector<std::string> def;
+	ft::vector<std::string, ft::aligned_allocator<std::string, 64>, ft::aligned_growth<64> > my;
+	bool aligned = true;
+	for (int i = 0; i < 100; i++) {
+		std::string val;
+		val = rand() % 20;
+		def.push_back(val);
+		my.push_back(val);
+		aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+		aligned = aligned && my.capacity() * sizeof(std::string) % 64 == 0;
 	}
-	it = def.end();
-	mit = my.end();
-	it--;
-	mit--;
-	for (int i = 0; i < 20; i++) {
-		std::map<int, int>::iterator tmp = it;
-		ft::map<int, int>::iterator mtmp = mit;
-		it--;
-		mit--;
-		def.erase(tmp);
-		my.erase(mtmp);
-		mapFillStr(def, my, std, ft);
+	def.insert(def.begin() + 10, 50, def[3]);
+	my.insert(my.begin() + 10, 50, my[3]);
+	aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+	def.erase(def.begin(), def.begin() + 7);
+	my.erase(my.begin(), my.begin() + 7);
+	my.shrink_to_fit();
+	def.shrink_to_fit();
+	aligned = aligned && reinterpret_cast<size_t>(my.begin().data) % 64 == 0;
+	aligned = aligned && my.capacity() * sizeof(std::string) % 64 == 0;
+	std += true;
+	ft += aligned;
+	std += def.size();
+	ft += my.size();
+	for (size_t i = 0; i < def.size(); i++) {
+		std += (def[i] == def[(i * 7) % def.size()]);
+		ft += (my[i] == my[(i * 7) % my.size()]);
+		std += (def[i] < def[(i * 3) % def.size()]);
+		ft += (my[i] < my[(i * 3) % my.size()]);
 	}
+	ft::vector<std::string, ft::aligned_allocator<std::string, 64>, ft::aligned_growth<64> > myCopy(my);
+	std += true;
+	ft += (reinterpret_cast<size_t>(myCopy.begin().data) % 64 == 0 && my == myCopy);
+	std += true;
+	ft += myCopy.capacity() * sizeof(std::string) % 64 == 0;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5779,40 +8067,30 @@ void eraseSingleMapTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseSingleMapTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Single erase float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
-	std::map<float, float>::iterator it = def.begin();
-	ft::map<float, float>::iterator mit = my.begin();
-	for (int i = 0; i < 10; i++) {
-		it++;
-		mit++;
-	}
-	for (int i = 0; i < 40; i++) {
-		std::map<float, float>::iterator tmp = it;
-		ft::map<float, float>::iterator mtmp = mit;
-		it++;
-		mit++;
-		def.erase(tmp);
-		my.erase(mtmp);
-		mapFillStr(def, my, std, ft);
-	}
-	it = def.end();
-	mit = my.end();
-	it--;
-	mit--;
-	for (int i = 0; i < 20; i++) {
-		std::map<float, float>::iterator tmp = it;
-		ft::map<float, float>::iterator mtmp = mit;
-		it--;
-		mit--;
-		def.erase(tmp);
-		my.erase(mtmp);
-		mapFillStr(def, my, std, ft);
+void simdDotTestVector(std::string &std, std::string &ft) {
+	std::cout << "SIMD dot product int test" << " ";
+	size_t sizes[] = {0, 1, 7, 16, 33, 100};
+	ft::simd::level levels[] = {ft::simd::scalar_level, ft::simd::sse2_level, ft::simd::avx2_level};
+	for (size_t l = 0; l < 3; l++) {
+		ft::simd::set_level(levels[l]);
+		for (size_t s = 0; s < 6; s++) {
+			std::vector<int> def;
+			std::vector<int> defOther;
+			ft::vector<int> my;
+			ft::vector<int, ft::aligned_allocator<int, 64>, ft::aligned_growth<64> > myOther;
+			for (size_t i = 0; i < sizes[s]; i++) {
+				int lhs = static_cast<int>(rand() % 20);
+				int rhs = static_cast<int>(rand() % 20);
+				def.push_back(lhs);
+				my.push_back(lhs);
+				defOther.push_back(rhs);
+				myOther.push_back(rhs);
+			}
+			std += (std::inner_product(def.begin(), def.end(), defOther.begin(), int()) == std::inner_product(def.begin(), def.end(), defOther.begin(), int()));
+			ft += (ft::simd::dot(my.begin().data, myOther.begin().data, my.size()) == std::inner_product(def.begin(), def.end(), defOther.begin(), int()));
+		}
 	}
+	ft::simd::set_level(ft::simd::supported_level());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5821,40 +8099,30 @@ void eraseSingleMapTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseSingleMapTestStr(std::string &std, std::string &ft) {
-	std::cout << "Single erase std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
-	std::map<std::string, std::string>::iterator it = def.begin();
-	ft::map<std::string, std::string>::iterator mit = my.begin();
-	for (int i = 0; i < 10; i++) {
-		it++;
-		mit++;
-	}
-	for (int i = 0; i < 40; i++) {
-		std::map<std::string, std::string>::iterator tmp = it;
-		ft::map<std::string, std::string>::iterator mtmp = mit;
-		it++;
-		mit++;
-		def.erase(tmp);
-		my.erase(mtmp);
-		mapFillStr(def, my, std, ft);
-	}
-	it = def.end();
-	mit = my.end();
-	it--;
-	mit--;
-	for (int i = 0; i < 20; i++) {
-		std::map<std::string, std::string>::iterator tmp = it;
-		ft::map<std::string, std::string>::iterator mtmp = mit;
-		it--;
-		mit--;
-		def.erase(tmp);
-		my.erase(mtmp);
-		mapFillStr(def, my, std, ft);
+void simdDotTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "SIMD dot product float test" << " ";
+	size_t sizes[] = {0, 1, 7, 16, 33, 100};
+	ft::simd::level levels[] = {ft::simd::scalar_level, ft::simd::sse2_level, ft::simd::avx2_level};
+	for (size_t l = 0; l < 3; l++) {
+		ft::simd::set_level(levels[l]);
+		for (size_t s = 0; s < 6; s++) {
+			std::vector<float> def;
+			std::vector<float> defOther;
+			ft::vector<float> my;
+			ft::vector<float, ft::aligned_allocator<float, 64>, ft::aligned_growth<64> > myOther;
+			for (size_t i = 0; i < sizes[s]; i++) {
+				float lhs = static_cast<float>(rand() % 20);
+				float rhs = static_cast<float>(rand() % 20);
+				def.push_back(lhs);
+				my.push_back(lhs);
+				defOther.push_back(rhs);
+				myOther.push_back(rhs);
+			}
+			std += (std::inner_product(def.begin(), def.end(), defOther.begin(), float()) == std::inner_product(def.begin(), def.end(), defOther.begin(), float()));
+			ft += (ft::simd::dot(my.begin().data, myOther.begin().data, my.size()) == std::inner_product(def.begin(), def.end(), defOther.begin(), float()));
+		}
 	}
+	ft::simd::set_level(ft::simd::supported_level());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5863,19 +8131,40 @@ void eraseSingleMapTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseKeyMapTest(std::string &std, std::string &ft) {
-	std::cout << "Key erase int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::pair<int, int> test(42, 42);
-	def.insert(test);
-	my.insert(test);
-	def.erase(42);
-	my.erase(42);
-	def.erase(1);
-	my.erase(1);
-	mapFillStr(def, my, std, ft);
+void swapNonMemberTestVector(std::string &std, std::string &ft) {
+	std::cout << "Non member swap int test" << " ";
+	std::vector<int> def;
+	std::vector<int> toSwap;
+	ft::vector<int> my;
+	ft::vector<int> mySwap;
+	VectorPushBackElem(def, my, 10);
+	VectorPushBackElem(toSwap, mySwap, 10);
+	std += def.size();
+	ft += my.size();
+	for (std::vector<int>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::vector<int>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += toSwap.size();
+	ft += mySwap.size();
+	for (std::vector<int>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
+		std += *it;
+	for (ft::vector<int>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
+		ft += *it;
+	std::swap(def, toSwap);
+	ft::swap(my, mySwap);
+	std += def.size();
+	ft += my.size();
+	for (std::vector<int>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::vector<int>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += toSwap.size();
+	ft += mySwap.size();
+	for (std::vector<int>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
+		std += *it;
+	for (ft::vector<int>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
+		ft += *it;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5884,19 +8173,40 @@ void eraseKeyMapTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseKeyMapTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Key erase float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::pair<float, float> test(42.21, 42.21);
-	def.insert(test);
-	my.insert(test);
-	def.erase(42.21);
-	my.erase(42.21);
-	def.erase(1.7);
-	my.erase(1.7);
-	mapFillStr(def, my, std, ft);
+void swapNonMemberTestVectorFloat(std::string &std, std::string &ft) {
+	std::cout << "Non member swap float test" << " ";
+	std::vector<float> def;
+	std::vector<float> toSwap;
+	ft::vector<float> my;
+	ft::vector<float> mySwap;
+	VectorPushBackElem(def, my, 10);
+	VectorPushBackElem(toSwap, mySwap, 10);
+	std += def.size();
+	ft += my.size();
+	for (std::vector<float>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::vector<float>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += toSwap.size();
+	ft += mySwap.size();
+	for (std::vector<float>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
+		std += *it;
+	for (ft::vector<float>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
+		ft += *it;
+	std::swap(def, toSwap);
+	ft::swap(my, mySwap);
+	std += def.size();
+	ft += my.size();
+	for (std::vector<float>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::vector<float>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += toSwap.size();
+	ft += mySwap.size();
+	for (std::vector<float>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
+		std += *it;
+	for (ft::vector<float>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
+		ft += *it;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5905,19 +8215,40 @@ void eraseKeyMapTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseKeyMapTestStr(std::string &std, std::string &ft) {
-	std::cout << "Key erase std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::string, std::string> test("42", "42");
-	def.insert(test);
-	my.insert(test);
-	def.erase("42");
-	my.erase("42");
-	def.erase("1");
-	my.erase("1");
-	mapFillStr(def, my, std, ft);
+void swapNonMemberTestVectorStr(std::string &std, std::string &ft) {
+	std::cout << "Non member swap std::string test" << " ";
+	std::vector<std::string> def;
+	std::vector<std::string> toSwap;
+	ft::vector<std::string> my;
+	ft::vector<std::string> mySwap;
+	VectorPushBackElem(def, my, 10);
+	VectorPushBackElem(toSwap, mySwap, 10);
+	std += def.size();
+	ft += my.size();
+	for (std::vector<std::string>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::vector<std::string>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += toSwap.size();
+	ft += mySwap.size();
+	for (std::vector<std::string>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
+		std += *it;
+	for (ft::vector<std::string>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
+		ft += *it;
+	std::swap(def, toSwap);
+	ft::swap(my, mySwap);
+	std += def.size();
+	ft += my.size();
+	for (std::vector<std::string>::iterator it = def.begin(); it != def.end(); it++)
+		std += *it;
+	for (ft::vector<std::string>::iterator it = my.begin(); it != my.end(); it++)
+		ft += *it;
+	std += toSwap.size();
+	ft += mySwap.size();
+	for (std::vector<std::string>::iterator it = toSwap.begin(); it != toSwap.end(); it++)
+		std += *it;
+	for (ft::vector<std::string>::iterator it = mySwap.begin(); it != mySwap.end(); it++)
+		ft += *it;
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5926,24 +8257,60 @@ void eraseKeyMapTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseRangeTest(std::string &std, std::string &ft) {
-	std::cout << "Range erase int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::map<int, int>::iterator it = def.begin();
-	std::map<int, int>::iterator ite = def.end();
-	ft::map<int, int>::iterator itm = my.begin();
-	ft::map<int, int>::iterator item = my.end();
+//MARK: - Growth policy vector
+
+template <typename Growth>
+void growthPolicyReport(const char* name, unsigned long burst, unsigned long steady) {
+	ft::vector<int, std::allocator<int>, Growth> my;
+	size_t reallocs = 0;
+	for (unsigned long l = 0; l < burst; l++) {
+		size_t capacity = my.capacity();
+		my.push_back(rand());
+		if (my.capacity() != capacity)
+			reallocs++;
+	}
+	size_t peak = my.capacity() * sizeof(int);
+	while (my.size() > steady)
+		my.pop_back();
+	size_t drained = my.capacity() * sizeof(int);
+	my.shrink_to_fit();
+	size_t shrunk = my.capacity() * sizeof(int);
+	std::cout << name << ": peak " << peak << " bytes (" << reallocs << " reallocs), after drain "
+		<< drained << " bytes, after shrink_to_fit " << shrunk << " bytes" << std::endl;
+}
+
+void growthPolicyReportVector() {
+	std::cout << "Burst of 1000000 ints drained to 10000" << std::endl;
+	growthPolicyReport<ft::double_growth>("2x growth", 1000000, 10000);
+	growthPolicyReport<ft::one_and_half_growth>("1.5x growth", 1000000, 10000);
+	growthPolicyReport<ft::page_growth<> >("Page growth", 1000000, 10000);
+}
+
+//MARK: - Parallel
+
+void parallelTest(std::string &std, std::string &ft) {
+	std::cout << "For_each, transform and find_if int test" << " ";
+	ft::parallel::thread_pool pool(4);
+	std::vector<int> def;
+	ft::vector<int> my;
+	parallelPushElem(def, my, 300);
+	std::for_each(def.begin(), def.end(), doubleInPlace<int>());
+	ft::parallel::for_each(my.begin(), my.end(), doubleInPlace<int>(), 7, pool);
+	VectorFillStr(def, my, std, ft);
+	std::vector<int> defOut(def.size());
+	ft::vector<int> myOut(my.size());
+	std::transform(def.begin(), def.end(), defOut.begin(), doubleValue<int>());
+	ft::parallel::transform(my.begin(), my.end(), myOut.begin(), doubleValue<int>(), 11, pool);
+	VectorFillStr(defOut, myOut, std, ft);
 	for (int i = 0; i < 20; i++) {
-		++it;
-		++itm;
-		--ite;
-		--item;
+		int val;
+		val = i;
+		val = val + val;
+		std += std::find_if(def.begin(), def.end(), equalValue<int>(val)) - def.begin();
+		ft += ft::parallel::find_if(my.begin(), my.end(), equalValue<int>(val), 5, pool) - my.begin();
 	}
-	def.erase(it, ite);
-	my.erase(itm, item);
-	mapFillStr(def, my, std, ft);
+	std += std::find_if(def.begin(), def.end(), equalValue<int>(def.back())) - def.begin();
+	ft += ft::parallel::find_if(my.begin(), my.end(), equalValue<int>(my.back())) - my.begin();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5952,24 +8319,29 @@ void eraseRangeTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseRangeTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Range erase float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::map<float, float>::iterator it = def.begin();
-	std::map<float, float>::iterator ite = def.end();
-	ft::map<float, float>::iterator itm = my.begin();
-	ft::map<float, float>::iterator item = my.end();
+void parallelTestFloat(std::string &std, std::string &ft) {
+	std::cout << "For_each, transform and find_if float test" << " ";
+	ft::parallel::thread_pool pool(4);
+	std::vector<float> def;
+	ft::vector<float> my;
+	parallelPushElem(def, my, 300);
+	std::for_each(def.begin(), def.end(), doubleInPlace<float>());
+	ft::parallel::for_each(my.begin(), my.end(), doubleInPlace<float>(), 7, pool);
+	VectorFillStr(def, my, std, ft);
+	std::vector<float> defOut(def.size());
+	ft::vector<float> myOut(my.size());
+	std::transform(def.begin(), def.end(), defOut.begin(), doubleValue<float>());
+	ft::parallel::transform(my.begin(), my.end(), myOut.begin(), doubleValue<float>(), 11, pool);
+	VectorFillStr(defOut, myOut, std, ft);
 	for (int i = 0; i < 20; i++) {
-		++it;
-		++itm;
-		--ite;
-		--item;
+		float val;
+		val = i;
+		val = val + val;
+		std += std::find_if(def.begin(), def.end(), equalValue<float>(val)) - def.begin();
+		ft += ft::parallel::find_if(my.begin(), my.end(), equalValue<float>(val), 5, pool) - my.begin();
 	}
-	def.erase(it, ite);
-	my.erase(itm, item);
-	mapFillStr(def, my, std, ft);
+	std += std::find_if(def.begin(), def.end(), equalValue<float>(def.back())) - def.begin();
+	ft += ft::parallel::find_if(my.begin(), my.end(), equalValue<float>(my.back())) - my.begin();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -5978,24 +8350,29 @@ void eraseRangeTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void eraseRangeTestStr(std::string &std, std::string &ft) {
-	std::cout << "Range erase std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::map<std::string, std::string>::iterator it = def.begin();
-	std::map<std::string, std::string>::iterator ite = def.end();
-	ft::map<std::string, std::string>::iterator itm = my.begin();
-	ft::map<std::string, std::string>::iterator item = my.end();
+void parallelTestStr(std::string &std, std::string &ft) {
+	std::cout << "For_each, transform and find_if std::string test" << " ";
+	ft::parallel::thread_pool pool(4);
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	parallelPushElem(def, my, 300);
+	std::for_each(def.begin(), def.end(), doubleInPlace<std::string>());
+	ft::parallel::for_each(my.begin(), my.end(), doubleInPlace<std::string>(), 7, pool);
+	VectorFillStr(def, my, std, ft);
+	std::vector<std::string> defOut(def.size());
+	ft::vector<std::string> myOut(my.size());
+	std::transform(def.begin(), def.end(), defOut.begin(), doubleValue<std::string>());
+	ft::parallel::transform(my.begin(), my.end(), myOut.begin(), doubleValue<std::string>(), 11, pool);
+	VectorFillStr(defOut, myOut, std, ft);
 	for (int i = 0; i < 20; i++) {
-		++it;
-		++itm;
-		--ite;
-		--item;
+		std::string val;
+		val = i;
+		val = val + val;
+		std += std::find_if(def.begin(), def.end(), equalValue<std::string>(val)) - def.begin();
+		ft += ft::parallel::find_if(my.begin(), my.end(), equalValue<std::string>(val), 5, pool) - my.begin();
 	}
-	def.erase(it, ite);
-	my.erase(itm, item);
-	mapFillStr(def, my, std, ft);
+	std += std::find_if(def.begin(), def.end(), equalValue<std::string>(def.back())) - def.begin();
+	ft += ft::parallel::find_if(my.begin(), my.end(), equalValue<std::string>(my.back())) - my.begin();
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6004,22 +8381,32 @@ void eraseRangeTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Swap map
-
-void swapTestMap(std::string &std, std::string &ft) {
-	std::cout << "Swap int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	std::map<int, int> toSwap;
-	ft::map<int, int> mySwap;
-	mapInsertElem(def, my, 100);
-	mapInsertElem(toSwap, mySwap, 50);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(toSwap, mySwap, std, ft);
-	def.swap(toSwap);
-	my.swap(mySwap);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(toSwap, mySwap, std, ft);
+void parallelReduceTest(std::string &std, std::string &ft) {
+	std::cout << "Reduce, inclusive_scan and sort int test" << " ";
+	ft::parallel::thread_pool pool(4);
+	std::vector<int> def;
+	ft::vector<int> my;
+	parallelPushElem(def, my, 300);
+	std += std::accumulate(def.begin(), def.end(), int());
+	ft += ft::parallel::reduce(my.begin(), my.end(), int(), std::plus<int>(), 13, pool);
+	std += std::accumulate(def.begin(), def.end(), int());
+	ft += ft::parallel::reduce(my.begin(), my.end(), int());
+	std::vector<int> defOut(def.size());
+	ft::vector<int> myOut(my.size());
+	std::partial_sum(def.begin(), def.end(), defOut.begin());
+	ft::parallel::inclusive_scan(my.begin(), my.end(), myOut.begin(), std::plus<int>(), 17, pool);
+	VectorFillStr(defOut, myOut, std, ft);
+	std::sort(def.begin(), def.end());
+	ft::parallel::sort(my.begin(), my.end(), std::less<int>(), 9, pool);
+	VectorFillStr(def, my, std, ft);
+	std::sort(def.begin(), def.end(), std::greater<int>());
+	ft::parallel::sort(my.begin(), my.end(), std::greater<int>(), 64, pool);
+	VectorFillStr(def, my, std, ft);
+	std::random_shuffle(def.begin(), def.end());
+	std::sort(def.begin(), def.end());
+	std::random_shuffle(my.begin(), my.end());
+	ft::parallel::sort(my.begin(), my.end());
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6028,20 +8415,32 @@ void swapTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void swapTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Swap float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	std::map<float, float> toSwap;
-	ft::map<float, float> mySwap;
-	mapInsertElem(def, my, 100);
-	mapInsertElem(toSwap, mySwap, 50);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(toSwap, mySwap, std, ft);
-	def.swap(toSwap);
-	my.swap(mySwap);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(toSwap, mySwap, std, ft);
+void parallelReduceTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Reduce, inclusive_scan and sort float test" << " ";
+	ft::parallel::thread_pool pool(4);
+	std::vector<float> def;
+	ft::vector<float> my;
+	parallelPushElem(def, my, 300);
+	std += std::accumulate(def.begin(), def.end(), float());
+	ft += ft::parallel::reduce(my.begin(), my.end(), float(), std::plus<float>(), 13, pool);
+	std += std::accumulate(def.begin(), def.end(), float());
+	ft += ft::parallel::reduce(my.begin(), my.end(), float());
+	std::vector<float> defOut(def.size());
+	ft::vector<float> myOut(my.size());
+	std::partial_sum(def.begin(), def.end(), defOut.begin());
+	ft::parallel::inclusive_scan(my.begin(), my.end(), myOut.begin(), std::plus<float>(), 17, pool);
+	VectorFillStr(defOut, myOut, std, ft);
+	std::sort(def.begin(), def.end());
+	ft::parallel::sort(my.begin(), my.end(), std::less<float>(), 9, pool);
+	VectorFillStr(def, my, std, ft);
+	std::sort(def.begin(), def.end(), std::greater<float>());
+	ft::parallel::sort(my.begin(), my.end(), std::greater<float>(), 64, pool);
+	VectorFillStr(def, my, std, ft);
+	std::random_shuffle(def.begin(), def.end());
+	std::sort(def.begin(), def.end());
+	std::random_shuffle(my.begin(), my.end());
+	ft::parallel::sort(my.begin(), my.end());
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6050,20 +8449,32 @@ void swapTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void swapTestMapStr(std::string &std, std::string &ft) {
-	std::cout << "Swap std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	std::map<std::string, std::string> toSwap;
-	ft::map<std::string, std::string> mySwap;
-	mapInsertElem(def, my, 100);
-	mapInsertElem(toSwap, mySwap, 50);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(toSwap, mySwap, std, ft);
-	def.swap(toSwap);
-	my.swap(mySwap);
-	mapFillStr(def, my, std, ft);
-	mapFillStr(toSwap, mySwap, std, ft);
+void parallelReduceTestStr(std::string &std, std::string &ft) {
+	std::cout << "Reduce, inclusive_scan and sort std::string test" << " ";
+	ft::parallel::thread_pool pool(4);
+	std::vector<std::string> def;
+	ft::vector<std::string> my;
+	parallelPushElem(def, my, 300);
+	std += std::accumulate(def.begin(), def.end(), std::string());
+	ft += ft::parallel::reduce(my.begin(), my.end(), std::string(), std::plus<std::string>(), 13, pool);
+	std += std::accumulate(def.begin(), def.end(), std::string());
+	ft += ft::parallel::reduce(my.begin(), my.end(), std::string());
+	std::vector<std::string> defOut(def.size());
+	ft::vector<std::string> myOut(my.size());
+	std::partial_sum(def.begin(), def.end(), defOut.begin());
+	ft::parallel::inclusive_scan(my.begin(), my.end(), myOut.begin(), std::plus<std::string>(), 17, pool);
+	VectorFillStr(defOut, myOut, std, ft);
+	std::sort(def.begin(), def.end());
+	ft::parallel::sort(my.begin(), my.end(), std::less<std::string>(), 9, pool);
+	VectorFillStr(def, my, std, ft);
+	std::sort(def.begin(), def.end(), std::greater<std::string>());
+	ft::parallel::sort(my.begin(), my.end(), std::greater<std::string>(), 64, pool);
+	VectorFillStr(def, my, std, ft);
+	std::random_shuffle(def.begin(), def.end());
+	std::sort(def.begin(), def.end());
+	std::random_shuffle(my.begin(), my.end());
+	ft::parallel::sort(my.begin(), my.end());
+	VectorFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6072,17 +8483,65 @@ void swapTestMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Clear map
-
-void clearTestMap(std::string &std, std::string &ft) {
-	std::cout << "Clear int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
-	def.clear();
-	my.clear();
-	mapFillStr(def, my, std, ft);
+void testParallel() {
+	std::string std;
+	std::string ft;
+	parallelTest(std, ft);
+	parallelTestFloat(std, ft);
+	parallelTestStr(std, ft);
+	parallelReduceTest(std, ft);
+	parallelReduceTestFloat(std, ft);
+	parallelReduceTestStr(std, ft);
+}
+
+//MARK: - Mmap vector
+
+void mmapVectorTest(std::string &std, std::string &ft) {
+	std::cout << "Mmap vector int test" << " ";
+	std::string path = "/tmp/ft_mmap_vector_test.bin";
+	::unlink(path.c_str());
+	{
+		std::vector<int> def;
+		ft::mmap_vector<int> my(path);
+		for (int i = 0; i < 1000; i++) {
+			int val = static_cast<int>(rand() % 1000);
+			def.push_back(val);
+			my.push_back(val);
+		}
+		for (size_t i = 0; i < def.size(); i++)
+			std += def[i];
+		for (ft::mmap_vector<int>::iterator it = my.begin(); it != my.end(); it++)
+			ft += *it;
+		std += def.front() + def.back() + def.at(500);
+		ft += my.front() + my.back() + my.at(500);
+		def.erase(def.begin() + 10, def.begin() + 400);
+		my.erase(my.begin() + 10, my.begin() + 400);
+		def.erase(def.begin());
+		my.erase(my.begin());
+		def.pop_back();
+		my.pop_back();
+		def.resize(700, static_cast<int>(7));
+		my.resize(700, static_cast<int>(7));
+		for (std::vector<int>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+			std += *it;
+		for (ft::mmap_vector<int>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+			ft += *it;
+		std += def.size();
+		ft += my.size();
+		std += *std::max_element(def.begin(), def.end());
+		ft += *std::max_element(my.begin(), my.end());
+		try {
+			my.at(700);
+		}
+		catch (std::out_of_range&) {
+			ft += "out of range";
+		}
+		std += "out of range";
+		my.shrink_to_fit();
+		std += def.size();
+		ft += my.capacity();
+	}
+	::unlink(path.c_str());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6091,15 +8550,52 @@ void clearTestMap(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void clearTestMapFloat(std::string &std, std::string &ft) {
-	std::cout << "Clear float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
-	def.clear();
-	my.clear();
-	mapFillStr(def, my, std, ft);
+void mmapVectorTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Mmap vector float test" << " ";
+	std::string path = "/tmp/ft_mmap_vector_test.bin";
+	::unlink(path.c_str());
+	{
+		std::vector<float> def;
+		ft::mmap_vector<float> my(path);
+		for (int i = 0; i < 1000; i++) {
+			float val = static_cast<float>(rand() % 1000);
+			def.push_back(val);
+			my.push_back(val);
+		}
+		for (size_t i = 0; i < def.size(); i++)
+			std += def[i];
+		for (ft::mmap_vector<float>::iterator it = my.begin(); it != my.end(); it++)
+			ft += *it;
+		std += def.front() + def.back() + def.at(500);
+		ft += my.front() + my.back() + my.at(500);
+		def.erase(def.begin() + 10, def.begin() + 400);
+		my.erase(my.begin() + 10, my.begin() + 400);
+		def.erase(def.begin());
+		my.erase(my.begin());
+		def.pop_back();
+		my.pop_back();
+		def.resize(700, static_cast<float>(7));
+		my.resize(700, static_cast<float>(7));
+		for (std::vector<float>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+			std += *it;
+		for (ft::mmap_vector<float>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+			ft += *it;
+		std += def.size();
+		ft += my.size();
+		std += *std::max_element(def.begin(), def.end());
+		ft += *std::max_element(my.begin(), my.end());
+		try {
+			my.at(700);
+		}
+		catch (std::out_of_range&) {
+			ft += "out of range";
+		}
+		std += "out of range";
+		my.shrink_to_fit();
+		std += def.size();
+		ft += my.capacity();
+	}
+	::unlink(path.c_str());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6108,15 +8604,47 @@ void clearTestMapFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void clearTestMapStr(std::string &std, std::string &ft) {
-	std::cout << "Clear std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	mapFillStr(def, my, std, ft);
-	def.clear();
-	my.clear();
-	mapFillStr(def, my, std, ft);
+void mmapReopenTest(std::string &std, std::string &ft) {
+	std::cout << "Mmap vector reopen test" << " ";
+	std::string path = "/tmp/ft_mmap_vector_reopen.bin";
+	::unlink(path.c_str());
+	std::vector<long> def;
+	{
+		ft::mmap_vector<long> my(path);
+		for (long i = 0; i < 5000; i++) {
+			def.push_back(i * 3);
+			my.push_back(i * 3);
+		}
+		my[42] = -1;
+		def[42] = -1;
+		my.sync();
+	}
+	{
+		ft::mmap_vector<long> my(path);
+		for (size_t i = 0; i < def.size(); i++)
+			std += def[i];
+		for (size_t i = 0; i < my.size(); i++)
+			ft += my[i];
+		std += def.size();
+		ft += my.size();
+		def.resize(10);
+		my.resize(10);
+	}
+	{
+		ft::mmap_vector<long> my(path);
+		std += def.size();
+		ft += my.size();
+		std += "rejected";
+		try {
+			ft::mmap_vector<char> wrong(path);
+		}
+		catch (std::runtime_error&) {
+			ft += "rejected";
+		}
+		std += (def.size() == 10);
+		ft += (my.back() == 27);
+	}
+	::unlink(path.c_str());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6125,20 +8653,29 @@ void clearTestMapStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Key compare map
-
-void keyCompareTest(std::string &std, std::string &ft) {
-	std::cout << "Key comp int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	std::map<int,int>::key_compare comp = def.key_comp();
-	ft::map<int,int>::key_compare myComp = my.key_comp();
-	int i = 10000;
-	mapInsertElem(def, my, 100);
-	for (std::map<int, int>::iterator it = def.begin(); it != def.end(); ++it) {
-		std += comp(i, it->first);
-		ft += myComp(i, it->first);
+void mmapForeignFileTest(std::string &std, std::string &ft) {
+	std::cout << "Mmap vector foreign file test" << " ";
+	std::string path = "/tmp/ft_mmap_vector_foreign.bin";
+	std::string content(200, 'x');
+	for (size_t i = 0; i < 8; i++)
+		content[i] = '\0';
+	int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (::write(fd, content.data(), content.size()) < 0)
+		ft += "write failed";
+	std += "rejected";
+	try {
+		ft::mmap_vector<int> my(path);
 	}
+	catch (std::runtime_error&) {
+		ft += "rejected";
+	}
+	std::string after(content.size(), ' ');
+	if (::pread(fd, &after[0], after.size(), 0) < 0)
+		ft += "read failed";
+	::close(fd);
+	std += content;
+	ft += after;
+	::unlink(path.c_str());
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6147,38 +8684,116 @@ void keyCompareTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void keyCompareTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Key comp float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	std::map<float,float>::key_compare comp = def.key_comp();
-	ft::map<float,float>::key_compare myComp = my.key_comp();
-	float i = 10000.42;
-	mapInsertElem(def, my, 100);
-	for (std::map<float, float>::iterator it = def.begin(); it != def.end(); ++it) {
-		std += comp(i, it->first);
-		ft += myComp(i, it->first);
-	}
-	if (std == ft)
-		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
-	else
-		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
-	std.clear();
-	ft.clear();
+void testMmapVector() {
+	std::string std;
+	std::string ft;
+	mmapVectorTest(std, ft);
+	mmapVectorTestFloat(std, ft);
+	mmapReopenTest(std, ft);
+	mmapForeignFileTest(std, ft);
 }
 
-void keyCompareTestStr(std::string &std, std::string &ft) {
-	std::cout << "Key comp std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	std::map<std::string,std::string>::key_compare comp = def.key_comp();
-	ft::map<std::string,std::string>::key_compare myComp = my.key_comp();
-	std::string i = "10000";
-	mapInsertElem(def, my, 100);
-	for (std::map<std::string, std::string>::iterator it = def.begin(); it != def.end(); ++it) {
-		std += comp(i, it->first);
-		ft += myComp(i, it->first);
+//MARK: - Vector
+
+//MARK: - Bit vector
+
+template <class Vector>
+void bitVectorFillStr(const Vector& vec, std::string& out) {
+	for (size_t i = 0; i < vec.size(); i++)
+		out += vec[i] ? '1' : '0';
+	out += vec.size();
+}
+
+void bitVectorBasicTest(std::string &std, std::string &ft) {
+	std::cout << "Bit vector element access test" << " ";
+	std::vector<bool> def;
+	ft::vector<bool> my;
+	for (int i = 0; i < 200; i++) {
+		bool val = rand() % 3 == 0;
+		def.push_back(val);
+		my.push_back(val);
+	}
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	def[63] = true;
+	my[63] = true;
+	def[64] = def[63];
+	my[64] = my[63];
+	def.at(130).flip();
+	my.at(130).flip();
+	std += def.front() + def.back() + def.at(199);
+	ft += my.front() + my.back() + my.at(199);
+	for (int i = 0; i < 70; i++) {
+		def.pop_back();
+		my.pop_back();
 	}
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	for (std::vector<bool>::reverse_iterator it = def.rbegin(); it != def.rend(); it++)
+		std += *it;
+	for (ft::vector<bool>::reverse_iterator it = my.rbegin(); it != my.rend(); it++)
+		ft += *it;
+	std += (def.end() - def.begin());
+	ft += (my.end() - my.begin());
+	std += *(def.begin() + 100) + *(def.end() - 37);
+	ft += *(my.begin() + 100) + *(my.end() - 37);
+	def.resize(300, true);
+	my.resize(300, true);
+	def.resize(150);
+	my.resize(150);
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void bitVectorModifiersTest(std::string &std, std::string &ft) {
+	std::cout << "Bit vector modifiers test" << " ";
+	std::vector<bool> def(100, true);
+	ft::vector<bool> my(100, true);
+	def.insert(def.begin() + 10, 70, false);
+	my.insert(my.begin() + 10, 70, false);
+	def.insert(def.begin() + 3, true);
+	my.insert(my.begin() + 3, true);
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	std::list<bool> pattern;
+	for (int i = 0; i < 90; i++)
+		pattern.push_back(i % 7 == 0);
+	def.insert(def.begin() + 65, pattern.begin(), pattern.end());
+	my.insert(my.begin() + 65, pattern.begin(), pattern.end());
+	std += *def.erase(def.begin() + 1);
+	ft += *my.erase(my.begin() + 1);
+	def.erase(def.begin() + 20, def.begin() + 150);
+	my.erase(my.begin() + 20, my.begin() + 150);
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	def.flip();
+	my.flip();
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	std::vector<bool> defOther(pattern.begin(), pattern.end());
+	ft::vector<bool> myOther(pattern.begin(), pattern.end());
+	def.swap(defOther);
+	my.swap(myOther);
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	def.assign(130, true);
+	my.assign(130, true);
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	def = defOther;
+	my = myOther;
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
+	def.clear();
+	my.clear();
+	bitVectorFillStr(def, std);
+	bitVectorFillStr(my, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6187,17 +8802,36 @@ void keyCompareTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Value compare map
-
-void valueCompareTest(std::string &std, std::string &ft) {
-	std::cout << "Value comp int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::pair<int, int> res(100,100);
-	for (std::map<int, int>::iterator it = def.begin(); it != def.end(); ++it) {
-		std += def.value_comp()(res, *it);
-		ft += my.value_comp()(res, *it);
+void bitVectorBulkTest(std::string &std, std::string &ft) {
+	std::cout << "Bit vector count, find and compare test" << " ";
+	size_t sizes[] = {0, 1, 63, 64, 65, 200};
+	for (size_t s = 0; s < 6; s++) {
+		std::vector<bool> def(sizes[s], false);
+		ft::vector<bool> my(sizes[s], false);
+		std += std::count(def.begin(), def.end(), true);
+		ft += ft::count(my, true);
+		std += std::find(def.begin(), def.end(), true) - def.begin();
+		ft += ft::find(my, true) - my.cbegin();
+		def.flip();
+		my.flip();
+		std += std::count(def.begin(), def.end(), false);
+		ft += ft::count(my, false);
+		std += std::find(def.begin(), def.end(), false) - def.begin();
+		ft += ft::find(my, false) - my.cbegin();
+		std::vector<bool> defCopy(def);
+		ft::vector<bool> myCopy(my);
+		std += (def == defCopy) + (def < defCopy);
+		ft += (my == myCopy) + (my < myCopy);
+		if (sizes[s] != 0) {
+			defCopy[sizes[s] - 1] = false;
+			myCopy[sizes[s] - 1] = false;
+		}
+		std += (def == defCopy) + (def < defCopy) + (defCopy < def) + (def >= defCopy);
+		ft += (my == myCopy) + (my < myCopy) + (myCopy < my) + (my >= myCopy);
+		defCopy.push_back(false);
+		myCopy.push_back(false);
+		std += (def == defCopy) + (def < defCopy) + (defCopy < def);
+		ft += (my == myCopy) + (my < myCopy) + (myCopy < my);
 	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -6207,15 +8841,30 @@ void valueCompareTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void valueCompareTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Value comp float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::pair<float, float> res(100.42,100.42);
-	for (std::map<float, float>::iterator it = def.begin(); it != def.end(); ++it) {
-		std += def.value_comp()(res, *it);
-		ft += my.value_comp()(res, *it);
+void throwingFillTestVector(std::string &std, std::string &ft) {
+	std::cout << "Fill constructor, assign and resize with throwing copy test" << " ";
+	ThrowingCopy val(7);
+	for (int op = 0; op < 4; op++) {
+		for (long budget = 0; budget < 12; budget++) {
+			copyBudget = -1;
+			ft::vector<ThrowingCopy> my(3, val);
+			if (op == 2)
+				my.reserve(20);
+			copyBudget = budget;
+			try {
+				if (op == 0) {
+					ft::vector<ThrowingCopy> other(10, val);
+				}
+				else if (op == 1 || op == 2)
+					my.assign(15, val);
+				else
+					my.resize(15, val);
+			}
+			catch (std::runtime_error &) {}
+			copyBudget = -1;
+			std += 1;
+			ft += liveObjects == static_cast<long>(my.size()) + 1;
+		}
 	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -6225,15 +8874,29 @@ void valueCompareTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void valueCompareTestStr(std::string &std, std::string &ft) {
-	std::cout << "Value comp std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::string, std::string> res("100","100");
-	for (std::map<std::string, std::string>::iterator it = def.begin(); it != def.end(); ++it) {
-		std += def.value_comp()(res, *it);
-		ft += my.value_comp()(res, *it);
+void throwingInsertTestVector(std::string &std, std::string &ft) {
+	std::cout << "Fill and range insert with throwing copy test" << " ";
+	ThrowingCopy val(7);
+	std::vector<ThrowingCopy> src(4, val);
+	for (int op = 0; op < 2; op++) {
+		for (size_t pos = 0; pos <= 6; pos += 3) {
+			for (long budget = 0; budget < 12; budget++) {
+				copyBudget = -1;
+				ft::vector<ThrowingCopy> my(6, val);
+				my.reserve(20);
+				copyBudget = budget;
+				try {
+					if (op == 0)
+						my.insert(my.begin() + pos, 4, val);
+					else
+						my.insert(my.begin() + pos, src.begin(), src.end());
+				}
+				catch (std::runtime_error &) {}
+				copyBudget = -1;
+				std += 1;
+				ft += liveObjects == static_cast<long>(my.size() + src.size()) + 1;
+			}
+		}
 	}
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
@@ -6243,24 +8906,162 @@ void valueCompareTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Find map
+void testVector() {
+	std::cout << "                            CONSTRUCTOR" << std::endl;
+	std::string std;
+	std::string ft;
+	defaultCnstTestVector(std, ft);
+	defaultCnstTestVectorFloat(std, ft);
+	defaultCnstTestVectorStr(std, ft);
+	fillCnstTestVector(std, ft);
+	fillCnstTestVectorFloat(std, ft);
+	fillCnstTestVectorStr(std, ft);
+	rangeCnstTestVector(std, ft);
+	rangeCnstTestVectorFloat(std, ft);
+	rangeCnstTestVectorStr(std, ft);
+	copyCnstTestVector(std, ft);
+	copyCnstTestVectorFloat(std, ft);
+	copyCnstTestVectorStr(std, ft);
+	std::cout << "                            ASSIGNATION" << std::endl;
+	assignTestVector(std, ft);
+	assignTestVectorFloat(std, ft);
+	assignTestVectorStr(std, ft);
+	reuseAssignTestVector(std, ft);
+	reuseAssignTestVectorFloat(std, ft);
+	reuseAssignTestVectorStr(std, ft);
+	throwingFillTestVector(std, ft);
+	throwingInsertTestVector(std, ft);
+	std::cout << "                            ITERATORS" << std::endl;
+	iteratorTestVector(std, ft, 1000);
+	constIteratorTestVector(std, ft, 1000);
+	reverseIteratorTestVector(std, ft, 10);
+	constReverseIteratorTestVector(std, ft, 10);
+	algorithmIteratorTestVector(std, ft);
+	algorithmIteratorTestVectorFloat(std, ft);
+	algorithmIteratorTestVectorStr(std, ft);
+	std::cout << "                            CAPACITY" << std::endl;
+	sizeTest(std, ft);
+	sizeTestFloat(std, ft);
+	sizeTestStr(std, ft);
+	maxSizeTest(std, ft);
+	maxSizeTestFloat(std, ft);
+	maxSizeTestStr(std, ft);
+	resizeTestIntVector(std, ft);
+	resizeTestFloatVector(std, ft);
+	resizeTestStrVector(std, ft);
+	inPlaceResizeTestIntVector(std, ft);
+	inPlaceResizeTestFloatVector(std, ft);
+	inPlaceResizeTestStrVector(std, ft);
+	capacityTestVector(std, ft);
+	capacityTestVectorFloat(std, ft);
+	capacityTestVectorStr(std, ft);
+	emptyVectorTest(std, ft);
+	emptyVectorTestFloat(std, ft);
+	emptyVectorTestStr(std, ft);
+	reserveVectorTest(std, ft);
+	reserveVectorFloatTest(std, ft);
+	reserveVectorStrTest(std, ft);
+	shrinkToFitVectorTest(std, ft);
+	shrinkToFitVectorTestFloat(std, ft);
+	shrinkToFitVectorTestStr(std, ft);
+	std::cout << "                            ELEMENT ACCESS" << std::endl;
+	squareBracketsTest(std, ft);
+	squareBracketsTestFloat(std, ft);
+	squareBracketsTestStr(std, ft);
+	atTest(std, ft);
+	atTestFloat(std, ft);
+	atTestStr(std, ft);
+	frontTest(std, ft);
+	frontTestFloat(std, ft);
+	frontTestStr(std, ft);
+	backTest(std, ft);
+	backTestFloat(std, ft);
+	backTestStr(std, ft);
+	std::cout << "                            MODIFIERS" << std::endl;
+	assignRangeTest(std, ft);
+	assignRangeTestFloat(std, ft);
+	assignRangeTestStr(std, ft);
+	assignFillTest(std, ft);
+	assignFillTestFloat(std, ft);
+	assignFillTestStr(std, ft);
+	pushBackVectorTest(std, ft);
+	pushBackVectorTestFloat(std, ft);
+	pushBackVectorTestStr(std, ft);
+	popBackVectorTest(std, ft);
+	popBackVectorTestFloat(std, ft);
+	popBackVectorTestStr(std, ft);
+	singleInsertVectorTest(std, ft);
+	singleInsertVectorTestFloat(std, ft);
+	singleInsertVectorTestStr(std, ft);
+	fillInsertVectorTest(std, ft);
+	fillInsertVectorTestFloat(std, ft);
+	fillInsertVectorTestStr(std, ft);
+	rangeInsertVectorTest(std, ft);
+	rangeInsertVectorTestFloat(std, ft);
+	rangeInsertVectorTestStr(std, ft);
+	streamRangeTestVector(std, ft);
+	streamRangeTestVectorFloat(std, ft);
+	streamRangeTestVectorStr(std, ft);
+	singleEraseVectorTest(std, ft);
+	singleEraseVectorTestFloat(std, ft);
+	singleEraseVectorTestStr(std, ft);
+	rangeEraseVectorTest(std, ft);
+	rangeEraseVectorTestFloat(std, ft);
+	rangeEraseVectorTestStr(std, ft);
+	swapVectorTest(std, ft);
+	swapVectorTestFloat(std, ft);
+	swapVectorTestStr(std, ft);
+	clearVectorTest(std, ft);
+	clearVectorTestFloat(std, ft);
+	clearVectorTestStr(std, ft);
+	lifetimeTestVector(std, ft);
+	std::cout << "                            NON MEMBER FUNCTIONS OVERLOADS" << std::endl;
+	equalTestVector(std, ft);
+	equalTestVectorFloat(std, ft);
+	equalTestVectorStr(std, ft);
+	nonEqualTestVector(std, ft);
+	nonEqualTestVectorFloat(std, ft);
+	nonEqualTestVectorStr(std, ft);
+	lessTestVector(std, ft);
+	lessTestVectorFloat(std, ft);
+	lessTestVectorStr(std, ft);
+	lessOrEqualTestVector(std, ft);
+	lessOrEqualTestVectorFloat(std, ft);
+	lessOrEqualTestVectorStr(std, ft);
+	greaterTestVector(std, ft);
+	greaterTestVectorFloat(std, ft);
+	greaterTestVectorStr(std, ft);
+	greaterOrEqualTestVector(std, ft);
+	greaterOrEqualTestVectorFloat(std, ft);
+	greaterOrEqualTestVectorStr(std, ft);
+	swapNonMemberTestVector(std, ft);
+	swapNonMemberTestVectorFloat(std, ft);
+	swapNonMemberTestVectorStr(std, ft);
+	simdSearchTestVector(std, ft);
+	simdSearchTestVectorFloat(std, ft);
+	simdSearchTestVectorChar(std, ft);
+	simdSearchTestVectorStr(std, ft);
+	simdDotTestVector(std, ft);
+	simdDotTestVectorFloat(std, ft);
+	std::cout << "                            ALIGNED STORAGE" << std::endl;
+	alignedStorageTestVector(std, ft);
+	alignedStorageTestVectorFloat(std, ft);
+	alignedStorageTestVectorStr(std, ft);
+	std::cout << "                            BIT VECTOR" << std::endl;
+	bitVectorBasicTest(std, ft);
+	bitVectorModifiersTest(std, ft);
+	bitVectorBulkTest(std, ft);
+	std::cout << "                            GROWTH POLICY" << std::endl;
+	growthPolicyReportVector();
+}
 
-void findTest(std::string &std, std::string &ft) {
-	std::cout << "Find int test" << " ";
+//MARK: - Default constructor map
+
+void defaultCnstTestMap(std::string &std, std::string &ft) {
+	std::cout << "Default constructor int test" << " ";
 	std::map<int, int> def;
 	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::pair<int, int> test(42, 42);
-	def.insert(test);
-	my.insert(test);
-	std::map<int, int>::iterator it;
-	ft::map<int, int>::iterator ite;
-	it = def.find(42);
-	ite = my.find(42);
-	std += it->first;
-	std += it->second;
-	ft += ite->first;
-	ft += ite->second;
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6269,22 +9070,11 @@ void findTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void findTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Find float test" << " ";
+void defaultCnstTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Default constructor float test" << " ";
 	std::map<float, float> def;
 	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::pair<float, float> test(42.21, 42.21);
-	def.insert(test);
-	my.insert(test);
-	std::map<float, float>::iterator it;
-	ft::map<float, float>::iterator ite;
-	it = def.find(42.21);
-	ite = my.find(42.21);
-	std += it->first;
-	std += it->second;
-	ft += ite->first;
-	ft += ite->second;
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6293,22 +9083,11 @@ void findTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void findTestStr(std::string &std, std::string &ft) {
-	std::cout << "Find std::string test" << " ";
+void defaultCnstTestMapStr(std::string &std, std::string &ft) {
+	std::cout << "Default constructor std::string test" << " ";
 	std::map<std::string, std::string> def;
 	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::string, std::string> test("42", "42");
-	def.insert(test);
-	my.insert(test);
-	std::map<std::string, std::string>::iterator it;
-	ft::map<std::string, std::string>::iterator ite;
-	it = def.find("42");
-	ite = my.find("42");
-	std += it->first;
-	std += it->second;
-	ft += ite->first;
-	ft += ite->second;
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6317,25 +9096,18 @@ void findTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Count map
+//MARK: - Range constructor map
 
-void countTest(std::string &std, std::string &ft) {
-	std::cout << "Count int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::pair<int, int> test(42, 42);
-	std::pair<int, int> test1(21, 21);
-	def.insert(test);
-	my.insert(test);
-	def.insert(test);
-	my.insert(test);
-	std += def.count(42);
-	ft += my.count(42);
-	std += def.count(21);
-	ft += my.count(21);
-	std += def.count(72);
-	ft += my.count(72);
+void rangeCnstTestMap(std::string &std, std::string &ft) {
+	std::cout << "Range constructor int test" << " ";
+	std::map<int, int> test;
+	for (int i = 0; i < 100; i++) {
+		std::pair<int, int> res(rand(), rand());
+		test.insert(res);
+	}
+	std::map<int, int> def(++test.begin(), --test.end());
+	ft::map<int, int> my(++test.begin(), --test.end());
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6344,23 +9116,16 @@ void countTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void countTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Count float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::pair<float, float> test(42.21, 42.21);
-	std::pair<float, float> test1(21.42, 21.42);
-	def.insert(test);
-	my.insert(test);
-	def.insert(test);
-	my.insert(test);
-	std += def.count(42.21);
-	ft += my.count(42.21);
-	std += def.count(21.42);
-	ft += my.count(21.42);
-	std += def.count(72.1);
-	ft += my.count(72.1);
+void rangeCnstTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Range constructor float test" << " ";
+	std::map<float, float> test;
+	for (int i = 0; i < 100; i++) {
+		std::pair<float, float> res(rand(), rand());
+		test.insert(res);
+	}
+	std::map<float, float> def(++test.begin(), --test.end());
+	ft::map<float, float> my(++test.begin(), --test.end());
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6369,23 +9134,20 @@ void countTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void countTestStr(std::string &std, std::string &ft) {
-	std::cout << "Count std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::string, std::string> test("42", "42");
-	std::pair<std::string, std::string> test1("21", "21");
-	def.insert(test);
-	my.insert(test);
-	def.insert(test);
-	my.insert(test);
-	std += def.count("42");
-	ft += my.count("42");
-	std += def.count("21");
-	ft += my.count("21");
-	std += def.count("72");
-	ft += my.count("72");
+void rangeCnstTestMapStr(std::string &std, std::string &ft) {
+	std::cout << "Range constructor std::string test" << " ";
+	std::map<std::string, std::string> test;
+	std::string key;
+	std::string value;
+	for (int i = 0; i < 100; i++) {
+		key += rand();
+		value += rand();
+		std::pair<std::string, std::string> res(key, value);
+		test.insert(res);
+	}
+	std::map<std::string, std::string> def(++test.begin(), --test.end());
+	ft::map<std::string, std::string> my(++test.begin(), --test.end());
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6394,42 +9156,14 @@ void countTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Lover bound map
+//MARK: - Copy constructor map
 
-void lowerBoundTest(std::string &std, std::string &ft) {
-	std::cout << "Lower bound int test" << " ";
+void copyCnstTestMap(std::string &std, std::string &ft) {
+	std::cout << "Copy constructor int test" << " ";
 	std::map<int, int> def;
 	ft::map<int, int> my;
 	mapInsertElem(def, my, 100);
-	std::pair<int, int> test(42, 42);
-	def.insert(test);
-	my.insert(test);
-	std::map<int, int>::iterator it;
-	ft::map<int, int>::iterator itm;
-	it = def.lower_bound(42);
-	itm = my.lower_bound(42);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound(43);
-	itm = my.lower_bound(43);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound(-9999999);
-	itm = my.lower_bound(-9999999);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound(999999999);
-	itm = my.lower_bound(999999999);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6438,40 +9172,12 @@ void lowerBoundTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lowerBoundTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Lower bound float test" << " ";
+void copyCnstTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Copy constructor float test" << " ";
 	std::map<float, float> def;
 	ft::map<float, float> my;
 	mapInsertElem(def, my, 100);
-	std::pair<float, float> test(42.21, 42.21);
-	def.insert(test);
-	my.insert(test);
-	std::map<float, float>::iterator it;
-	ft::map<float, float>::iterator itm;
-	it = def.lower_bound(42.21);
-	itm = my.lower_bound(42.21);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound(43.21);
-	itm = my.lower_bound(43.21);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound(-9999999.0);
-	itm = my.lower_bound(-9999999.0);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound(999999999.0);
-	itm = my.lower_bound(999999999.0);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6480,40 +9186,12 @@ void lowerBoundTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void lowerBoundTestStr(std::string &std, std::string &ft) {
-	std::cout << "Lower bound std::string test" << " ";
+void copyCnstTestMapStr(std::string &std, std::string &ft) {
+	std::cout << "Copy constructor std::string test" << " ";
 	std::map<std::string, std::string> def;
 	ft::map<std::string, std::string> my;
 	mapInsertElem(def, my, 100);
-	std::pair<std::string, std::string> test("42", "42");
-	def.insert(test);
-	my.insert(test);
-	std::map<std::string, std::string>::iterator it;
-	ft::map<std::string, std::string>::iterator itm;
-	it = def.lower_bound("42");
-	itm = my.lower_bound("42");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound("43");
-	itm = my.lower_bound("43");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound("a");
-	itm = my.lower_bound("a");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.lower_bound("zzzzzzzzzzzzzzz");
-	itm = my.lower_bound("zzzzzzzzzzzzzzz");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
+	mapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6522,42 +9200,21 @@ void lowerBoundTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Upper bound map
+//MARK: - Assignation map
 
-void upperBoundTest(std::string &std, std::string &ft) {
-	std::cout << "Upper bound int test" << " ";
+void assignTestMap(std::string &std, std::string &ft) {
+	std::cout << "Assignation int test" << " ";
 	std::map<int, int> def;
 	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::pair<int, int> test(42, 42);
-	def.insert(test);
-	my.insert(test);
-	std::map<int, int>::iterator it;
-	ft::map<int, int>::iterator itm;
-	it = def.upper_bound(42);
-	itm = my.upper_bound(42);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound(43);
-	itm = my.upper_bound(43);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound(-9999999);
-	itm = my.upper_bound(-9999999);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound(999999999);
-	itm = my.upper_bound(999999999);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
+	std::map<int, int> test;
+	ft::map<int, int> myTest;
+	mapInsertElem(test, myTest, 100);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(test, myTest, std, ft);
+	def = test;
+	my = myTest;
+	mapFillStr(def, my, std, ft);
+	mapFillStr(test, myTest, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6566,40 +9223,19 @@ void upperBoundTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void upperBoundTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Upper bound float test" << " ";
+void assignTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Assignation float test" << " ";
 	std::map<float, float> def;
 	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::pair<float, float> test(42.21, 42.21);
-	def.insert(test);
-	my.insert(test);
-	std::map<float, float>::iterator it;
-	ft::map<float, float>::iterator itm;
-	it = def.upper_bound(42.21);
-	itm = my.upper_bound(42.21);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound(43.21);
-	itm = my.upper_bound(43.21);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound(-9999999.0);
-	itm = my.upper_bound(-9999999.0);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound(999999999.0);
-	itm = my.upper_bound(999999999.0);
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
+	std::map<float, float> test;
+	ft::map<float, float> myTest;
+	mapInsertElem(test, myTest, 100);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(test, myTest, std, ft);
+	def = test;
+	my = myTest;
+	mapFillStr(def, my, std, ft);
+	mapFillStr(test, myTest, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6608,40 +9244,19 @@ void upperBoundTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void upperBoundTestStr(std::string &std, std::string &ft) {
-	std::cout << "Upper bound std::string test" << " ";
+void assignTestMapStr(std::string &std, std::string &ft) {
+	std::cout << "Assignation std::string test" << " ";
 	std::map<std::string, std::string> def;
 	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::string, std::string> test("42", "42");
-	def.insert(test);
-	my.insert(test);
-	std::map<std::string, std::string>::iterator it;
-	ft::map<std::string, std::string>::iterator itm;
-	it = def.upper_bound("42");
-	itm = my.upper_bound("42");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound("43");
-	itm = my.upper_bound("43");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound("a");
-	itm = my.upper_bound("a");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
-	it = def.upper_bound("zzzzzzzzzzzzzzz");
-	itm = my.upper_bound("zzzzzzzzzzzzzzz");
-	std += it->first;
-	ft += itm->first;
-	std += it->second;
-	ft += itm->second;
+	std::map<std::string, std::string> test;
+	ft::map<std::string, std::string> myTest;
+	mapInsertElem(test, myTest, 100);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(test, myTest, std, ft);
+	def = test;
+	my = myTest;
+	mapFillStr(def, my, std, ft);
+	mapFillStr(test, myTest, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6650,38 +9265,3047 @@ void upperBoundTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Equal range map
+//MARK: - Iterator map
 
-void equalRangeTest(std::string &std, std::string &ft) {
-	std::cout << "Equal range int test" << " ";
-	std::map<int, int> def;
-	ft::map<int, int> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::map<int, int>::iterator, std::map<int, int>::iterator> test;
-	std::pair<ft::map<int, int>::iterator, ft::map<int, int>::iterator> myTest;
-	test = def.equal_range(100);
-	myTest = my.equal_range(100);
-	std += test.first->first;
-	std += test.first->second;
-	std += test.second->first;
-	std += test.second->second;
-	ft += myTest.first->first;
-	ft += myTest.first->second;
-	ft += myTest.second->first;
-	ft += myTest.second->second;
-	std::pair<int, int> toTest(42, 42);
-	def.insert(toTest);
-	my.insert(toTest);
-	test = def.equal_range(42);
-	myTest = my.equal_range(42);
-	std += test.first->first;
-	std += test.first->second;
-	std += test.second->first;
-	std += test.second->second;
-	ft += myTest.first->first;
-	ft += myTest.first->second;
-	ft += myTest.second->first;
-	ft += myTest.second->second;
+void iteratorTestMap(std::string &std, std::string &ft, int number) {
+	std::map<int,int> testStd;
+	ft::map<int,int> testFt;
+	std::cout << "All iterator test" << " ";
+	for (int i = 0; i < number; i++) {
+		std::pair<int, int> res(rand(), rand());
+		testStd.insert(res);
+		testFt.insert(res);
+	}
+	std::map<int,int>::iterator it = testStd.begin();
+	std::map<int,int>::iterator ite = testStd.end();
+	ft::map<int,int>::iterator itm = testFt.begin();
+	ft::map<int,int>::iterator item = testFt.end();
+	while (it != ite) {
+		std += it->first;
+		std += it->second;
+		it++;
+	}
+	while (itm != item) {
+		ft += itm->first;
+		ft += itm->second;
+		itm++;
+	}
+	it = testStd.begin();
+	itm = testFt.begin();
+	while (ite != it) {
+		ite--;
+		std += ite->first;
+		std += ite->second;
+	}
+	while (item != itm) {
+		item--;
+		ft += item->first;
+		ft += item->second;
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Const iteratot map
+
+void constIteratorTestMap(std::string &std, std::string &ft, int number) {
+	std::map<int,int> testStd;
+	ft::map<int,int> testFt;
+	std::cout << "All const_iterator test" << " ";
+	for (int i = 0; i < number; i++) {
+		std::pair<int, int> res(rand(), rand());
+		testStd.insert(res);
+		testFt.insert(res);
+	}
+	std::map<int,int>::const_iterator it = testStd.cbegin();
+	std::map<int,int>::const_iterator ite = testStd.cend();
+	ft::map<int,int>::const_iterator itm = testFt.cbegin();
+	ft::map<int,int>::const_iterator item = testFt.cend();
+	while (it != ite) {
+		std += it->first;
+		std += it->second;
+		it++;
+	}
+	while (itm != item) {
+		ft += itm->first;
+		ft += itm->second;
+		itm++;
+	}
+	it = testStd.cbegin();
+	itm = testFt.cbegin();
+	while (ite != it) {
+		ite--;
+		std += ite->first;
+		std += ite->second;
+	}
+	while (item != itm) {
+		item--;
+		ft += item->first;
+		ft += item->second;
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Reverse iteratot map
+
+void reverseIteratorTestMap(std::string &std, std::string &ft, int number) {
+	std::map<int,int> testStd;
+	ft::map<int,int> testFt;
+	std::cout << "All reverse_iterator test" << " ";
+	for (int i = 0; i < number; i++) {
+		std::pair<int, int> res(rand(), rand());
+		testStd.insert(res);
+		testFt.insert(res);
+	}
+	std::map<int,int>::reverse_iterator it = testStd.rbegin();
+	std::map<int,int>::reverse_iterator ite = testStd.rend();
+	ft::map<int,int>::reverse_iterator itm = testFt.rbegin();
+	ft::map<int,int>::reverse_iterator item = testFt.rend();
+	while (it != ite) {
+		std += it->first;
+		std += it->second;
+		it++;
+	}
+	while (itm != item) {
+		ft += itm->first;
+		ft += itm->second;
+		itm++;
+	}
+	it = testStd.rbegin();
+	itm = testFt.rbegin();
+	while (ite != it) {
+		ite--;
+		std += ite->first;
+		std += ite->second;
+	}
+	while (item != itm) {
+		item--;
+		ft += item->first;
+		ft += item->second;
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Const reverse iteratot map
+
+void constReverseIteratorTestMap(std::string &std, std::string &ft, int number) {
+	std::map<int,int> testStd;
+	ft::map<int,int> testFt;
+	std::cout << "All const_reverse_iterator test" << " ";
+	for (int i = 0; i < number; i++) {
+		std::pair<int, int> res(rand(), rand());
+		testStd.insert(res);
+		testFt.insert(res);
+	}
+	std::map<int,int>::const_reverse_iterator it = testStd.crbegin();
+	std::map<int,int>::const_reverse_iterator ite = testStd.crend();
+	ft::map<int,int>::const_reverse_iterator itm = testFt.crbegin();
+	ft::map<int,int>::const_reverse_iterator item = testFt.crend();
+	while (it != ite) {
+		std += it->first;
+		std += it->second;
+		it++;
+	}
+	while (itm != item) {
+		ft += itm->first;
+		ft += itm->second;
+		itm++;
+	}
+	it = testStd.crbegin();
+	itm = testFt.crbegin();
+	while (ite != it) {
+		ite--;
+		std += ite->first;
+		std += ite->second;
+	}
+	while (item != itm) {
+		item--;
+		ft += item->first;
+		ft += item->second;
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Empty map
+
+void emptyMapTest(std::string &std, std::string &ft) {
+	std::cout << "Empty int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	std += def.empty();
+	ft += my.empty();
+	mapInsertElem(def, my, 10);
+	std += def.empty();
+	ft += my.empty();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void emptyMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Empty float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	std += def.empty();
+	ft += my.empty();
+	mapInsertElem(def, my, 10);
+	std += def.empty();
+	ft += my.empty();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void emptyMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Empty std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	std += def.empty();
+	ft += my.empty();
+	mapInsertElem(def, my, 10);
+	std += def.empty();
+	ft += my.empty();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Size map
+
+void sizeMapTest(std::string &std, std::string &ft) {
+	std::cout << "Size int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	std += def.size();
+	ft += my.size();
+	mapInsertElem(def, my, 10);
+	std += def.size();
+	ft += my.size();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void sizeMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Size float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	std += def.size();
+	ft += my.size();
+	mapInsertElem(def, my, 10);
+	std += def.size();
+	ft += my.size();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void sizeMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Size std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	std += def.size();
+	ft += my.size();
+	mapInsertElem(def, my, 10);
+	std += def.size();
+	ft += my.size();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Max size map
+
+void maxSizeTestMap(std::string &std, std::string &ft) {
+	std::cout << "Max size int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	std += def.max_size();
+	ft += my.max_size();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void maxSizeTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Max size float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	std += def.max_size();
+	ft += my.max_size();
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Operator [] map
+
+void squareBracketsTestMap(std::string &std, std::string &ft) {
+	std::cout << "Opetator[] int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<int, int> test(21, 42);
+	def.insert(test);
+	my.insert(test);
+	std += def[21];
+	ft += my[21];
+	std += def[42];
+	ft += my[42];
+	std += def[42];
+	ft += my[42];
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void squareBracketsTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Opetator[] float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<float, float> test(21, 42);
+	def.insert(test);
+	my.insert(test);
+	std += def[21];
+	ft += my[21];
+	std += def[42];
+	ft += my[42];
+	std += def[42];
+	ft += my[42];
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void squareBracketsTestMapStr(std::string &std, std::string &ft) {
+	std::cout << "Opetator[] std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::string, std::string> test("21", "42");
+	def.insert(test);
+	my.insert(test);
+	std += def["21"];
+	ft += my["21"];
+	std += def["42"];
+	ft += my["42"];
+	std += def["42"];
+	ft += my["42"];
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Insert map
+
+void singleInsertMap(std::string &std, std::string &ft) {
+	std::cout << "Single insert int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapFillStr(def, my, std, ft);
+	std::pair<int, int> test(42, 21);
+	def.insert(test);
+	my.insert(test);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void singleInsertMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Single insert float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapFillStr(def, my, std, ft);
+	std::pair<float, float> test(42.21, 21.42);
+	def.insert(test);
+	my.insert(test);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void singleInsertMapStr(std::string &std, std::string &ft) {
+	std::cout << "Single insert std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapFillStr(def, my, std, ft);
+	std::pair<std::string, std::string> test("42", "21");
+	def.insert(test);
+	my.insert(test);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void withHitInsertMap(std::string &std, std::string &ft) {
+	std::cout << "With hit insert int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapFillStr(def, my, std, ft);
+	std::pair<int, int> test(42, 21);
+	def.insert(def.begin(),test);
+	my.insert(my.begin(), test);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void withHitInsertMapFloat(std::string &std, std::string &ft) {
+	std::cout << "With hit insert float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapFillStr(def, my, std, ft);
+	std::pair<float, float> test(42.21, 21.42);
+	def.insert(def.begin(),test);
+	my.insert(my.begin(), test);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void withHitInsertMapStr(std::string &std, std::string &ft) {
+	std::cout << "With hit insert std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapFillStr(def, my, std, ft);
+	std::pair<std::string, std::string> test("42", "21");
+	def.insert(def.begin(),test);
+	my.insert(my.begin(), test);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void rangeInsertMapTest(std::string &std, std::string &ft) {
+	std::cout << "Range insert int test" << " ";
+	std::map<int, int> test;
+	for (int i = 0; i < 100; i++) {
+		std::pair<int, int> l(rand(), rand());
+		test.insert(l);
+	}
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	def.insert(test.begin(), test.end());
+	my.insert(test.begin(), test.end());
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void rangeInsertMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Range insert float test" << " ";
+	std::map<float, float> test;
+	for (int i = 0; i < 100; i++) {
+		std::pair<float, float> l(rand(), rand());
+		test.insert(l);
+	}
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	def.insert(test.begin(), test.end());
+	my.insert(test.begin(), test.end());
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void rangeInsertMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Range insert std::string test" << " ";
+	std::map<std::string, std::string> test;
+	for (int i = 0; i < 100; i++) {
+		std::string l1;
+		std::string l2;
+		l1 += rand();
+		l2 += rand();
+		std::pair<std::string, std::string> l(l1, l2);
+		test.insert(l);
+	}
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	def.insert(test.begin(), test.end());
+	my.insert(test.begin(), test.end());
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Erase map
+
+void eraseSingleMapTest(std::string &std, std::string &ft) {
+	std::cout << "Single erase int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	mapFillStr(def, my, std, ft);
+	std::map<int, int>::iterator it = def.begin();
+	ft::map<int, int>::iterator mit = my.begin();
+	for (int i = 0; i < 10; i++) {
+		it++;
+		mit++;
+	}
+	for (int i = 0; i < 40; i++) {
+		std::map<int, int>::iterator tmp = it;
+		ft::map<int, int>::iterator mtmp = mit;
+		it++;
+		mit++;
+		def.erase(tmp);
+		my.erase(mtmp);
+		mapFillStr(def, my, std, ft);
+	}
+	it = def.end();
+	mit = my.end();
+	it--;
+	mit--;
+	for (int i = 0; i < 20; i++) {
+		std::map<int, int>::iterator tmp = it;
+		ft::map<int, int>::iterator mtmp = mit;
+		it--;
+		mit--;
+		def.erase(tmp);
+		my.erase(mtmp);
+		mapFillStr(def, my, std, ft);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseSingleMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Single erase float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	mapFillStr(def, my, std, ft);
+	std::map<float, float>::iterator it = def.begin();
+	ft::map<float, float>::iterator mit = my.begin();
+	for (int i = 0; i < 10; i++) {
+		it++;
+		mit++;
+	}
+	for (int i = 0; i < 40; i++) {
+		std::map<float, float>::iterator tmp = it;
+		ft::map<float, float>::iterator mtmp = mit;
+		it++;
+		mit++;
+		def.erase(tmp);
+		my.erase(mtmp);
+		mapFillStr(def, my, std, ft);
+	}
+	it = def.end();
+	mit = my.end();
+	it--;
+	mit--;
+	for (int i = 0; i < 20; i++) {
+		std::map<float, float>::iterator tmp = it;
+		ft::map<float, float>::iterator mtmp = mit;
+		it--;
+		mit--;
+		def.erase(tmp);
+		my.erase(mtmp);
+		mapFillStr(def, my, std, ft);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseSingleMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Single erase std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	mapFillStr(def, my, std, ft);
+	std::map<std::string, std::string>::iterator it = def.begin();
+	ft::map<std::string, std::string>::iterator mit = my.begin();
+	for (int i = 0; i < 10; i++) {
+		it++;
+		mit++;
+	}
+	for (int i = 0; i < 40; i++) {
+		std::map<std::string, std::string>::iterator tmp = it;
+		ft::map<std::string, std::string>::iterator mtmp = mit;
+		it++;
+		mit++;
+		def.erase(tmp);
+		my.erase(mtmp);
+		mapFillStr(def, my, std, ft);
+	}
+	it = def.end();
+	mit = my.end();
+	it--;
+	mit--;
+	for (int i = 0; i < 20; i++) {
+		std::map<std::string, std::string>::iterator tmp = it;
+		ft::map<std::string, std::string>::iterator mtmp = mit;
+		it--;
+		mit--;
+		def.erase(tmp);
+		my.erase(mtmp);
+		mapFillStr(def, my, std, ft);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseKeyMapTest(std::string &std, std::string &ft) {
+	std::cout << "Key erase int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<int, int> test(42, 42);
+	def.insert(test);
+	my.insert(test);
+	def.erase(42);
+	my.erase(42);
+	def.erase(1);
+	my.erase(1);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseKeyMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Key erase float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<float, float> test(42.21, 42.21);
+	def.insert(test);
+	my.insert(test);
+	def.erase(42.21);
+	my.erase(42.21);
+	def.erase(1.7);
+	my.erase(1.7);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseKeyMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Key erase std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::string, std::string> test("42", "42");
+	def.insert(test);
+	my.insert(test);
+	def.erase("42");
+	my.erase("42");
+	def.erase("1");
+	my.erase("1");
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseRangeTest(std::string &std, std::string &ft) {
+	std::cout << "Range erase int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::map<int, int>::iterator it = def.begin();
+	std::map<int, int>::iterator ite = def.end();
+	ft::map<int, int>::iterator itm = my.begin();
+	ft::map<int, int>::iterator item = my.end();
+	for (int i = 0; i < 20; i++) {
+		++it;
+		++itm;
+		--ite;
+		--item;
+	}
+	def.erase(it, ite);
+	my.erase(itm, item);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseRangeTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Range erase float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::map<float, float>::iterator it = def.begin();
+	std::map<float, float>::iterator ite = def.end();
+	ft::map<float, float>::iterator itm = my.begin();
+	ft::map<float, float>::iterator item = my.end();
+	for (int i = 0; i < 20; i++) {
+		++it;
+		++itm;
+		--ite;
+		--item;
+	}
+	def.erase(it, ite);
+	my.erase(itm, item);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseRangeTestStr(std::string &std, std::string &ft) {
+	std::cout << "Range erase std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::map<std::string, std::string>::iterator it = def.begin();
+	std::map<std::string, std::string>::iterator ite = def.end();
+	ft::map<std::string, std::string>::iterator itm = my.begin();
+	ft::map<std::string, std::string>::iterator item = my.end();
+	for (int i = 0; i < 20; i++) {
+		++it;
+		++itm;
+		--ite;
+		--item;
+	}
+	def.erase(it, ite);
+	my.erase(itm, item);
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Swap map
+
+void swapTestMap(std::string &std, std::string &ft) {
+	std::cout << "Swap int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	std::map<int, int> toSwap;
+	ft::map<int, int> mySwap;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(toSwap, mySwap, 50);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(toSwap, mySwap, std, ft);
+	def.swap(toSwap);
+	my.swap(mySwap);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(toSwap, mySwap, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void swapTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Swap float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	std::map<float, float> toSwap;
+	ft::map<float, float> mySwap;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(toSwap, mySwap, 50);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(toSwap, mySwap, std, ft);
+	def.swap(toSwap);
+	my.swap(mySwap);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(toSwap, mySwap, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void swapTestMapStr(std::string &std, std::string &ft) {
+	std::cout << "Swap std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	std::map<std::string, std::string> toSwap;
+	ft::map<std::string, std::string> mySwap;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(toSwap, mySwap, 50);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(toSwap, mySwap, std, ft);
+	def.swap(toSwap);
+	my.swap(mySwap);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(toSwap, mySwap, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Clear map
+
+void clearTestMap(std::string &std, std::string &ft) {
+	std::cout << "Clear int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	mapFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void clearTestMapFloat(std::string &std, std::string &ft) {
+	std::cout << "Clear float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	mapFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void clearTestMapStr(std::string &std, std::string &ft) {
+	std::cout << "Clear std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	mapFillStr(def, my, std, ft);
+	def.clear();
+	my.clear();
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Key compare map
+
+void keyCompareTest(std::string &std, std::string &ft) {
+	std::cout << "Key comp int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	std::map<int,int>::key_compare comp = def.key_comp();
+	ft::map<int,int>::key_compare myComp = my.key_comp();
+	int i = 10000;
+	mapInsertElem(def, my, 100);
+	for (std::map<int, int>::iterator it = def.begin(); it != def.end(); ++it) {
+		std += comp(i, it->first);
+		ft += myComp(i, it->first);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void keyCompareTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Key comp float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	std::map<float,float>::key_compare comp = def.key_comp();
+	ft::map<float,float>::key_compare myComp = my.key_comp();
+	float i = 10000.42;
+	mapInsertElem(def, my, 100);
+	for (std::map<float, float>::iterator it = def.begin(); it != def.end(); ++it) {
+		std += comp(i, it->first);
+		ft += myComp(i, it->first);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void keyCompareTestStr(std::string &std, std::string &ft) {
+	std::cout << "Key comp std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	std::map<std::string,std::string>::key_compare comp = def.key_comp();
+	ft::map<std::string,std::string>::key_compare myComp = my.key_comp();
+	std::string i = "10000";
+	mapInsertElem(def, my, 100);
+	for (std::map<std::string, std::string>::iterator it = def.begin(); it != def.end(); ++it) {
+		std += comp(i, it->first);
+		ft += myComp(i, it->first);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Value compare map
+
+void valueCompareTest(std::string &std, std::string &ft) {
+	std::cout << "Value comp int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<int, int> res(100,100);
+	for (std::map<int, int>::iterator it = def.begin(); it != def.end(); ++it) {
+		std += def.value_comp()(res, *it);
+		ft += my.value_comp()(res, *it);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void valueCompareTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Value comp float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<float, float> res(100.42,100.42);
+	for (std::map<float, float>::iterator it = def.begin(); it != def.end(); ++it) {
+		std += def.value_comp()(res, *it);
+		ft += my.value_comp()(res, *it);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void valueCompareTestStr(std::string &std, std::string &ft) {
+	std::cout << "Value comp std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::string, std::string> res("100","100");
+	for (std::map<std::string, std::string>::iterator it = def.begin(); it != def.end(); ++it) {
+		std += def.value_comp()(res, *it);
+		ft += my.value_comp()(res, *it);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Find map
+
+void findTest(std::string &std, std::string &ft) {
+	std::cout << "Find int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<int, int> test(42, 42);
+	def.insert(test);
+	my.insert(test);
+	std::map<int, int>::iterator it;
+	ft::map<int, int>::iterator ite;
+	it = def.find(42);
+	ite = my.find(42);
+	std += it->first;
+	std += it->second;
+	ft += ite->first;
+	ft += ite->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void findTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Find float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<float, float> test(42.21, 42.21);
+	def.insert(test);
+	my.insert(test);
+	std::map<float, float>::iterator it;
+	ft::map<float, float>::iterator ite;
+	it = def.find(42.21);
+	ite = my.find(42.21);
+	std += it->first;
+	std += it->second;
+	ft += ite->first;
+	ft += ite->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void findTestStr(std::string &std, std::string &ft) {
+	std::cout << "Find std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::string, std::string> test("42", "42");
+	def.insert(test);
+	my.insert(test);
+	std::map<std::string, std::string>::iterator it;
+	ft::map<std::string, std::string>::iterator ite;
+	it = def.find("42");
+	ite = my.find("42");
+	std += it->first;
+	std += it->second;
+	ft += ite->first;
+	ft += ite->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Count map
+
+void countTest(std::string &std, std::string &ft) {
+	std::cout << "Count int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<int, int> test(42, 42);
+	std::pair<int, int> test1(21, 21);
+	def.insert(test);
+	my.insert(test);
+	def.insert(test);
+	my.insert(test);
+	std += def.count(42);
+	ft += my.count(42);
+	std += def.count(21);
+	ft += my.count(21);
+	std += def.count(72);
+	ft += my.count(72);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void countTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Count float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<float, float> test(42.21, 42.21);
+	std::pair<float, float> test1(21.42, 21.42);
+	def.insert(test);
+	my.insert(test);
+	def.insert(test);
+	my.insert(test);
+	std += def.count(42.21);
+	ft += my.count(42.21);
+	std += def.count(21.42);
+	ft += my.count(21.42);
+	std += def.count(72.1);
+	ft += my.count(72.1);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void countTestStr(std::string &std, std::string &ft) {
+	std::cout << "Count std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::string, std::string> test("42", "42");
+	std::pair<std::string, std::string> test1("21", "21");
+	def.insert(test);
+	my.insert(test);
+	def.insert(test);
+	my.insert(test);
+	std += def.count("42");
+	ft += my.count("42");
+	std += def.count("21");
+	ft += my.count("21");
+	std += def.count("72");
+	ft += my.count("72");
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Lover bound map
+
+void lowerBoundTest(std::string &std, std::string &ft) {
+	std::cout << "Lower bound int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<int, int> test(42, 42);
+	def.insert(test);
+	my.insert(test);
+	std::map<int, int>::iterator it;
+	ft::map<int, int>::iterator itm;
+	it = def.lower_bound(42);
+	itm = my.lower_bound(42);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound(43);
+	itm = my.lower_bound(43);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound(-9999999);
+	itm = my.lower_bound(-9999999);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound(999999999);
+	itm = my.lower_bound(999999999);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void lowerBoundTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Lower bound float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<float, float> test(42.21, 42.21);
+	def.insert(test);
+	my.insert(test);
+	std::map<float, float>::iterator it;
+	ft::map<float, float>::iterator itm;
+	it = def.lower_bound(42.21);
+	itm = my.lower_bound(42.21);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound(43.21);
+	itm = my.lower_bound(43.21);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound(-9999999.0);
+	itm = my.lower_bound(-9999999.0);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound(999999999.0);
+	itm = my.lower_bound(999999999.0);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void lowerBoundTestStr(std::string &std, std::string &ft) {
+	std::cout << "Lower bound std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::string, std::string> test("42", "42");
+	def.insert(test);
+	my.insert(test);
+	std::map<std::string, std::string>::iterator it;
+	ft::map<std::string, std::string>::iterator itm;
+	it = def.lower_bound("42");
+	itm = my.lower_bound("42");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound("43");
+	itm = my.lower_bound("43");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound("a");
+	itm = my.lower_bound("a");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.lower_bound("zzzzzzzzzzzzzzz");
+	itm = my.lower_bound("zzzzzzzzzzzzzzz");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Upper bound map
+
+void upperBoundTest(std::string &std, std::string &ft) {
+	std::cout << "Upper bound int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<int, int> test(42, 42);
+	def.insert(test);
+	my.insert(test);
+	std::map<int, int>::iterator it;
+	ft::map<int, int>::iterator itm;
+	it = def.upper_bound(42);
+	itm = my.upper_bound(42);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound(43);
+	itm = my.upper_bound(43);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound(-9999999);
+	itm = my.upper_bound(-9999999);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound(999999999);
+	itm = my.upper_bound(999999999);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void upperBoundTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Upper bound float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<float, float> test(42.21, 42.21);
+	def.insert(test);
+	my.insert(test);
+	std::map<float, float>::iterator it;
+	ft::map<float, float>::iterator itm;
+	it = def.upper_bound(42.21);
+	itm = my.upper_bound(42.21);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound(43.21);
+	itm = my.upper_bound(43.21);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound(-9999999.0);
+	itm = my.upper_bound(-9999999.0);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound(999999999.0);
+	itm = my.upper_bound(999999999.0);
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void upperBoundTestStr(std::string &std, std::string &ft) {
+	std::cout << "Upper bound std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::string, std::string> test("42", "42");
+	def.insert(test);
+	my.insert(test);
+	std::map<std::string, std::string>::iterator it;
+	ft::map<std::string, std::string>::iterator itm;
+	it = def.upper_bound("42");
+	itm = my.upper_bound("42");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound("43");
+	itm = my.upper_bound("43");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound("a");
+	itm = my.upper_bound("a");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	it = def.upper_bound("zzzzzzzzzzzzzzz");
+	itm = my.upper_bound("zzzzzzzzzzzzzzz");
+	std += it->first;
+	ft += itm->first;
+	std += it->second;
+	ft += itm->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Equal range map
+
+void equalRangeTest(std::string &std, std::string &ft) {
+	std::cout << "Equal range int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::map<int, int>::iterator, std::map<int, int>::iterator> test;
+	std::pair<ft::map<int, int>::iterator, ft::map<int, int>::iterator> myTest;
+	test = def.equal_range(100);
+	myTest = my.equal_range(100);
+	std += test.first->first;
+	std += test.first->second;
+	std += test.second->first;
+	std += test.second->second;
+	ft += myTest.first->first;
+	ft += myTest.first->second;
+	ft += myTest.second->first;
+	ft += myTest.second->second;
+	std::pair<int, int> toTest(42, 42);
+	def.insert(toTest);
+	my.insert(toTest);
+	test = def.equal_range(42);
+	myTest = my.equal_range(42);
+	std += test.first->first;
+	std += test.first->second;
+	std += test.second->first;
+	std += test.second->second;
+	ft += myTest.first->first;
+	ft += myTest.first->second;
+	ft += myTest.second->first;
+	ft += myTest.second->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void equalRangeTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Equal range float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::map<float, float>::iterator, std::map<float, float>::iterator> test;
+	std::pair<ft::map<float, float>::iterator, ft::map<float, float>::iterator> myTest;
+	test = def.equal_range(100);
+	myTest = my.equal_range(100);
+	std += test.first->first;
+	std += test.first->second;
+	std += test.second->first;
+	std += test.second->second;
+	ft += myTest.first->first;
+	ft += myTest.first->second;
+	ft += myTest.second->first;
+	ft += myTest.second->second;
+	std::pair<float, float> toTest(42.21, 42.21);
+	def.insert(toTest);
+	my.insert(toTest);
+	test = def.equal_range(42.21);
+	myTest = my.equal_range(42.21);
+	std += test.first->first;
+	std += test.first->second;
+	std += test.second->first;
+	std += test.second->second;
+	ft += myTest.first->first;
+	ft += myTest.first->second;
+	ft += myTest.second->first;
+	ft += myTest.second->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void equalRangeTestStr(std::string &std, std::string &ft) {
+	std::cout << "Equal range std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	std::pair<std::map<std::string, std::string>::iterator, std::map<std::string, std::string>::iterator> test;
+	std::pair<ft::map<std::string, std::string>::iterator, ft::map<std::string, std::string>::iterator> myTest;
+	test = def.equal_range("100");
+	myTest = my.equal_range("100");
+	std += test.first->first;
+	std += test.first->second;
+	std += test.second->first;
+	std += test.second->second;
+	ft += myTest.first->first;
+	ft += myTest.first->second;
+	ft += myTest.second->first;
+	ft += myTest.second->second;
+	std::pair<std::string, std::string> toTest("42", "42");
+	def.insert(toTest);
+	my.insert(toTest);
+	test = def.equal_range("42");
+	myTest = my.equal_range("42");
+	std += test.first->first;
+	std += test.first->second;
+	std += test.second->first;
+	std += test.second->second;
+	ft += myTest.first->first;
+	ft += myTest.first->second;
+	ft += myTest.second->first;
+	ft += myTest.second->second;
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Order statistics map
+
+void orderStatisticsTest(std::string &std, std::string &ft) {
+	std::cout << "Order statistics int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	for (size_t i = 0; i < def.size(); i += 3) {
+		std::map<int, int>::iterator it = def.begin();
+		std::advance(it, i);
+		std += it->first;
+		ft += my.nth(i)->first;
+	}
+	for (int i = 0; i < 100; i++) {
+		int key;
+		key = rand();
+		std += std::distance(def.begin(), def.lower_bound(key));
+		ft += my.rank(key);
+	}
+	ft::map<int, int>::iterator first = my.nth(1);
+	ft::map<int, int>::iterator last = my.nth(my.size() - 1);
+	std += def.size() - 2;
+	ft += distance(first, last);
+	std += def.size();
+	ft += distance(my.begin(), my.end());
+	std += def.size();
+	ft += distance(my.rbegin(), my.rend());
+	std += def.size() - 1;
+	ft += distance(my.crbegin(), --my.crend());
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void orderStatisticsTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Order statistics float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	for (size_t i = 0; i < def.size(); i += 3) {
+		std::map<float, float>::iterator it = def.begin();
+		std::advance(it, i);
+		std += it->first;
+		ft += my.nth(i)->first;
+	}
+	for (int i = 0; i < 100; i++) {
+		float key;
+		key = rand();
+		std += std::distance(def.begin(), def.lower_bound(key));
+		ft += my.rank(key);
+	}
+	ft::map<float, float>::iterator first = my.nth(1);
+	ft::map<float, float>::iterator last = my.nth(my.size() - 1);
+	std += def.size() - 2;
+	ft += distance(first, last);
+	std += def.size();
+	ft += distance(my.begin(), my.end());
+	std += def.size();
+	ft += distance(my.rbegin(), my.rend());
+	std += def.size() - 1;
+	ft += distance(my.crbegin(), --my.crend());
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void orderStatisticsTestStr(std::string &std, std::string &ft) {
+	std::cout << "Order statistics std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	for (size_t i = 0; i < def.size(); i += 3) {
+		std::map<std::string, std::string>::iterator it = def.begin();
+		std::advance(it, i);
+		std += it->first;
+		ft += my.nth(i)->first;
+	}
+	for (int i = 0; i < 100; i++) {
+		std::string key;
+		key = rand();
+		std += std::distance(def.begin(), def.lower_bound(key));
+		ft += my.rank(key);
+	}
+	ft::map<std::string, std::string>::iterator first = my.nth(1);
+	ft::map<std::string, std::string>::iterator last = my.nth(my.size() - 1);
+	std += def.size() - 2;
+	ft += distance(first, last);
+	std += def.size();
+	ft += distance(my.begin(), my.end());
+	std += def.size();
+	ft += distance(my.rbegin(), my.rend());
+	std += def.size() - 1;
+	ft += distance(my.crbegin(), --my.crend());
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void countRangeTest(std::string &std, std::string &ft) {
+	std::cout << "Count range int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	for (int i = 0; i < 100; i++) {
+		int lo;
+		int hi;
+		lo = rand();
+		hi = rand();
+		size_t expected = 0;
+		if (lo < hi)
+			expected = std::distance(def.lower_bound(lo), def.lower_bound(hi));
+		std += expected;
+		ft += my.count_range(lo, hi);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void countRangeTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Count range float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	for (int i = 0; i < 100; i++) {
+		float lo;
+		float hi;
+		lo = rand();
+		hi = rand();
+		size_t expected = 0;
+		if (lo < hi)
+			expected = std::distance(def.lower_bound(lo), def.lower_bound(hi));
+		std += expected;
+		ft += my.count_range(lo, hi);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void countRangeTestStr(std::string &std, std::string &ft) {
+	std::cout << "Count range std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	for (int i = 0; i < 100; i++) {
+		std::string lo;
+		std::string hi;
+		lo = rand();
+		hi = rand();
+		size_t expected = 0;
+		if (lo < hi)
+			expected = std::distance(def.lower_bound(lo), def.lower_bound(hi));
+		std += expected;
+		ft += my.count_range(lo, hi);
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Set operations map
+
+void mergeMapTest(std::string &std, std::string &ft) {
+	std::cout << "Merge int test" << " ";
+	std::map<int, int> def;
+	std::map<int, int> defSrc;
+	ft::map<int, int> my;
+	ft::map<int, int> mySrc;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defSrc, mySrc, 100);
+	std::map<int, int> left;
+	for (std::map<int, int>::iterator it = defSrc.begin(); it != defSrc.end(); it++)
+		if (def.insert(*it).second == false)
+			left.insert(*it);
+	defSrc = left;
+	my.merge(mySrc);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defSrc, mySrc, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void mergeMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Merge float test" << " ";
+	std::map<float, float> def;
+	std::map<float, float> defSrc;
+	ft::map<float, float> my;
+	ft::map<float, float> mySrc;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defSrc, mySrc, 100);
+	std::map<float, float> left;
+	for (std::map<float, float>::iterator it = defSrc.begin(); it != defSrc.end(); it++)
+		if (def.insert(*it).second == false)
+			left.insert(*it);
+	defSrc = left;
+	my.merge(mySrc);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defSrc, mySrc, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void mergeMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Merge std::string test" << " ";
+	std::map<std::string, std::string> def;
+	std::map<std::string, std::string> defSrc;
+	ft::map<std::string, std::string> my;
+	ft::map<std::string, std::string> mySrc;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defSrc, mySrc, 100);
+	std::map<std::string, std::string> left;
+	for (std::map<std::string, std::string>::iterator it = defSrc.begin(); it != defSrc.end(); it++)
+		if (def.insert(*it).second == false)
+			left.insert(*it);
+	defSrc = left;
+	my.merge(mySrc);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defSrc, mySrc, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void setOperationsMapTest(std::string &std, std::string &ft) {
+	std::cout << "Unite, intersect and subtract int test" << " ";
+	std::map<int, int> def;
+	std::map<int, int> defOther;
+	ft::map<int, int> my;
+	ft::map<int, int> myOther;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defOther, myOther, 100);
+	std::map<int, int> defUnion(def);
+	ft::map<int, int> myUnion(my);
+	defUnion.insert(defOther.begin(), defOther.end());
+	myUnion.unite(myOther);
+	mapFillStr(defUnion, myUnion, std, ft);
+	std::map<int, int> defIntersection;
+	ft::map<int, int> myIntersection(my);
+	for (std::map<int, int>::iterator it = def.begin(); it != def.end(); it++)
+		if (defOther.count(it->first))
+			defIntersection.insert(*it);
+	myIntersection.intersect(myOther);
+	mapFillStr(defIntersection, myIntersection, std, ft);
+	for (std::map<int, int>::iterator it = defOther.begin(); it != defOther.end(); it++)
+		def.erase(it->first);
+	my.subtract(myOther);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void setOperationsMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Unite, intersect and subtract float test" << " ";
+	std::map<float, float> def;
+	std::map<float, float> defOther;
+	ft::map<float, float> my;
+	ft::map<float, float> myOther;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defOther, myOther, 100);
+	std::map<float, float> defUnion(def);
+	ft::map<float, float> myUnion(my);
+	defUnion.insert(defOther.begin(), defOther.end());
+	myUnion.unite(myOther);
+	mapFillStr(defUnion, myUnion, std, ft);
+	std::map<float, float> defIntersection;
+	ft::map<float, float> myIntersection(my);
+	for (std::map<float, float>::iterator it = def.begin(); it != def.end(); it++)
+		if (defOther.count(it->first))
+			defIntersection.insert(*it);
+	myIntersection.intersect(myOther);
+	mapFillStr(defIntersection, myIntersection, std, ft);
+	for (std::map<float, float>::iterator it = defOther.begin(); it != defOther.end(); it++)
+		def.erase(it->first);
+	my.subtract(myOther);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void setOperationsMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Unite, intersect and subtract std::string test" << " ";
+	std::map<std::string, std::string> def;
+	std::map<std::string, std::string> defOther;
+	ft::map<std::string, std::string> my;
+	ft::map<std::string, std::string> myOther;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defOther, myOther, 100);
+	std::map<std::string, std::string> defUnion(def);
+	ft::map<std::string, std::string> myUnion(my);
+	defUnion.insert(defOther.begin(), defOther.end());
+	myUnion.unite(myOther);
+	mapFillStr(defUnion, myUnion, std, ft);
+	std::map<std::string, std::string> defIntersection;
+	ft::map<std::string, std::string> myIntersection(my);
+	for (std::map<std::string, std::string>::iterator it = def.begin(); it != def.end(); it++)
+		if (defOther.count(it->first))
+			defIntersection.insert(*it);
+	myIntersection.intersect(myOther);
+	mapFillStr(defIntersection, myIntersection, std, ft);
+	for (std::map<std::string, std::string>::iterator it = defOther.begin(); it != defOther.end(); it++)
+		def.erase(it->first);
+	my.subtract(myOther);
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void throwingSetOperationsMapTest(std::string &std, std::string &ft) {
+	std::cout << "Merge, unite, intersect and subtract with throwing comparator test" << " ";
+	typedef ft::map<int, int, ThrowingLess> Map;
+	for (int op = 0; op < 4; op++) {
+		for (long budget = 0; budget < 4000; budget += 97) {
+			comparisonBudget = -1;
+			Map my;
+			Map myOther;
+			for (int i = 0; i < 500; i++) {
+				my[i * 2] = i;
+				myOther[i * 3] = i;
+			}
+			size_t total = my.size() + myOther.size();
+			comparisonBudget = budget;
+			try {
+				if (op == 0)
+					my.merge(myOther);
+				else if (op == 1)
+					my.unite(myOther);
+				else if (op == 2)
+					my.intersect(myOther);
+				else
+					my.subtract(myOther);
+			}
+			catch (std::runtime_error &) {}
+			comparisonBudget = -1;
+			std += true;
+			ft += mapIsConsistent(my) && mapIsConsistent(myOther);
+			std += true;
+			ft += op != 0 || my.size() + myOther.size() == total;
+		}
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Node handle map
+
+void extractMapTest(std::string &std, std::string &ft) {
+	std::cout << "Extract and insert node int test" << " ";
+	std::map<int, int> def;
+	std::map<int, int> defOther;
+	ft::map<int, int> my;
+	ft::map<int, int> myOther;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defOther, myOther, 100);
+	int i = 0;
+	for (std::map<int, int>::iterator it = def.begin(); it != def.end(); i++) {
+		std::map<int, int>::iterator tmp = it++;
+		if (i % 2 == 0) {
+			std += defOther.insert(*tmp).second;
+			def.erase(tmp);
+		}
+	}
+	i = 0;
+	for (ft::map<int, int>::iterator it = my.begin(); it != my.end(); i++) {
+		ft::map<int, int>::iterator tmp = it++;
+		if (i % 2 == 0)
+			ft += myOther.insert(my.extract(tmp)).inserted;
+	}
+	int key = defOther.begin()->first;
+	defOther.erase(key);
+	std += defOther.insert(std::make_pair(42, 42)).second;
+	ft::map<int, int>::node_type nh = myOther.extract(key);
+	nh.key() = 42;
+	nh.mapped() = 42;
+	ft += myOther.insert(std::move(nh)).inserted;
+	key = def.begin()->first;
+	std += defOther.insert(*def.begin()).second;
+	def.erase(key);
+	ft += myOther.insert(my.extract(key)).inserted;
+	std += true;
+	ft += my.extract(key).empty();
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void extractMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Extract and insert node float test" << " ";
+	std::map<float, float> def;
+	std::map<float, float> defOther;
+	ft::map<float, float> my;
+	ft::map<float, float> myOther;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defOther, myOther, 100);
+	int i = 0;
+	for (std::map<float, float>::iterator it = def.begin(); it != def.end(); i++) {
+		std::map<float, float>::iterator tmp = it++;
+		if (i % 2 == 0) {
+			std += defOther.insert(*tmp).second;
+			def.erase(tmp);
+		}
+	}
+	i = 0;
+	for (ft::map<float, float>::iterator it = my.begin(); it != my.end(); i++) {
+		ft::map<float, float>::iterator tmp = it++;
+		if (i % 2 == 0)
+			ft += myOther.insert(my.extract(tmp)).inserted;
+	}
+	float key = defOther.begin()->first;
+	defOther.erase(key);
+	std += defOther.insert(std::make_pair(42, 42)).second;
+	ft::map<float, float>::node_type nh = myOther.extract(key);
+	nh.key() = 42;
+	nh.mapped() = 42;
+	ft += myOther.insert(std::move(nh)).inserted;
+	key = def.begin()->first;
+	std += defOther.insert(*def.begin()).second;
+	def.erase(key);
+	ft += myOther.insert(my.extract(key)).inserted;
+	std += true;
+	ft += my.extract(key).empty();
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void extractMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Extract and insert node std::string test" << " ";
+	std::map<std::string, std::string> def;
+	std::map<std::string, std::string> defOther;
+	ft::map<std::string, std::string> my;
+	ft::map<std::string, std::string> myOther;
+	mapInsertElem(def, my, 100);
+	mapInsertElem(defOther, myOther, 100);
+	int i = 0;
+	for (std::map<std::string, std::string>::iterator it = def.begin(); it != def.end(); i++) {
+		std::map<std::string, std::string>::iterator tmp = it++;
+		if (i % 2 == 0) {
+			std += defOther.insert(*tmp).second;
+			def.erase(tmp);
+		}
+	}
+	i = 0;
+	for (ft::map<std::string, std::string>::iterator it = my.begin(); it != my.end(); i++) {
+		ft::map<std::string, std::string>::iterator tmp = it++;
+		if (i % 2 == 0)
+			ft += myOther.insert(my.extract(tmp)).inserted;
+	}
+	std::string key = defOther.begin()->first;
+	defOther.erase(key);
+	std += defOther.insert(std::make_pair("42", "42")).second;
+	ft::map<std::string, std::string>::node_type nh = myOther.extract(key);
+	nh.key() = "42";
+	nh.mapped() = "42";
+	ft += myOther.insert(std::move(nh)).inserted;
+	key = def.begin()->first;
+	std += defOther.insert(*def.begin()).second;
+	def.erase(key);
+	ft += myOther.insert(my.extract(key)).inserted;
+	std += true;
+	ft += my.extract(key).empty();
+	mapFillStr(def, my, std, ft);
+	mapFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Try emplace map
+
+void tryEmplaceMapTest(std::string &std, std::string &ft) {
+	std::cout << "Try emplace and insert or assign int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int> my;
+	mapInsertElem(def, my, 100);
+	for (int i = 0; i < 200; i++) {
+		int key;
+		int value;
+		key = rand() % 128;
+		value = rand();
+		std::pair<std::map<int, int>::iterator, bool> res = def.insert(std::make_pair(key, value));
+		std::pair<ft::map<int, int>::iterator, bool> resMy = my.try_emplace(key, value);
+		std += res.second;
+		std += res.first->second;
+		ft += resMy.second;
+		ft += resMy.first->second;
+		value = rand();
+		std += def.count(key) == 0;
+		def[key] = value;
+		resMy = my.insert_or_assign(key, value);
+		ft += resMy.second;
+		ft += resMy.first->second;
+		std += def[key];
+		key = rand() % 128;
+		std += def.emplace(key, value).second;
+		ft += my.emplace(key, value).second;
+		std += def.emplace_hint(def.begin(), key, value)->second;
+		ft += my.emplace_hint(my.begin(), key, value)->second;
+	}
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void tryEmplaceMapTestFloat(std::string &std, std::string &ft) {
+	std::cout << "Try emplace and insert or assign float test" << " ";
+	std::map<float, float> def;
+	ft::map<float, float> my;
+	mapInsertElem(def, my, 100);
+	for (int i = 0; i < 200; i++) {
+		float key;
+		float value;
+		key = rand() % 128;
+		value = rand();
+		std::pair<std::map<float, float>::iterator, bool> res = def.insert(std::make_pair(key, value));
+		std::pair<ft::map<float, float>::iterator, bool> resMy = my.try_emplace(key, value);
+		std += res.second;
+		std += res.first->second;
+		ft += resMy.second;
+		ft += resMy.first->second;
+		value = rand();
+		std += def.count(key) == 0;
+		def[key] = value;
+		resMy = my.insert_or_assign(key, value);
+		ft += resMy.second;
+		ft += resMy.first->second;
+		std += def[key];
+		key = rand() % 128;
+		std += def.emplace(key, value).second;
+		ft += my.emplace(key, value).second;
+		std += def.emplace_hint(def.begin(), key, value)->second;
+		ft += my.emplace_hint(my.begin(), key, value)->second;
+	}
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void tryEmplaceMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Try emplace and insert or assign std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string> my;
+	mapInsertElem(def, my, 100);
+	for (int i = 0; i < 200; i++) {
+		std::string key;
+		std::string value;
+		key = rand() % 128;
+		value = rand();
+		std::pair<std::map<std::string, std::string>::iterator, bool> res = def.insert(std::make_pair(key, value));
+		std::pair<ft::map<std::string, std::string>::iterator, bool> resMy = my.try_emplace(key, value);
+		std += res.second;
+		std += res.first->second;
+		ft += resMy.second;
+		ft += resMy.first->second;
+		value = rand();
+		std += def.count(key) == 0;
+		def[key] = value;
+		resMy = my.insert_or_assign(key, value);
+		ft += resMy.second;
+		ft += resMy.first->second;
+		std += def[key];
+		key = rand() % 128;
+		std += def.emplace(key, value).second;
+		ft += my.emplace(key, value).second;
+		std += def.emplace_hint(def.begin(), key, value)->second;
+		ft += my.emplace_hint(my.begin(), key, value)->second;
+	}
+	mapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Transparent lookup map
+
+void transparentLookupTest(std::string &std, std::string &ft) {
+	std::cout << "Transparent lookup int test" << " ";
+	std::map<int, int> def;
+	ft::map<int, int, ft::transparent_less> my;
+	for (int i = 0; i < 1000; i++) {
+		long key = rand() % 2000;
+		def[key] = i;
+		my[key] = i;
+	}
+	for (int i = 0; i < 500; i++) {
+		long key = rand() % 2000;
+		std += def.count(key);
+		ft += my.count(key);
+		std += (def.find(key) == def.end());
+		ft += (my.find(key) == my.end());
+		if (def.lower_bound(key) != def.end())
+			std += def.lower_bound(key)->first;
+		if (my.lower_bound(key) != my.end())
+			ft += my.lower_bound(key)->first;
+		if (def.upper_bound(key) != def.end())
+			std += def.upper_bound(key)->first;
+		if (my.upper_bound(key) != my.end())
+			ft += my.upper_bound(key)->first;
+	}
+	for (std::map<int, int>::iterator it = def.begin(); it != def.end(); it++) {
+		std += it->first;
+		std += it->second;
+	}
+	for (ft::map<int, int, ft::transparent_less>::iterator it = my.begin(); it != my.end(); it++) {
+		ft += it->first;
+		ft += it->second;
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void transparentLookupTestStr(std::string &std, std::string &ft) {
+	std::cout << "Transparent lookup std::string test" << " ";
+	std::map<std::string, std::string> def;
+	ft::map<std::string, std::string, ft::transparent_less> my;
+	for (int i = 0; i < 1000; i++) {
+		std::string key = std::to_string(rand() % 2000);
+		def[key.c_str()] = key;
+		my[key.c_str()] = key;
+	}
+	for (int i = 0; i < 500; i++) {
+		std::string key = std::to_string(rand() % 2000);
+		const char* query = key.c_str();
+		std += def.count(query);
+		ft += my.count(query);
+		std += (def.find(query) == def.end());
+		ft += (my.find(query) == my.end());
+		if (def.lower_bound(query) != def.end())
+			std += def.lower_bound(query)->first;
+		if (my.lower_bound(query) != my.end())
+			ft += my.lower_bound(query)->first;
+		if (def.upper_bound(query) != def.end())
+			std += def.upper_bound(query)->first;
+		if (my.upper_bound(query) != my.end())
+			ft += my.upper_bound(query)->first;
+	}
+	for (std::map<std::string, std::string>::iterator it = def.begin(); it != def.end(); it++) {
+		std += it->first;
+		std += it->second;
+	}
+	for (ft::map<std::string, std::string, ft::transparent_less>::iterator it = my.begin(); it != my.end(); it++) {
+		ft += it->first;
+		ft += it->second;
+	}
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Map
+
+void testMap() {
+	std::cout << "                            CONSTRUCTOR" << std::endl;
+	std::string std;
+	std::string ft;
+	defaultCnstTestMap(std, ft);
+	defaultCnstTestMapFloat(std, ft);
+	defaultCnstTestMapStr(std, ft);
+	rangeCnstTestMap(std, ft);
+	rangeCnstTestMapFloat(std, ft);
+	rangeCnstTestMapStr(std, ft);
+	copyCnstTestMap(std, ft);
+	copyCnstTestMapFloat(std, ft);
+	copyCnstTestMapStr(std, ft);
+	std::cout << "                            ASSIGNATION" << std::endl;
+	assignTestMap(std, ft);
+	assignTestMapFloat(std, ft);
+	assignTestMapStr(std, ft);
+	std::cout << "                            ITERATORS" << std::endl;
+	iteratorTestMap(std, ft, 1000);
+	constIteratorTestMap(std, ft, 1000);
+	reverseIteratorTestMap(std, ft, 1000);
+	constReverseIteratorTestMap(std, ft, 1000);
+	std::cout << "                            CAPACITY" << std::endl;
+	emptyMapTest(std, ft);
+	emptyMapTestFloat(std, ft);
+	emptyMapTestStr(std, ft);
+	sizeMapTest(std, ft);
+	sizeMapTestFloat(std, ft);
+	sizeMapTestStr(std, ft);
+	maxSizeTestMap(std, ft);
+	maxSizeTestMapFloat(std, ft);
+	std::cout << "                            ELEMENT ACCESS" << std::endl;
+	squareBracketsTestMap(std, ft);
+	squareBracketsTestMapFloat(std, ft);
+	squareBracketsTestMapStr(std, ft);
+	std::cout << "                            MODIFIERS" << std::endl;
+	singleInsertMap(std, ft);
+	singleInsertMapFloat(std, ft);
+	singleInsertMapStr(std, ft);
+	withHitInsertMap(std, ft);
+	withHitInsertMapFloat(std, ft);
+	withHitInsertMapStr(std, ft);
+	rangeInsertMapTest(std, ft);
+	rangeInsertMapTestFloat(std, ft);
+	rangeInsertMapTestStr(std, ft);
+	eraseSingleMapTest(std, ft);
+	eraseSingleMapTestFloat(std, ft);
+	eraseSingleMapTestStr(std, ft);
+	eraseKeyMapTest(std, ft);
+	eraseKeyMapTestFloat(std, ft);
+	eraseKeyMapTestStr(std, ft);
+	eraseRangeTest(std, ft);
+	eraseRangeTestFloat(std, ft);
+	eraseRangeTestStr(std, ft);
+	swapTestMap(std, ft);
+	swapTestMapFloat(std, ft);
+	swapTestMapStr(std, ft);
+	clearTestMap(std, ft);
+	clearTestMapFloat(std, ft);
+	clearTestMapStr(std, ft);
+	std::cout << "                            OBSERVERS" << std::endl;
+	keyCompareTest(std, ft);
+	keyCompareTestFloat(std, ft);
+	keyCompareTestStr(std, ft);
+	valueCompareTest(std, ft);
+	valueCompareTestFloat(std, ft);
+	valueCompareTestStr(std, ft);
+	std::cout << "                            OPERATIONS" << std::endl;
+	findTest(std, ft);
+	findTestFloat(std, ft);
+	findTestStr(std, ft);
+	countTest(std, ft);
+	countTestFloat(std, ft);
+	countTestStr(std, ft);
+	lowerBoundTest(std, ft);
+	lowerBoundTestFloat(std, ft);
+	lowerBoundTestStr(std, ft);
+	upperBoundTest(std, ft);
+	upperBoundTestFloat(std, ft);
+	upperBoundTestStr(std, ft);
+	equalRangeTest(std, ft);
+	equalRangeTestFloat(std, ft);
+	equalRangeTestStr(std, ft);
+	std::cout << "                            ORDER STATISTICS" << std::endl;
+	orderStatisticsTest(std, ft);
+	orderStatisticsTestFloat(std, ft);
+	orderStatisticsTestStr(std, ft);
+	countRangeTest(std, ft);
+	countRangeTestFloat(std, ft);
+	countRangeTestStr(std, ft);
+	std::cout << "                            SET OPERATIONS" << std::endl;
+	mergeMapTest(std, ft);
+	mergeMapTestFloat(std, ft);
+	mergeMapTestStr(std, ft);
+	setOperationsMapTest(std, ft);
+	setOperationsMapTestFloat(std, ft);
+	setOperationsMapTestStr(std, ft);
+	throwingSetOperationsMapTest(std, ft);
+	std::cout << "                            NODE HANDLES" << std::endl;
+	extractMapTest(std, ft);
+	extractMapTestFloat(std, ft);
+	extractMapTestStr(std, ft);
+	std::cout << "                            EMPLACE" << std::endl;
+	tryEmplaceMapTest(std, ft);
+	tryEmplaceMapTestFloat(std, ft);
+	tryEmplaceMapTestStr(std, ft);
+	std::cout << "                            TRANSPARENT LOOKUP" << std::endl;
+	transparentLookupTest(std, ft);
+	transparentLookupTestStr(std, ft);
+}
+
+//MARK: - Insert set
+
+void insertSetTest(std::string &std, std::string &ft) {
+	std::cout << "Insert int test" << " ";
+	std::set<int> def;
+	ft::set<int> my;
+	setInsertElem(def, my, 1000, 100);
+	int toTest;
+	toTest = 42;
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	std += *def.insert(def.begin(), toTest);
+	ft += *my.insert(my.begin(), toTest);
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void insertSetTestStr(std::string &std, std::string &ft) {
+	std::cout << "Insert std::string test" << " ";
+	std::set<std::string> def;
+	ft::set<std::string> my;
+	setInsertElem(def, my, 1000, 100);
+	std::string toTest;
+	toTest = "*";
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	std += *def.insert(def.begin(), toTest);
+	ft += *my.insert(my.begin(), toTest);
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Erase set
+
+void eraseSetTest(std::string &std, std::string &ft) {
+	std::cout << "Erase int test" << " ";
+	std::set<int> def;
+	ft::set<int> my;
+	setInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 50; i++) {
+		int key;
+		key = rand() % 100;
+		std += def.erase(key);
+		ft += my.erase(key);
+	}
+	def.erase(def.begin());
+	my.erase(my.begin());
+	def.erase(--def.end());
+	my.erase(--my.end());
+	setFillStr(def, my, std, ft);
+	def.erase(++def.begin(), --def.end());
+	my.erase(++my.begin(), --my.end());
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseSetTestStr(std::string &std, std::string &ft) {
+	std::cout << "Erase std::string test" << " ";
+	std::set<std::string> def;
+	ft::set<std::string> my;
+	setInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 50; i++) {
+		std::string key;
+		key = rand() % 100;
+		std += def.erase(key);
+		ft += my.erase(key);
+	}
+	def.erase(def.begin());
+	my.erase(my.begin());
+	def.erase(--def.end());
+	my.erase(--my.end());
+	setFillStr(def, my, std, ft);
+	def.erase(++def.begin(), --def.end());
+	my.erase(++my.begin(), --my.end());
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Operations set
+
+void operationsSetTest(std::string &std, std::string &ft) {
+	std::cout << "Find, count and bounds int test" << " ";
+	std::set<int> def;
+	ft::set<int> my;
+	setInsertElem(def, my, 1000, 200);
+	for (int i = 0; i < 300; i++) {
+		int key;
+		key = rand() % 256;
+		std += def.count(key);
+		ft += my.count(key);
+		std += (def.find(key) == def.end());
+		ft += (my.find(key) == my.end());
+		if (def.lower_bound(key) != def.end())
+			std += *def.lower_bound(key);
+		if (my.lower_bound(key) != my.end())
+			ft += *my.lower_bound(key);
+		if (def.upper_bound(key) != def.end())
+			std += *def.upper_bound(key);
+		if (my.upper_bound(key) != my.end())
+			ft += *my.upper_bound(key);
+	}
+	std::set<int> defCopy(def);
+	ft::set<int> myCopy(my);
+	def.clear();
+	my.clear();
+	setFillStr(def, my, std, ft);
+	setFillStr(defCopy, myCopy, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void operationsSetTestStr(std::string &std, std::string &ft) {
+	std::cout << "Find, count and bounds std::string test" << " ";
+	std::set<std::string> def;
+	ft::set<std::string> my;
+	setInsertElem(def, my, 1000, 200);
+	for (int i = 0; i < 300; i++) {
+		std::string key;
+		key = rand() % 256;
+		std += def.count(key);
+		ft += my.count(key);
+		std += (def.find(key) == def.end());
+		ft += (my.find(key) == my.end());
+		if (def.lower_bound(key) != def.end())
+			std += *def.lower_bound(key);
+		if (my.lower_bound(key) != my.end())
+			ft += *my.lower_bound(key);
+		if (def.upper_bound(key) != def.end())
+			std += *def.upper_bound(key);
+		if (my.upper_bound(key) != my.end())
+			ft += *my.upper_bound(key);
+	}
+	std::set<std::string> defCopy(def);
+	ft::set<std::string> myCopy(my);
+	def.clear();
+	my.clear();
+	setFillStr(def, my, std, ft);
+	setFillStr(defCopy, myCopy, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Insert multiset
+
+void insertMultisetTest(std::string &std, std::string &ft) {
+	std::cout << "Insert and erase int test" << " ";
+	std::multiset<int> def;
+	ft::multiset<int> my;
+	setInsertElem(def, my, 1000, 100);
+	setFillStr(def, my, std, ft);
+	for (int i = 0; i < 50; i++) {
+		int key;
+		key = rand() % 100;
+		std += def.erase(key);
+		ft += my.erase(key);
+	}
+	def.erase(def.begin());
+	my.erase(my.begin());
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void insertMultisetTestStr(std::string &std, std::string &ft) {
+	std::cout << "Insert and erase std::string test" << " ";
+	std::multiset<std::string> def;
+	ft::multiset<std::string> my;
+	setInsertElem(def, my, 1000, 100);
+	setFillStr(def, my, std, ft);
+	for (int i = 0; i < 50; i++) {
+		std::string key;
+		key = rand() % 100;
+		std += def.erase(key);
+		ft += my.erase(key);
+	}
+	def.erase(def.begin());
+	my.erase(my.begin());
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Operations multiset
+
+void operationsMultisetTest(std::string &std, std::string &ft) {
+	std::cout << "Count and equal range int test" << " ";
+	std::multiset<int> def;
+	ft::multiset<int> my;
+	setInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 300; i++) {
+		int key;
+		key = rand() % 128;
+		std += def.count(key);
+		ft += my.count(key);
+		std += (def.find(key) == def.end());
+		ft += (my.find(key) == my.end());
+		std += std::distance(def.equal_range(key).first, def.equal_range(key).second);
+		ft += std::distance(my.equal_range(key).first, my.equal_range(key).second);
+	}
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void operationsMultisetTestStr(std::string &std, std::string &ft) {
+	std::cout << "Count and equal range std::string test" << " ";
+	std::multiset<std::string> def;
+	ft::multiset<std::string> my;
+	setInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 300; i++) {
+		std::string key;
+		key = rand() % 128;
+		std += def.count(key);
+		ft += my.count(key);
+		std += (def.find(key) == def.end());
+		ft += (my.find(key) == my.end());
+		std += std::distance(def.equal_range(key).first, def.equal_range(key).second);
+		ft += std::distance(my.equal_range(key).first, my.equal_range(key).second);
+	}
+	setFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Set
+
+void testSet() {
+	std::string std;
+	std::string ft;
+	std::cout << "                            SET" << std::endl;
+	insertSetTest(std, ft);
+	insertSetTestStr(std, ft);
+	eraseSetTest(std, ft);
+	eraseSetTestStr(std, ft);
+	operationsSetTest(std, ft);
+	operationsSetTestStr(std, ft);
+	std::cout << "                            MULTISET" << std::endl;
+	insertMultisetTest(std, ft);
+	insertMultisetTestStr(std, ft);
+	operationsMultisetTest(std, ft);
+	operationsMultisetTestStr(std, ft);
+}
+
+//MARK: - Insert multimap
+
+void insertMultimapTest(std::string &std, std::string &ft) {
+	std::cout << "Insert int test" << " ";
+	std::multimap<int, int> def;
+	ft::multimap<int, int> my;
+	multimapInsertElem(def, my, 1000, 100);
+	std::pair<int, int> toTest(42, 42);
+	std += def.insert(toTest)->second;
+	ft += my.insert(toTest)->second;
+	std += def.insert(def.begin(), toTest)->first;
+	ft += my.insert(my.begin(), toTest)->first;
+	multimapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void insertMultimapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Insert std::string test" << " ";
+	std::multimap<std::string, std::string> def;
+	ft::multimap<std::string, std::string> my;
+	multimapInsertElem(def, my, 1000, 100);
+	std::pair<std::string, std::string> toTest("*", "*");
+	std += def.insert(toTest)->second;
+	ft += my.insert(toTest)->second;
+	std += def.insert(def.begin(), toTest)->first;
+	ft += my.insert(my.begin(), toTest)->first;
+	multimapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Erase multimap
+
+void eraseMultimapTest(std::string &std, std::string &ft) {
+	std::cout << "Erase int test" << " ";
+	std::multimap<int, int> def;
+	ft::multimap<int, int> my;
+	multimapInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 50; i++) {
+		int key;
+		key = rand() % 100;
+		std += def.erase(key);
+		ft += my.erase(key);
+	}
+	def.erase(def.begin());
+	my.erase(my.begin());
+	multimapFillStr(def, my, std, ft);
+	def.erase(++def.begin(), --def.end());
+	my.erase(++my.begin(), --my.end());
+	multimapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseMultimapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Erase std::string test" << " ";
+	std::multimap<std::string, std::string> def;
+	ft::multimap<std::string, std::string> my;
+	multimapInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 50; i++) {
+		std::string key;
+		key = rand() % 100;
+		std += def.erase(key);
+		ft += my.erase(key);
+	}
+	def.erase(def.begin());
+	my.erase(my.begin());
+	multimapFillStr(def, my, std, ft);
+	def.erase(++def.begin(), --def.end());
+	my.erase(++my.begin(), --my.end());
+	multimapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Operations multimap
+
+void operationsMultimapTest(std::string &std, std::string &ft) {
+	std::cout << "Find, count and equal range int test" << " ";
+	std::multimap<int, int> def;
+	ft::multimap<int, int> my;
+	multimapInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 300; i++) {
+		int key;
+		key = rand() % 128;
+		std += def.count(key);
+		ft += my.count(key);
+		if (def.find(key) != def.end())
+			std += def.find(key)->second;
+		if (my.find(key) != my.end())
+			ft += my.find(key)->second;
+		std += std::distance(def.equal_range(key).first, def.equal_range(key).second);
+		ft += std::distance(my.equal_range(key).first, my.equal_range(key).second);
+	}
+	std::multimap<int, int> defCopy(def);
+	ft::multimap<int, int> myCopy(my);
+	def.clear();
+	my.clear();
+	multimapFillStr(def, my, std, ft);
+	multimapFillStr(defCopy, myCopy, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void operationsMultimapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Find, count and equal range std::string test" << " ";
+	std::multimap<std::string, std::string> def;
+	ft::multimap<std::string, std::string> my;
+	multimapInsertElem(def, my, 1000, 100);
+	for (int i = 0; i < 300; i++) {
+		std::string key;
+		key = rand() % 128;
+		std += def.count(key);
+		ft += my.count(key);
+		if (def.find(key) != def.end())
+			std += def.find(key)->second;
+		if (my.find(key) != my.end())
+			ft += my.find(key)->second;
+		std += std::distance(def.equal_range(key).first, def.equal_range(key).second);
+		ft += std::distance(my.equal_range(key).first, my.equal_range(key).second);
+	}
+	std::multimap<std::string, std::string> defCopy(def);
+	ft::multimap<std::string, std::string> myCopy(my);
+	def.clear();
+	my.clear();
+	multimapFillStr(def, my, std, ft);
+	multimapFillStr(defCopy, myCopy, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void mergeMultimapTest(std::string &std, std::string &ft) {
+	std::cout << "Merge keeps order of equal keys int test" << " ";
+	std::multimap<int, int> def;
+	ft::multimap<int, int> my;
+	std::multimap<int, int> defOther;
+	ft::multimap<int, int> myOther;
+	multimapInsertElem(def, my, 200, 10);
+	for (int i = 0; i < 300; i++) {
+		std::pair<int, int> res(rand() % 10, i);
+		defOther.insert(res);
+		myOther.insert(res);
+	}
+	def.merge(defOther);
+	my.merge(myOther);
+	multimapFillStr(def, my, std, ft);
+	multimapFillStr(defOther, myOther, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Multimap
+
+void testMultimap() {
+	std::string std;
+	std::string ft;
+	std::cout << "                            MODIFIERS" << std::endl;
+	insertMultimapTest(std, ft);
+	insertMultimapTestStr(std, ft);
+	eraseMultimapTest(std, ft);
+	eraseMultimapTestStr(std, ft);
+	std::cout << "                            OPERATIONS" << std::endl;
+	operationsMultimapTest(std, ft);
+	operationsMultimapTestStr(std, ft);
+	mergeMultimapTest(std, ft);
+}
+
+//MARK: - Insert unordered map
+
+void insertUnorderedMapTest(std::string &std, std::string &ft) {
+	std::cout << "Insert int test" << " ";
+	std::unordered_map<int, int> def;
+	ft::unordered_map<int, int> my;
+	unorderedMapInsertElem(def, my, 1000);
+	std::pair<int, int> toTest(42, 42);
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	unorderedMapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void insertUnorderedMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Insert std::string test" << " ";
+	std::unordered_map<std::string, std::string> def;
+	ft::unordered_map<std::string, std::string> my;
+	unorderedMapInsertElem(def, my, 1000);
+	std::pair<std::string, std::string> toTest("42", "42");
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	std += def.insert(toTest).second;
+	ft += my.insert(toTest).second;
+	unorderedMapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Operator [] unordered map
+
+void squareBracketsUnorderedMapTest(std::string &std, std::string &ft) {
+	std::cout << "Operator [] int test" << " ";
+	std::unordered_map<int, int> def;
+	ft::unordered_map<int, int> my;
+	unorderedMapInsertElem(def, my, 1000);
+	for (int i = 0; i < 1000; i++) {
+		int key;
+		key = rand();
+		def[key] = key;
+		my[key] = key;
+	}
+	std += def[42];
+	ft += my[42];
+	unorderedMapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void squareBracketsUnorderedMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Operator [] std::string test" << " ";
+	std::unordered_map<std::string, std::string> def;
+	ft::unordered_map<std::string, std::string> my;
+	unorderedMapInsertElem(def, my, 1000);
+	for (int i = 0; i < 1000; i++) {
+		std::string key;
+		key = rand();
+		def[key] = key;
+		my[key] = key;
+	}
+	std += def["42"];
+	ft += my["42"];
+	unorderedMapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Erase unordered map
+
+void eraseUnorderedMapTest(std::string &std, std::string &ft) {
+	std::cout << "Erase int test" << " ";
+	std::unordered_map<int, int> def;
+	ft::unordered_map<int, int> my;
+	unorderedMapInsertElem(def, my, 1000);
+	std::unordered_map<int, int> copy(def);
+	int i = 0;
+	for (std::unordered_map<int, int>::iterator it = copy.begin(); it != copy.end(); it++, i++) {
+		if (i % 2 == 0) {
+			std += def.erase(it->first);
+			ft += my.erase(it->first);
+		}
+	}
+	std += def.erase(42);
+	ft += my.erase(42);
+	unorderedMapInsertElem(def, my, 500);
+	unorderedMapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void eraseUnorderedMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Erase std::string test" << " ";
+	std::unordered_map<std::string, std::string> def;
+	ft::unordered_map<std::string, std::string> my;
+	unorderedMapInsertElem(def, my, 1000);
+	std::unordered_map<std::string, std::string> copy(def);
+	int i = 0;
+	for (std::unordered_map<std::string, std::string>::iterator it = copy.begin(); it != copy.end(); it++, i++) {
+		if (i % 2 == 0) {
+			std += def.erase(it->first);
+			ft += my.erase(it->first);
+		}
+	}
+	std += def.erase("42");
+	ft += my.erase("42");
+	unorderedMapInsertElem(def, my, 500);
+	unorderedMapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6690,36 +12314,22 @@ void equalRangeTest(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void equalRangeTestFloat(std::string &std, std::string &ft) {
-	std::cout << "Equal range float test" << " ";
-	std::map<float, float> def;
-	ft::map<float, float> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::map<float, float>::iterator, std::map<float, float>::iterator> test;
-	std::pair<ft::map<float, float>::iterator, ft::map<float, float>::iterator> myTest;
-	test = def.equal_range(100);
-	myTest = my.equal_range(100);
-	std += test.first->first;
-	std += test.first->second;
-	std += test.second->first;
-	std += test.second->second;
-	ft += myTest.first->first;
-	ft += myTest.first->second;
-	ft += myTest.second->first;
-	ft += myTest.second->second;
-	std::pair<float, float> toTest(42.21, 42.21);
-	def.insert(toTest);
-	my.insert(toTest);
-	test = def.equal_range(42.21);
-	myTest = my.equal_range(42.21);
-	std += test.first->first;
-	std += test.first->second;
-	std += test.second->first;
-	std += test.second->second;
-	ft += myTest.first->first;
-	ft += myTest.first->second;
-	ft += myTest.second->first;
-	ft += myTest.second->second;
+//MARK: - Find unordered map
+
+void findCountUnorderedMapTest(std::string &std, std::string &ft) {
+	std::cout << "Find and count int test" << " ";
+	std::unordered_map<int, int> def;
+	ft::unordered_map<int, int> my;
+	unorderedMapInsertElem(def, my, 1000);
+	for (int i = 0; i < 1000; i++) {
+		int key;
+		key = rand();
+		std += def.count(key);
+		ft += my.count(key);
+		std += (def.find(key) == def.end());
+		ft += (my.find(key) == my.end());
+	}
+	unorderedMapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6728,36 +12338,20 @@ void equalRangeTestFloat(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-void equalRangeTestStr(std::string &std, std::string &ft) {
-	std::cout << "Equal range std::string test" << " ";
-	std::map<std::string, std::string> def;
-	ft::map<std::string, std::string> my;
-	mapInsertElem(def, my, 100);
-	std::pair<std::map<std::string, std::string>::iterator, std::map<std::string, std::string>::iterator> test;
-	std::pair<ft::map<std::string, std::string>::iterator, ft::map<std::string, std::string>::iterator> myTest;
-	test = def.equal_range("100");
-	myTest = my.equal_range("100");
-	std += test.first->first;
-	std += test.first->second;
-	std += test.second->first;
-	std += test.second->second;
-	ft += myTest.first->first;
-	ft += myTest.first->second;
-	ft += myTest.second->first;
-	ft += myTest.second->second;
-	std::pair<std::string, std::string> toTest("42", "42");
-	def.insert(toTest);
-	my.insert(toTest);
-	test = def.equal_range("42");
-	myTest = my.equal_range("42");
-	std += test.first->first;
-	std += test.first->second;
-	std += test.second->first;
-	std += test.second->second;
-	ft += myTest.first->first;
-	ft += myTest.first->second;
-	ft += myTest.second->first;
-	ft += myTest.second->second;
+void findCountUnorderedMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Find and count std::string test" << " ";
+	std::unordered_map<std::string, std::string> def;
+	ft::unordered_map<std::string, std::string> my;
+	unorderedMapInsertElem(def, my, 1000);
+	for (int i = 0; i < 1000; i++) {
+		std::string key;
+		key = rand();
+		std += def.count(key);
+		ft += my.count(key);
+		std += (def.find(key) == def.end());
+		ft += (my.find(key) == my.end());
+	}
+	unorderedMapFillStr(def, my, std, ft);
 	if (std == ft)
 		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
 	else
@@ -6766,91 +12360,69 @@ void equalRangeTestStr(std::string &std, std::string &ft) {
 	ft.clear();
 }
 
-//MARK: - Map
+//MARK: - Copy unordered map
 
-void testMap() {
-	std::cout << "                            CONSTRUCTOR" << std::endl;
+void copyClearUnorderedMapTest(std::string &std, std::string &ft) {
+	std::cout << "Copy and clear int test" << " ";
+	std::unordered_map<int, int> def;
+	ft::unordered_map<int, int> my;
+	unorderedMapInsertElem(def, my, 1000);
+	std::unordered_map<int, int> defCopy(def);
+	ft::unordered_map<int, int> myCopy(my);
+	def.clear();
+	my.clear();
+	unorderedMapFillStr(def, my, std, ft);
+	unorderedMapFillStr(defCopy, myCopy, std, ft);
+	def = defCopy;
+	my = myCopy;
+	unorderedMapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+void copyClearUnorderedMapTestStr(std::string &std, std::string &ft) {
+	std::cout << "Copy and clear std::string test" << " ";
+	std::unordered_map<std::string, std::string> def;
+	ft::unordered_map<std::string, std::string> my;
+	unorderedMapInsertElem(def, my, 1000);
+	std::unordered_map<std::string, std::string> defCopy(def);
+	ft::unordered_map<std::string, std::string> myCopy(my);
+	def.clear();
+	my.clear();
+	unorderedMapFillStr(def, my, std, ft);
+	unorderedMapFillStr(defCopy, myCopy, std, ft);
+	def = defCopy;
+	my = myCopy;
+	unorderedMapFillStr(def, my, std, ft);
+	if (std == ft)
+		std::cout << "\033[1;32m[OK]\033[0;0m" << std::endl;
+	else
+		std::cout << "\033[1;31m[FAIL]\033[0;0m" << std::endl;
+	std.clear();
+	ft.clear();
+}
+
+//MARK: - Unordered map
+
+void testUnorderedMap() {
 	std::string std;
 	std::string ft;
-	defaultCnstTestMap(std, ft);
-	defaultCnstTestMapFloat(std, ft);
-	defaultCnstTestMapStr(std, ft);
-	rangeCnstTestMap(std, ft);
-	rangeCnstTestMapFloat(std, ft);
-	rangeCnstTestMapStr(std, ft);
-	copyCnstTestMap(std, ft);
-	copyCnstTestMapFloat(std, ft);
-	copyCnstTestMapStr(std, ft);
-	std::cout << "                            ASSIGNATION" << std::endl;
-	assignTestMap(std, ft);
-	assignTestMapFloat(std, ft);
-	assignTestMapStr(std, ft);
-	std::cout << "                            ITERATORS" << std::endl;
-	iteratorTestMap(std, ft, 1000);
-	constIteratorTestMap(std, ft, 1000);
-	reverseIteratorTestMap(std, ft, 1000);
-	constReverseIteratorTestMap(std, ft, 1000);
-	std::cout << "                            CAPACITY" << std::endl;
-	emptyMapTest(std, ft);
-	emptyMapTestFloat(std, ft);
-	emptyMapTestStr(std, ft);
-	sizeMapTest(std, ft);
-	sizeMapTestFloat(std, ft);
-	sizeMapTestStr(std, ft);
-	maxSizeTestMap(std, ft);
-	maxSizeTestMapFloat(std, ft);
-	std::cout << "                            ELEMENT ACCESS" << std::endl;
-	squareBracketsTestMap(std, ft);
-	squareBracketsTestMapFloat(std, ft);
-	squareBracketsTestMapStr(std, ft);
 	std::cout << "                            MODIFIERS" << std::endl;
-	singleInsertMap(std, ft);
-	singleInsertMapFloat(std, ft);
-	singleInsertMapStr(std, ft);
-	withHitInsertMap(std, ft);
-	withHitInsertMapFloat(std, ft);
-	withHitInsertMapStr(std, ft);
-	rangeInsertMapTest(std, ft);
-	rangeInsertMapTestFloat(std, ft);
-	rangeInsertMapTestStr(std, ft);
-	eraseSingleMapTest(std, ft);
-	eraseSingleMapTestFloat(std, ft);
-	eraseSingleMapTestStr(std, ft);
-	eraseKeyMapTest(std, ft);
-	eraseKeyMapTestFloat(std, ft);
-	eraseKeyMapTestStr(std, ft);
-	eraseRangeTest(std, ft);
-	eraseRangeTestFloat(std, ft);
-	eraseRangeTestStr(std, ft);
-	swapTestMap(std, ft);
-	swapTestMapFloat(std, ft);
-	swapTestMapStr(std, ft);
-	clearTestMap(std, ft);
-	clearTestMapFloat(std, ft);
-	clearTestMapStr(std, ft);
-	std::cout << "                            OBSERVERS" << std::endl;
-	keyCompareTest(std, ft);
-	keyCompareTestFloat(std, ft);
-	keyCompareTestStr(std, ft);
-	valueCompareTest(std, ft);
-	valueCompareTestFloat(std, ft);
-	valueCompareTestStr(std, ft);
+	insertUnorderedMapTest(std, ft);
+	insertUnorderedMapTestStr(std, ft);
+	squareBracketsUnorderedMapTest(std, ft);
+	squareBracketsUnorderedMapTestStr(std, ft);
+	eraseUnorderedMapTest(std, ft);
+	eraseUnorderedMapTestStr(std, ft);
 	std::cout << "                            OPERATIONS" << std::endl;
-	findTest(std, ft);
-	findTestFloat(std, ft);
-	findTestStr(std, ft);
-	countTest(std, ft);
-	countTestFloat(std, ft);
-	countTestStr(std, ft);
-	lowerBoundTest(std, ft);
-	lowerBoundTestFloat(std, ft);
-	lowerBoundTestStr(std, ft);
-	upperBoundTest(std, ft);
-	upperBoundTestFloat(std, ft);
-	upperBoundTestStr(std, ft);
-	equalRangeTest(std, ft);
-	equalRangeTestFloat(std, ft);
-	equalRangeTestStr(std, ft);
+	findCountUnorderedMapTest(std, ft);
+	findCountUnorderedMapTestStr(std, ft);
+	copyClearUnorderedMapTest(std, ft);
+	copyClearUnorderedMapTestStr(std, ft);
 }
 
 //MARK: - Default constructor queue
@@ -8535,18 +14107,958 @@ void testStack() {
 	greaterOrEqualTestStackStr(std, ft);
 };
 
+//MARK: - Benchmark hash map
+
+template <typename Map, typename Key>
+void lookupBenchmark(const char* name, const std::vector<Key> &keys) {
+	Map my;
+	clock_t start = clock();
+	for (size_t i = 0; i < keys.size(); i++)
+		my[keys[i]] = i;
+	double insertTime = elapsedMs(start);
+	size_t hits = 0;
+	start = clock();
+	for (size_t i = 0; i < keys.size(); i++)
+		hits += my.count(keys[i]);
+	double findTime = elapsedMs(start);
+	start = clock();
+	for (size_t i = 0; i < keys.size(); i += 2)
+		my.erase(keys[i]);
+	double eraseTime = elapsedMs(start);
+	std::cout << name << ": insert " << insertTime << " ms, find " << findTime << " ms ("
+		<< hits << " hits), erase " << eraseTime << " ms" << std::endl;
+}
+
+void hashMapBenchmark() {
+	std::vector<int> intKeys;
+	std::vector<std::string> strKeys;
+	for (int i = 0; i < 200000; i++) {
+		intKeys.push_back(rand());
+		strKeys.push_back(std::to_string(rand()));
+	}
+	std::cout << "200000 int keys" << std::endl;
+	lookupBenchmark<ft::unordered_map<int, size_t> >("ft::unordered_map", intKeys);
+	lookupBenchmark<ft::map<int, size_t> >("ft::map", intKeys);
+	lookupBenchmark<std::unordered_map<int, size_t> >("std::unordered_map", intKeys);
+	std::cout << "200000 std::string keys" << std::endl;
+	lookupBenchmark<ft::unordered_map<std::string, size_t> >("ft::unordered_map", strKeys);
+	lookupBenchmark<ft::map<std::string, size_t> >("ft::map", strKeys);
+	lookupBenchmark<std::unordered_map<std::string, size_t> >("std::unordered_map", strKeys);
+}
+
+//MARK: - Benchmark map range
+
+void rangeEraseBenchmark(int number) {
+	ft::map<int, int> loop;
+	ft::map<int, int> range;
+	for (int i = 0; i < number; i++) {
+		int key = rand() % number;
+		loop[key] = i;
+		range[key] = i;
+	}
+	clock_t start = clock();
+	size_t counted = 0;
+	for (ft::map<int, int>::iterator it = loop.begin(); it != loop.end() && it->first < number / 2; ++it)
+		counted++;
+	double countLoop = elapsedMs(start);
+	start = clock();
+	size_t ranged = range.count_range(0, number / 2);
+	double countRange = elapsedMs(start);
+	start = clock();
+	ft::map<int, int>::iterator it = loop.begin();
+	while (it != loop.end() && it->first < number / 2) {
+		ft::map<int, int>::iterator tmp = it;
+		++it;
+		loop.erase(tmp);
+	}
+	double eraseLoop = elapsedMs(start);
+	start = clock();
+	range.erase(range.begin(), range.lower_bound(number / 2));
+	double eraseRange = elapsedMs(start);
+	std::cout << "Count keys below " << number / 2 << ": loop " << countLoop << " ms (" << counted
+		<< "), count_range " << countRange << " ms (" << ranged << ")" << std::endl;
+	std::cout << "Erase keys below " << number / 2 << ": loop " << eraseLoop << " ms, split/join "
+		<< eraseRange << " ms (" << loop.size() << " / " << range.size() << " left)" << std::endl;
+}
+
+//MARK: - Benchmark map set operations
+
+void setOperationsBenchmark(int number) {
+	ft::map<int, int> a;
+	ft::map<int, int> b;
+	for (int i = 0; i < number; i++) {
+		a[rand() % (number * 2)] = i;
+		b[rand() % (number * 2)] = i;
+	}
+	ft::map<int, int> loop(a);
+	ft::map<int, int> joined(a);
+	clock_t start = clock();
+	for (ft::map<int, int>::iterator it = b.begin(); it != b.end(); ++it)
+		loop.insert(*it);
+	double uniteLoop = elapsedMs(start);
+	start = clock();
+	joined.unite(b);
+	double uniteJoin = elapsedMs(start);
+	std::cout << "Union of " << a.size() << " and " << b.size() << ": insert loop " << uniteLoop
+		<< " ms, split/join " << uniteJoin << " ms" << std::endl;
+	loop = a;
+	joined = a;
+	start = clock();
+	ft::map<int, int>::iterator it = loop.begin();
+	while (it != loop.end()) {
+		ft::map<int, int>::iterator tmp = it;
+		++it;
+		if (b.find(tmp->first) == b.end())
+			loop.erase(tmp);
+	}
+	double intersectLoop = elapsedMs(start);
+	start = clock();
+	joined.intersect(b);
+	double intersectJoin = elapsedMs(start);
+	std::cout << "Intersection: erase loop " << intersectLoop << " ms, split/join " << intersectJoin << " ms" << std::endl;
+	loop = a;
+	joined = a;
+	start = clock();
+	for (ft::map<int, int>::iterator it = b.begin(); it != b.end(); ++it)
+		if (loop.find(it->first) != loop.end())
+			loop.erase(it->first);
+	double subtractLoop = elapsedMs(start);
+	start = clock();
+	joined.subtract(b);
+	double subtractJoin = elapsedMs(start);
+	std::cout << "Difference: erase loop " << subtractLoop << " ms, split/join " << subtractJoin << " ms" << std::endl;
+	ft::map<int, int> loopSrc(b);
+	ft::map<int, int> joinedSrc(b);
+	loop = a;
+	joined = a;
+	start = clock();
+	it = loopSrc.begin();
+	while (it != loopSrc.end()) {
+		ft::map<int, int>::iterator tmp = it;
+		++it;
+		if (loop.insert(*tmp).second)
+			loopSrc.erase(tmp);
+	}
+	double mergeLoop = elapsedMs(start);
+	start = clock();
+	joined.merge(joinedSrc);
+	double mergeJoin = elapsedMs(start);
+	std::cout << "Merge: insert/erase loop " << mergeLoop << " ms, relinking merge " << mergeJoin << " ms" << std::endl;
+}
+
+//MARK: - Benchmark tree
+
+int treeKey(const int& value) {
+	return value;
+}
+
+int treeKey(const std::pair<int, int>& value) {
+	return value.first;
+}
+
+template <typename Tree, typename Value>
+void treeBenchmark(const char* name, const std::vector<Value> &values) {
+	Tree my;
+	clock_t start = clock();
+	for (size_t i = 0; i < values.size(); i++)
+		my.insert(values[i]);
+	double insertTime = elapsedMs(start);
+	size_t hits = 0;
+	start = clock();
+	for (size_t i = 0; i < values.size(); i++)
+		hits += my.count(treeKey(values[i]));
+	double findTime = elapsedMs(start);
+	start = clock();
+	for (size_t i = 0; i < values.size(); i += 2)
+		my.erase(treeKey(values[i]));
+	double eraseTime = elapsedMs(start);
+	std::cout << name << ": insert " << insertTime << " ms, find " << findTime << " ms ("
+		<< hits << " hits), erase " << eraseTime << " ms" << std::endl;
+}
+
+void treeThroughputBenchmark(int number) {
+	std::vector<int> keys;
+	std::vector<std::pair<int, int> > pairs;
+	for (int i = 0; i < number; i++) {
+		keys.push_back(rand() % number);
+		pairs.push_back(std::pair<int, int>(keys.back(), i));
+	}
+	std::cout << number << " int keys" << std::endl;
+	treeBenchmark<ft::set<int> >("ft::set", keys);
+	treeBenchmark<std::set<int> >("std::set", keys);
+	treeBenchmark<ft::multiset<int> >("ft::multiset", keys);
+	treeBenchmark<std::multiset<int> >("std::multiset", keys);
+	treeBenchmark<ft::map<int, int> >("ft::map", pairs);
+	treeBenchmark<std::map<int, int> >("std::map", pairs);
+	treeBenchmark<ft::multimap<int, int> >("ft::multimap", pairs);
+	treeBenchmark<std::multimap<int, int> >("std::multimap", pairs);
+}
+
+//MARK: - Benchmark transparent lookup
+
+template <typename Map>
+void stringLookupBenchmark(const char* name, const std::vector<std::string> &keys) {
+	Map my;
+	for (size_t i = 0; i < keys.size(); i += 2)
+		my[keys[i]] = i;
+	size_t hits = 0;
+	clock_t start = clock();
+	for (int round = 0; round < 500; round++)
+		for (size_t i = 0; i < keys.size(); i++)
+			hits += my.count(keys[i].c_str());
+	std::cout << name << ": " << elapsedMs(start) << " ms (" << hits << " hits)" << std::endl;
+}
+
+void transparentLookupBenchmark() {
+	std::vector<std::string> keys;
+	for (int i = 0; i < 1000; i++)
+		keys.push_back("session:" + std::to_string(rand()) + ":user");
+	std::cout << "500000 const char* lookups" << std::endl;
+	stringLookupBenchmark<ft::map<std::string, size_t> >("ft::map, temporary std::string", keys);
+	stringLookupBenchmark<ft::map<std::string, size_t, ft::transparent_less> >("ft::map, transparent_less", keys);
+	stringLookupBenchmark<std::map<std::string, size_t> >("std::map, temporary std::string", keys);
+}
+
+//MARK: - Benchmark emplace
+
+struct CountedBuffer {
+	static size_t constructions;
+	std::vector<char> data;
+	CountedBuffer() : data(4096) {
+		constructions++;
+	}
+	CountedBuffer(size_t size) : data(size) {
+		constructions++;
+	}
+	CountedBuffer(const CountedBuffer& src) : data(src.data) {
+		constructions++;
+	}
+	CountedBuffer& operator=(const CountedBuffer& src) {
+		data = src.data;
+		return *this;
+	}
+	static void reset() {
+		constructions = 0;
+	}
+};
+size_t CountedBuffer::constructions = 0;
+
+void printConstructions(const char* name, double time) {
+	std::cout << name << ": " << CountedBuffer::constructions << " value constructions, " << time << " ms" << std::endl;
+	CountedBuffer::reset();
+}
+
+void emplaceBenchmark(int number) {
+	ft::map<int, CountedBuffer> my;
+	CountedBuffer::reset();
+	clock_t start = clock();
+	for (int i = 0; i < number; i++)
+		my.insert(std::pair<int, CountedBuffer>(i, CountedBuffer()));
+	printConstructions("insert(pair) miss", elapsedMs(start));
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.insert(std::pair<int, CountedBuffer>(i, CountedBuffer()));
+	printConstructions("insert(pair) hit", elapsedMs(start));
+	my.clear();
+	CountedBuffer::reset();
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my[i];
+	printConstructions("operator[] miss", elapsedMs(start));
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my[i];
+	printConstructions("operator[] hit", elapsedMs(start));
+	my.clear();
+	CountedBuffer::reset();
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.try_emplace(i, 4096);
+	printConstructions("try_emplace miss", elapsedMs(start));
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.try_emplace(i, 4096);
+	printConstructions("try_emplace hit", elapsedMs(start));
+	my.clear();
+	CountedBuffer::reset();
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.emplace(i, 4096);
+	printConstructions("emplace miss", elapsedMs(start));
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.emplace(i, 4096);
+	printConstructions("emplace hit", elapsedMs(start));
+	CountedBuffer value;
+	CountedBuffer::reset();
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.insert_or_assign(i, value);
+	printConstructions("insert_or_assign hit", elapsedMs(start));
+}
+
+//MARK: - Benchmark node handles
+
+void tierRotationBenchmark(int number, int rounds) {
+	typedef ft::map<int, std::string, std::less<int>, CountingAllocator<std::pair<const int, std::string> > > Tier;
+	typedef ft::list<std::string, CountingAllocator<std::string> > Queue;
+	std::string payload(64, 'x');
+	Tier hot;
+	Tier cold;
+	Queue hotQueue;
+	Queue coldQueue;
+	for (int i = 0; i < number; i++) {
+		hot[i] = payload;
+		cold[number + i] = payload;
+		hotQueue.push_back(payload);
+		coldQueue.push_back(payload);
+	}
+	allocationCount = 0;
+	clock_t start = clock();
+	for (int r = 0; r < rounds; r++) {
+		Tier::iterator it = hot.begin();
+		cold.insert(*it);
+		hot.erase(it);
+		it = --cold.end();
+		hot.insert(*it);
+		cold.erase(it);
+	}
+	std::cout << "map erase/insert copy: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+	allocationCount = 0;
+	start = clock();
+	for (int r = 0; r < rounds; r++) {
+		cold.insert(hot.extract(hot.begin()));
+		hot.insert(cold.extract(--cold.end()));
+	}
+	std::cout << "map extract/insert node: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+	allocationCount = 0;
+	start = clock();
+	for (int r = 0; r < rounds; r++) {
+		coldQueue.push_back(hotQueue.front());
+		hotQueue.pop_front();
+		hotQueue.push_back(coldQueue.front());
+		coldQueue.pop_front();
+	}
+	std::cout << "list pop/push copy: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+	allocationCount = 0;
+	start = clock();
+	for (int r = 0; r < rounds; r++) {
+		coldQueue.insert(coldQueue.end(), hotQueue.extract(hotQueue.begin()));
+		hotQueue.insert(hotQueue.end(), coldQueue.extract(coldQueue.begin()));
+	}
+	std::cout << "list extract/insert node: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+}
+
+//MARK: - Benchmark list remove
+
+void listRemoveBenchmark(int number) {
+	std::list<int> def;
+	ft::list<int> my;
+	for (int i = 0; i < number; i++) {
+		def.push_back(i);
+		my.push_back(i);
+	}
+	clock_t start = clock();
+	def.remove_if(isEven());
+	double stdTime = elapsedMs(start);
+	start = clock();
+	size_t removed = my.remove_if(isEven());
+	std::cout << "remove_if 50% of " << number << ": std::list " << stdTime << " ms, ft::list "
+		<< elapsedMs(start) << " ms (" << removed << " removed)" << std::endl;
+	def.clear();
+	my.clear();
+	for (int i = 0; i < number; i++) {
+		def.push_back(i / 2);
+		my.push_back(i / 2);
+	}
+	start = clock();
+	def.unique();
+	stdTime = elapsedMs(start);
+	start = clock();
+	removed = my.unique();
+	std::cout << "unique 50% of " << number << ": std::list " << stdTime << " ms, ft::list "
+		<< elapsedMs(start) << " ms (" << removed << " removed)" << std::endl;
+}
+
+//MARK: - Benchmark list node cache
+
+template <class Queue>
+void churnBenchmark(const char* name, int steady, int cycles) {
+	Queue queue;
+	for (int i = 0; i < steady; i++)
+		queue.push_back(i);
+	allocationCount = 0;
+	clock_t start = clock();
+	for (int i = 0; i < cycles; i++) {
+		queue.push_back(i);
+		queue.pop_front();
+	}
+	double time = elapsedMs(start);
+	std::cout << name << ": " << static_cast<long>(cycles / (time / 1000)) << " push/pop cycles per second, "
+		<< allocationCount << " allocations" << std::endl;
+}
+
+//MARK: - Benchmark list splice
+
+void spliceBenchmark(int lists, int number) {
+	std::vector<ft::list<int> > perThread(lists);
+	for (int i = 0; i < lists; i++)
+		for (int j = 0; j < number; j++)
+			perThread[i].push_back(j);
+	ft::list<int> nodeByNode;
+	clock_t start = clock();
+	for (int i = 0; i < lists; i++)
+		while (!perThread[i].empty())
+			nodeByNode.splice(nodeByNode.end(), perThread[i], perThread[i].begin());
+	double loopTime = elapsedMs(start);
+	for (int i = 0; i < lists; i++)
+		perThread[i].splice(perThread[i].end(), nodeByNode, nodeByNode.begin(), nodeByNode.end());
+	ft::list<int> whole;
+	start = clock();
+	for (int i = 0; i < lists; i++)
+		whole.splice(whole.end(), perThread[i]);
+	double wholeTime = elapsedMs(start);
+	std::cout << "Concatenate " << lists << " lists of " << number << ": node by node " << loopTime
+		<< " ms, whole-list splice " << wholeTime << " ms (" << whole.size() << " nodes)" << std::endl;
+	ft::list<int> half;
+	ft::list<int>::iterator middle = whole.begin();
+	std::advance(middle, whole.size() / 2);
+	start = clock();
+	half.splice(half.end(), whole, whole.begin(), middle);
+	double countedTime = elapsedMs(start);
+	start = clock();
+	whole.splice(whole.end(), half, half.begin(), half.end(), half.size());
+	double sizedTime = elapsedMs(start);
+	std::cout << "Range splice of " << whole.size() / 2 << ": counted " << countedTime
+		<< " ms, with length " << sizedTime << " ms" << std::endl;
+}
+
+//MARK: - Benchmark forward list
+
+void forwardListBenchmark(int number, int rounds) {
+	ft::list<int, CountingAllocator<int> > doubly;
+	allocationCount = 0;
+	allocatedBytes = 0;
+	for (int i = 0; i < number; i++)
+		doubly.push_front(i);
+	std::cout << "ft::list: " << static_cast<double>(allocatedBytes) / number << " bytes and "
+		<< static_cast<double>(allocationCount) / number << " allocations per element" << std::endl;
+	ft::forward_list<int, CountingAllocator<int> > singly;
+	allocationCount = 0;
+	allocatedBytes = 0;
+	for (int i = 0; i < number; i++)
+		singly.push_front(i);
+	std::cout << "ft::forward_list: " << static_cast<double>(allocatedBytes) / number << " bytes and "
+		<< static_cast<double>(allocationCount) / number << " allocations per element" << std::endl;
+	long sum = 0;
+	clock_t start = clock();
+	for (int r = 0; r < rounds; r++)
+		for (ft::list<int, CountingAllocator<int> >::iterator it = doubly.begin(); it != doubly.end(); it++)
+			sum += *it;
+	double listTime = elapsedMs(start);
+	start = clock();
+	for (int r = 0; r < rounds; r++)
+		for (ft::forward_list<int, CountingAllocator<int> >::iterator it = singly.begin(); it != singly.end(); it++)
+			sum -= *it;
+	double forwardTime = elapsedMs(start);
+	std::cout << "Traverse " << number << " x " << rounds << ": ft::list " << listTime
+		<< " ms, ft::forward_list " << forwardTime << " ms" << (sum == 0 ? "" : " (mismatch)") << std::endl;
+	start = clock();
+	singly.sort(std::greater<int>());
+	std::cout << "ft::forward_list merge sort of " << number << ": " << elapsedMs(start) << " ms" << std::endl;
+}
+
+//MARK: - Benchmark unrolled list
+
+template <size_t Size>
+struct Payload {
+	char bytes[Size];
+	Payload() {
+		bytes[0] = 1;
+	}
+	Payload(int val) {
+		bytes[0] = static_cast<char>(val);
+	}
+};
+
+template <class Container>
+void sequenceBenchmark(const char* name, int number, int operations) {
+	typedef typename Container::value_type value_type;
+	Container sequence;
+	for (int i = 0; i < number; i++)
+		sequence.push_back(value_type(i));
+	long sum = 0;
+	clock_t start = clock();
+	for (int r = 0; r < 20; r++)
+		for (typename Container::iterator it = sequence.begin(); it != sequence.end(); it++)
+			sum += *reinterpret_cast<char*>(&*it);
+	double traverseTime = elapsedMs(start);
+	typename Container::iterator middle = sequence.begin();
+	std::advance(middle, number / 2);
+	start = clock();
+	for (int i = 0; i < operations; i++)
+		middle = sequence.insert(middle, value_type(i));
+	double insertTime = elapsedMs(start);
+	start = clock();
+	for (int i = 0; i < operations; i++)
+		middle = sequence.erase(middle);
+	double eraseTime = elapsedMs(start);
+	std::cout << name << ": traverse " << traverseTime << " ms, middle insert " << insertTime
+		<< " ms, middle erase " << eraseTime << " ms (checksum " << sum << ")" << std::endl;
+}
+
+template <class T>
+void unrolledListBenchmark(const char* size, int number, int operations) {
+	std::cout << size << std::endl;
+	sequenceBenchmark<ft::list<T> >("ft::list", number, operations);
+	sequenceBenchmark<ft::vector<T> >("ft::vector", number, operations);
+	sequenceBenchmark<ft::unrolled_list<T> >("ft::unrolled_list", number, operations);
+}
+
+//MARK: - Benchmark intrusive list
+
+struct CacheEntry {
+	int key;
+	ft::list_hook hook;
+};
+
+void lruBenchmark(int capacity, int accesses) {
+	typedef ft::list<int, CountingAllocator<int> > Order;
+	std::vector<int> keys(accesses);
+	for (int i = 0; i < accesses; i++)
+		keys[i] = rand() % (capacity * 2);
+	Order order;
+	std::vector<Order::iterator> where(capacity * 2, order.end());
+	allocationCount = 0;
+	clock_t start = clock();
+	for (int i = 0; i < accesses; i++) {
+		int key = keys[i];
+		if (where[key] != order.end())
+			order.splice(order.begin(), order, where[key]);
+		else {
+			if (order.size() == static_cast<size_t>(capacity)) {
+				where[order.back()] = order.end();
+				order.pop_back();
+			}
+			order.push_front(key);
+			where[key] = order.begin();
+		}
+	}
+	std::cout << "ft::list LRU: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+	std::vector<CacheEntry> entries(capacity * 2);
+	for (int i = 0; i < capacity * 2; i++)
+		entries[i].key = i;
+	ft::intrusive_list<CacheEntry, &CacheEntry::hook> intrusive;
+	allocationCount = 0;
+	start = clock();
+	for (int i = 0; i < accesses; i++) {
+		CacheEntry& entry = entries[keys[i]];
+		if (entry.hook.is_linked())
+			intrusive.erase(entry);
+		else if (intrusive.size() == static_cast<size_t>(capacity))
+			intrusive.pop_back();
+		intrusive.push_front(entry);
+	}
+	std::cout << "ft::intrusive_list LRU: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+}
+
+//MARK: - Benchmark vector algorithms
+
+void vectorAlgorithmBenchmark(int number, int lookups) {
+	std::vector<int> def;
+	ft::vector<int> my;
+	for (int i = 0; i < number; i++) {
+		int val = rand();
+		def.push_back(val);
+		my.push_back(val);
+	}
+	clock_t start = clock();
+	std::sort(def.begin(), def.end());
+	double stdTime = elapsedMs(start);
+	start = clock();
+	std::sort(my.begin(), my.end());
+	std::cout << "std::sort of " << number << ": std::vector " << stdTime << " ms, ft::vector " << elapsedMs(start) << " ms" << std::endl;
+	long found = 0;
+	start = clock();
+	for (int i = 0; i < lookups; i++)
+		found += std::lower_bound(def.begin(), def.end(), rand()) - def.begin();
+	stdTime = elapsedMs(start);
+	start = clock();
+	for (int i = 0; i < lookups; i++)
+		found -= std::lower_bound(my.begin(), my.end(), rand()) - my.begin();
+	std::cout << "std::lower_bound x " << lookups << ": std::vector " << stdTime << " ms, ft::vector " << elapsedMs(start) << " ms" << std::endl;
+}
+
+//MARK: - Benchmark vector clear
+
+template <class T>
+void clearBenchmark(const std::string& name, size_t number, const T& val) {
+	std::vector<T> def(number, val);
+	ft::vector<T> my(number, val);
+	clock_t start = clock();
+	def.clear();
+	double stdTime = elapsedMs(start);
+	start = clock();
+	my.clear();
+	std::cout << "clear of " << number << " " << name << ": std::vector " << stdTime << " ms, ft::vector " << elapsedMs(start) << " ms" << std::endl;
+}
+
+//MARK: - Benchmark vector reassign
+
+template <class Vector>
+void reassignBenchmark(const std::string& name, int number) {
+	Vector small(48, 1);
+	Vector large(64, 2);
+	Vector target;
+	int values[64];
+	for (int i = 0; i < 64; i++)
+		values[i] = i;
+	allocationCount = 0;
+	clock_t start = clock();
+	for (int i = 0; i < number; i++) {
+		target = (i & 1) ? small : large;
+		target.assign(32 + i % 32, i);
+		target.assign(values, values + 64);
+	}
+	std::cout << name << ": " << number << " frames in " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+}
+
+//MARK: - Benchmark vector resize
+
+void resizeBenchmark(int number) {
+	std::vector<int, CountingAllocator<int> > def;
+	ft::vector<int, CountingAllocator<int> > my;
+	allocationCount = 0;
+	clock_t start = clock();
+	for (int i = 0; i < number; i++)
+		def.resize(3072 + (i & 1023));
+	std::cout << "std::vector resize: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+	allocationCount = 0;
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.resize(3072 + (i & 1023));
+	std::cout << "ft::vector resize: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+	my.clear();
+	allocationCount = 0;
+	start = clock();
+	for (int i = 0; i < number; i++)
+		my.resize_default_init(3072 + (i & 1023));
+	std::cout << "ft::vector resize_default_init: " << elapsedMs(start) << " ms, " << allocationCount << " allocations" << std::endl;
+}
+
+//MARK: - Benchmark vector stream load
+
+void streamLoadBenchmark(int number) {
+	std::ostringstream text;
+	for (int i = 0; i < number; i++)
+		text << rand() << '\n';
+	std::istringstream defIn(text.str());
+	clock_t start = clock();
+	std::vector<int> def((std::istream_iterator<int>(defIn)), std::istream_iterator<int>());
+	double stdTime = elapsedMs(start);
+	std::istringstream myIn(text.str());
+	start = clock();
+	ft::vector<int> my((std::istream_iterator<int>(myIn)), std::istream_iterator<int>());
+	std::cout << "load " << number << " ints from istream: std::vector " << stdTime << " ms, ft::vector " << elapsedMs(start) << " ms (" << (def.size() == my.size() ? "same size" : "size mismatch") << ")" << std::endl;
+	std::istringstream defInsert(text.str());
+	start = clock();
+	def.insert(def.begin() + def.size() / 2, std::istream_iterator<int>(defInsert), std::istream_iterator<int>());
+	stdTime = elapsedMs(start);
+	std::istringstream myInsert(text.str());
+	start = clock();
+	my.insert(my.begin() + my.size() / 2, std::istream_iterator<int>(myInsert), std::istream_iterator<int>());
+	std::cout << "insert " << number << " ints from istream in the middle: std::vector " << stdTime << " ms, ft::vector " << elapsedMs(start) << " ms" << std::endl;
+}
+
+//MARK: - Benchmark bit vector
+
+template <class Vector>
+void bitVectorBenchmark(const std::string& name, size_t number, int repeats) {
+	typename Vector::value_type on = 1;
+	allocatedBytes = 0;
+	Vector flags(number, 0);
+	size_t bytes = allocatedBytes;
+	for (size_t i = 0; i < number; i += 3)
+		flags[i] = on;
+	Vector other(flags);
+	other[number - 1] = !other[number - 1];
+	Vector sparse(number, 0);
+	sparse[number - 1] = on;
+	size_t hits = 0;
+	clock_t start = clock();
+	for (int r = 0; r < repeats; r++)
+		hits += ft::count(flags, on);
+	double countTime = elapsedMs(start);
+	start = clock();
+	for (int r = 0; r < repeats; r++)
+		hits += ft::find(sparse, on) - sparse.cbegin();
+	double findTime = elapsedMs(start);
+	start = clock();
+	for (int r = 0; r < repeats; r++)
+		hits += (flags == other);
+	double equalTime = elapsedMs(start);
+	start = clock();
+	for (size_t i = 0; i < number; i++)
+		flags[i] = !flags[i];
+	double flipTime = elapsedMs(start);
+	std::cout << name << ": " << bytes << " bytes, count " << countTime << " ms, find " << findTime << " ms, == "
+		<< equalTime << " ms, one element-wise flip pass " << flipTime << " ms (" << hits << ")" << std::endl;
+}
+
+void bitFlipBenchmark(size_t number, int repeats) {
+	ft::vector<bool> flags(number, false);
+	clock_t start = clock();
+	for (int r = 0; r < repeats; r++)
+		flags.flip();
+	std::cout << "ft::vector<bool>::flip of " << number << " bits x " << repeats << ": " << elapsedMs(start) << " ms" << std::endl;
+}
+
+//MARK: - Benchmark mmap vector
+
+struct Record {
+	long	id;
+	double	value;
+	char	tag[16];
+};
+
+void mmapVectorBenchmark(size_t number) {
+	std::string path = "/tmp/ft_mmap_vector_bench.bin";
+	::unlink(path.c_str());
+	{
+		ft::mmap_vector<Record> out(path);
+		out.reserve(number);
+		Record rec = Record();
+		for (size_t i = 0; i < number; i++) {
+			rec.id = static_cast<long>(i);
+			rec.value = static_cast<double>(i % 1000);
+			out.push_back(rec);
+		}
+		out.sync();
+	}
+	std::chrono::steady_clock::time_point wall = std::chrono::steady_clock::now();
+	ft::mmap_vector<Record> mapped(path);
+	double openTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+	wall = std::chrono::steady_clock::now();
+	double sum = 0;
+	for (ft::mmap_vector<Record>::const_iterator it = mapped.cbegin(); it != mapped.cend(); it++)
+		sum += it->value;
+	double scanTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+	std::cout << "mmap_vector of " << mapped.size() << " records: open " << openTime << " ms, scan " << scanTime << " ms (" << sum << ")" << std::endl;
+	wall = std::chrono::steady_clock::now();
+	int fd = ::open(path.c_str(), O_RDONLY);
+	struct stat info;
+	::fstat(fd, &info);
+	ft::vector<Record> loaded;
+	loaded.resize_default_init((info.st_size - 64) / sizeof(Record));
+	::lseek(fd, 64, SEEK_SET);
+	char* dest = reinterpret_cast<char*>(&loaded[0]);
+	size_t left = loaded.size() * sizeof(Record);
+	while (left != 0) {
+		ssize_t got = ::read(fd, dest, left);
+		if (got <= 0)
+			break;
+		dest += got;
+		left -= got;
+	}
+	::close(fd);
+	openTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+	wall = std::chrono::steady_clock::now();
+	sum = 0;
+	for (ft::vector<Record>::const_iterator it = loaded.cbegin(); it != loaded.cend(); it++)
+		sum += it->value;
+	scanTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+	std::cout << "read() into ft::vector of " << loaded.size() << " records: load " << openTime << " ms, scan " << scanTime << " ms (" << sum << ")" << std::endl;
+	::unlink(path.c_str());
+}
+
+//MARK: - Benchmark aligned storage
+
+template <class Vector>
+void alignedDotBenchmark(const std::string& name, size_t number, int repeats) {
+	Vector lhs;
+	Vector rhs;
+	for (size_t i = 0; i < number; i++) {
+		lhs.push_back(static_cast<float>(rand() % 100) / 100);
+		rhs.push_back(static_cast<float>(rand() % 100) / 100);
+	}
+	float sum = 0;
+	clock_t start = clock();
+	for (int r = 0; r < repeats; r++)
+		sum += ft::simd::dot(lhs.begin().data, rhs.begin().data, number);
+	std::cout << name << " (data % 64 = " << reinterpret_cast<size_t>(lhs.begin().data) % 64 << ", "
+		<< reinterpret_cast<size_t>(rhs.begin().data) % 64 << "): dot " << elapsedMs(start) << " ms (" << sum << ")" << std::endl;
+}
+
+//MARK: - Benchmark parallel
+
+void parallelScalingBenchmark(size_t number) {
+	ft::vector<float> data(number);
+	ft::vector<float> out(number);
+	for (size_t i = 0; i < number; i++)
+		data[i] = static_cast<float>(rand() % 1000);
+	unsigned cores = std::thread::hardware_concurrency();
+	if (cores == 0)
+		cores = 1;
+	for (unsigned threads = 1; ; threads *= 2) {
+		if (threads > cores)
+			threads = cores;
+		ft::parallel::thread_pool pool(threads);
+		clock_t start = clock();
+		std::chrono::steady_clock::time_point wall = std::chrono::steady_clock::now();
+		ft::parallel::transform(data.begin(), data.end(), out.begin(), doubleValue<float>(), 0, pool);
+		double transformTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+		wall = std::chrono::steady_clock::now();
+		float sum = ft::parallel::reduce(out.begin(), out.end(), 0.0f, std::plus<float>(), 0, pool);
+		double reduceTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+		wall = std::chrono::steady_clock::now();
+		ft::parallel::inclusive_scan(data.begin(), data.end(), out.begin(), std::plus<float>(), 0, pool);
+		double scanTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+		wall = std::chrono::steady_clock::now();
+		ft::vector<float>::iterator found = ft::parallel::find_if(data.begin(), data.end(), equalValue<float>(-1.0f), 0, pool);
+		double findTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+		out = data;
+		wall = std::chrono::steady_clock::now();
+		ft::parallel::sort(out.begin(), out.end(), std::less<float>(), 0, pool);
+		double sortTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall).count();
+		std::cout << threads << " threads: transform " << transformTime << " ms, reduce " << reduceTime
+			<< " ms, inclusive_scan " << scanTime << " ms, find_if " << findTime << " ms, sort " << sortTime
+			<< " ms (cpu " << elapsedMs(start) << " ms, sum " << sum << ", " << (found == data.end() ? "not found" : "found") << ")" << std::endl;
+		if (threads == cores)
+			break;
+	}
+}
+
+//MARK: - Benchmark simd
+
+template <class T>
+void simdBenchmark(const std::string& name, size_t number, int repeats) {
+	ft::vector<T> lhs;
+	for (size_t i = 0; i < number; i++)
+		lhs.push_back(static_cast<T>(rand() % 100));
+	ft::vector<T> rhs(lhs);
+	rhs[number - 1] = static_cast<T>(100);
+	T missing = static_cast<T>(101);
+	ft::simd::level levels[] = {ft::simd::scalar_level, ft::simd::supported_level()};
+	const char* labels[] = {"scalar", ft::simd::supported_level() == ft::simd::avx2_level ? "avx2" : "sse2"};
+	for (size_t l = 0; l < 2; l++) {
+		ft::simd::set_level(levels[l]);
+		size_t hits = 0;
+		clock_t start = clock();
+		for (int r = 0; r < repeats; r++)
+			hits += (lhs == rhs);
+		double equalTime = elapsedMs(start);
+		start = clock();
+		for (int r = 0; r < repeats; r++)
+			hits += (lhs < rhs);
+		double lessTime = elapsedMs(start);
+		start = clock();
+		for (int r = 0; r < repeats; r++)
+			hits += ft::find(lhs, missing) - lhs.cbegin();
+		double findTime = elapsedMs(start);
+		start = clock();
+		for (int r = 0; r < repeats; r++)
+			hits += ft::count(lhs, lhs[r % number]);
+		double countTime = elapsedMs(start);
+		start = clock();
+		for (int r = 0; r < repeats; r++)
+			hits += ft::min_element(lhs) - lhs.cbegin();
+		double minTime = elapsedMs(start);
+		std::cout << name << " " << labels[l] << ": == " << equalTime << " ms, < " << lessTime << " ms, find "
+			<< findTime << " ms, count " << countTime << " ms, min_element " << minTime << " ms (" << hits << ")" << std::endl;
+	}
+	ft::simd::set_level(ft::simd::supported_level());
+}
+
+//MARK: - Benchmark
+
+void testBenchmark() {
+	std::cout << "                            HASH MAP" << std::endl;
+	hashMapBenchmark();
+	std::cout << "                            MAP RANGE" << std::endl;
+	rangeEraseBenchmark(200000);
+	std::cout << "                            MAP SET OPERATIONS" << std::endl;
+	setOperationsBenchmark(200000);
+	std::cout << "                            TREE THROUGHPUT" << std::endl;
+	treeThroughputBenchmark(200000);
+	std::cout << "                            TRANSPARENT LOOKUP" << std::endl;
+	transparentLookupBenchmark();
+	std::cout << "                            EMPLACE" << std::endl;
+	emplaceBenchmark(20000);
+	std::cout << "                            NODE HANDLES" << std::endl;
+	tierRotationBenchmark(100000, 200000);
+	std::cout << "                            LIST REMOVE" << std::endl;
+	listRemoveBenchmark(1000000);
+	std::cout << "                            LIST NODE CACHE" << std::endl;
+	churnBenchmark<ft::list<int, CountingAllocator<int> > >("ft::list", 1000, 2000000);
+	churnBenchmark<ft::list<int, CountingAllocator<int>, ft::node_cache<64> > >("ft::list with node_cache<64>", 1000, 2000000);
+	std::cout << "                            LIST SPLICE" << std::endl;
+	spliceBenchmark(8, 125000);
+	std::cout << "                            INTRUSIVE LIST" << std::endl;
+	lruBenchmark(10000, 2000000);
+	std::cout << "                            FORWARD LIST" << std::endl;
+	forwardListBenchmark(1000000, 20);
+	std::cout << "                            UNROLLED LIST" << std::endl;
+	unrolledListBenchmark<int>("4-byte elements", 200000, 20000);
+	unrolledListBenchmark<Payload<64> >("64-byte elements", 200000, 2000);
+	std::cout << "                            VECTOR ALGORITHMS" << std::endl;
+	vectorAlgorithmBenchmark(1000000, 1000000);
+	std::cout << "                            VECTOR CLEAR" << std::endl;
+	clearBenchmark<int>("ints", 100000000, 1);
+	clearBenchmark<std::string>("strings", 1000000, std::string(32, 'x'));
+	std::cout << "                            VECTOR REASSIGN" << std::endl;
+	reassignBenchmark<std::vector<int, CountingAllocator<int> > >("std::vector", 1000000);
+	reassignBenchmark<ft::vector<int, CountingAllocator<int> > >("ft::vector", 1000000);
+	std::cout << "                            VECTOR RESIZE" << std::endl;
+	resizeBenchmark(1000000);
+	std::cout << "                            VECTOR STREAM LOAD" << std::endl;
+	streamLoadBenchmark(10000000);
+	std::cout << "                            BIT VECTOR" << std::endl;
+	bitVectorBenchmark<ft::vector<bool, CountingAllocator<bool> > >("ft::vector<bool>", 1 << 26, 20);
+	bitVectorBenchmark<ft::vector<char, CountingAllocator<char> > >("byte per flag ft::vector<char>", 1 << 26, 20);
+	bitFlipBenchmark(1 << 26, 20);
+	std::cout << "                            MMAP VECTOR" << std::endl;
+	mmapVectorBenchmark(4000000);
+	std::cout << "                            ALIGNED STORAGE" << std::endl;
+	alignedDotBenchmark<ft::vector<float> >("ft::vector<float>", 4100, 200000);
+	alignedDotBenchmark<ft::vector<float, ft::aligned_allocator<float, 64>, ft::aligned_growth<64> > >("aligned ft::vector<float>", 4100, 200000);
+	std::cout << "                            PARALLEL SCALING" << std::endl;
+	parallelScalingBenchmark(1 << 22);
+	std::cout << "                            SIMD COMPARE" << std::endl;
+	simdBenchmark<int>("ft::vector<int>", 1 << 20, 200);
+	simdBenchmark<float>("ft::vector<float>", 1 << 20, 200);
+	simdBenchmark<char>("ft::vector<char>", 1 << 20, 200);
+}
+
 int main()
 {
 	std::cout << "                                                LIST" << std::endl;
 	testList();
+	std::cout << "                                                FORWARD LIST" << std::endl;
+	testForwardList();
+	std::cout << "                                                UNROLLED LIST" << std::endl;
+	testUnrolledList();
+	std::cout << "                                                INTRUSIVE LIST" << std::endl;
+	testIntrusiveList();
 	std::cout << "                                                VECTOR" << std::endl;
 	testVector();
+	std::cout << "                                                PARALLEL" << std::endl;
+	testParallel();
+	std::cout << "                                                MMAP VECTOR" << std::endl;
+	testMmapVector();
 	std::cout << "                                                MAP" << std::endl;
 	testMap();
+	std::cout << "                                                SET AND MULTISET" << std::endl;
+	testSet();
+	std::cout << "                                                MULTIMAP" << std::endl;
+	testMultimap();
+	std::cout << "                                                UNORDERED MAP" << std::endl;
+	testUnorderedMap();
 	std::cout << "                                                QUEUE" << std::endl;
 	testQueue();
 	std::cout << "                                                STACK" << std::endl;
 	testStack();
+	std::cout << "                                                BENCHMARK" << std::endl;
+	testBenchmark();
 	while (1)
 		;
 	return (0);
@@ -0,0 +1,291 @@
+#ifndef mmap_vector_hpp
+#define mmap_vector_hpp
+
+#include <cerrno>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "vector.hpp"
+
+namespace ft {
+template < class T, class Growth = double_growth >
+class mmap_vector {
+	static_assert(std::is_trivially_copyable<T>::value, "mmap_vector requires a trivially copyable element type");
+private:
+	typedef struct		s_header
+	{
+		unsigned long	_magic;
+		unsigned long	_elemSize;
+		unsigned long	_size;
+	}					t_header;
+	static const unsigned long magic = 0x66746d6d61707631UL;
+	static const size_t headerBytes = 64;
+
+	int				_fd;
+	char*			_map;
+	size_t			_capacity;
+	size_t			_size;
+public:
+	//MARK: - Member types
+	typedef T value_type;
+	typedef T& reference;
+	typedef const T& const_reference;
+	typedef T* pointer;
+	typedef const T* const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+	typedef Growth growth_policy;
+	typedef typename vector<T>::iterator iterator;
+	typedef typename vector<T>::const_iterator const_iterator;
+	typedef typename vector<T>::reverse_iterator reverse_iterator;
+	typedef typename vector<T>::const_reverse_iterator const_reverse_iterator;
+
+	//MARK: - Constructors
+	explicit mmap_vector (const std::string& path) : _fd(-1), _map(0), _capacity(0), _size(0) {
+		_fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+		if (_fd < 0)
+			throw std::system_error(errno, std::generic_category(), "mmap_vector: open " + path);
+		struct stat info;
+		if (::fstat(_fd, &info) < 0)
+			fail("fstat");
+		size_t bytes = static_cast<size_t>(info.st_size);
+		bool fresh = bytes == 0;
+		if (fresh) {
+			bytes = headerBytes;
+			if (::ftruncate(_fd, bytes) < 0)
+				fail("ftruncate");
+		}
+		else if (bytes < headerBytes) {
+			::close(_fd);
+			throw std::runtime_error("mmap_vector: " + path + " is not a mmap_vector file");
+		}
+		_map = static_cast<char*>(::mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0));
+		if (_map == MAP_FAILED) {
+			_map = 0;
+			fail("mmap");
+		}
+		_capacity = (bytes - headerBytes) / sizeof(value_type);
+		t_header* head = header();
+		if (fresh) {
+			head->_magic = magic;
+			head->_elemSize = sizeof(value_type);
+			head->_size = 0;
+		}
+		else if (head->_magic != magic || head->_elemSize != sizeof(value_type) || head->_size > _capacity) {
+			release();
+			throw std::runtime_error("mmap_vector: " + path + " does not hold this element type");
+		}
+		_size = head->_size;
+	};
+
+	//MARK: - Destructor
+	~mmap_vector() {
+		release();
+	};
+
+	//MARK: - Iterators
+	iterator begin() {
+		return iterator(data());
+	};
+	const_iterator begin() const {
+		return const_iterator(const_cast<T*>(data()));
+	};
+	iterator end() {
+		return iterator(data() + _size);
+	};
+	const_iterator end() const {
+		return const_iterator(const_cast<T*>(data()) + _size);
+	};
+	reverse_iterator rbegin() {
+		return reverse_iterator(data() + _size - 1);
+	};
+	reverse_iterator rend() {
+		return reverse_iterator(data() - 1);
+	};
+	const_iterator cbegin() const {
+		return begin();
+	};
+	const_iterator cend() const {
+		return end();
+	};
+	const_reverse_iterator crbegin() const {
+		return const_reverse_iterator(const_cast<T*>(data()) + _size - 1);
+	};
+	const_reverse_iterator crend() const {
+		return const_reverse_iterator(const_cast<T*>(data()) - 1);
+	};
+
+	//MARK: - Capacity
+	size_type size() const {
+		return _size;
+	};
+	size_type max_size() const {
+		return std::numeric_limits<size_type>::max() / sizeof(value_type);
+	};
+	void resize (size_type n, const value_type& val = value_type()) {
+		if (n > _size) {
+			value_type copy(val);
+			reserveGrowth(n);
+			std::fill(data() + _size, data() + n, copy);
+		}
+		setSize(n);
+	};
+	size_type capacity() const {
+		return _capacity;
+	};
+	bool empty() const {
+		return (_size == 0);
+	};
+	void reserve (size_type n) {
+		if (n > _capacity)
+			remap(n);
+	};
+	void shrink_to_fit() {
+		if (_capacity > _size)
+			remap(_size);
+	};
+
+	//MARK: - Element access
+	reference operator[] (size_type n) {
+		return data()[n];
+	};
+	const_reference operator[] (size_type n) const {
+		return data()[n];
+	};
+	reference at (size_type n) {
+		if (n >= _size)
+			throw std::out_of_range("index out of range");
+		return data()[n];
+	};
+	const_reference at (size_type n) const {
+		if (n >= _size)
+			throw std::out_of_range("index out of range");
+		return data()[n];
+	};
+	reference front() {
+		return data()[0];
+	};
+	const_reference front() const {
+		return data()[0];
+	};
+	reference back() {
+		return data()[_size - 1];
+	};
+	const_reference back() const {
+		return data()[_size - 1];
+	};
+	pointer data() {
+		return reinterpret_cast<T*>(_map + headerBytes);
+	};
+	const_pointer data() const {
+		return reinterpret_cast<const T*>(_map + headerBytes);
+	};
+
+	//MARK: - Modifiers
+	void push_back (const value_type& val) {
+		if (_size == _capacity) {
+			value_type copy(val);
+			reserveGrowth(_size + 1);
+			data()[_size] = copy;
+		}
+		else
+			data()[_size] = val;
+		setSize(_size + 1);
+	};
+	void pop_back() {
+		setSize(_size - 1);
+	};
+	iterator erase (iterator position) {
+		return erase(position, position + 1);
+	};
+	iterator erase (iterator first, iterator last) {
+		std::copy(last.data, data() + _size, first.data);
+		setSize(_size - (last.data - first.data));
+		return first;
+	};
+	void clear() {
+		setSize(0);
+	};
+
+	//MARK: - Durability
+	void sync() {
+		if (::msync(_map, mappedBytes(), MS_SYNC) < 0)
+			throw std::system_error(errno, std::generic_category(), "mmap_vector: msync");
+	};
+
+	//MARK: - Utility
+private:
+	mmap_vector(const mmap_vector&);
+	mmap_vector& operator=(const mmap_vector&);
+	t_header* header() {
+		return reinterpret_cast<t_header*>(_map);
+	}
+	size_t mappedBytes() const {
+		return headerBytes + _capacity * sizeof(value_type);
+	}
+	void setSize(size_type n) {
+		_size = n;
+		header()->_size = n;
+	}
+	void release() {
+		if (_map)
+			::munmap(_map, mappedBytes());
+		if (_fd >= 0)
+			::close(_fd);
+		_map = 0;
+		_fd = -1;
+	}
+	void fail(const char* call) {
+		int error = errno;
+		release();
+		throw std::system_error(error, std::generic_category(), std::string("mmap_vector: ") + call);
+	}
+	void reserveGrowth(size_type n) {
+		if (n > _capacity)
+			remap(Growth::next(_capacity, n, sizeof(value_type)));
+	}
+	void remap(size_type capacity) {
+		size_t oldBytes = mappedBytes();
+		size_t newBytes = headerBytes + capacity * sizeof(value_type);
+		if (newBytes > oldBytes && ::ftruncate(_fd, newBytes) < 0)
+			throw std::system_error(errno, std::generic_category(), "mmap_vector: ftruncate");
+#ifdef MREMAP_MAYMOVE
+		void* map = ::mremap(_map, oldBytes, newBytes, MREMAP_MAYMOVE);
+		if (map == MAP_FAILED)
+			throw std::system_error(errno, std::generic_category(), "mmap_vector: mremap");
+#else
+		void* map = ::mmap(0, newBytes, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+		if (map == MAP_FAILED)
+			throw std::system_error(errno, std::generic_category(), "mmap_vector: mmap");
+		::munmap(_map, oldBytes);
+#endif
+		_map = static_cast<char*>(map);
+		_capacity = capacity;
+		if (newBytes < oldBytes && ::ftruncate(_fd, newBytes) < 0)
+			throw std::system_error(errno, std::generic_category(), "mmap_vector: ftruncate");
+	}
+};
+
+//MARK: - Non-member function overloads
+template <class T, class Growth>
+bool operator== (const mmap_vector<T,Growth>& lhs, const mmap_vector<T,Growth>& rhs) {
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::simd::equal(lhs.data(), rhs.data(), lhs.size());
+};
+template <class T, class Growth>
+bool operator!= (const mmap_vector<T,Growth>& lhs, const mmap_vector<T,Growth>& rhs) {
+	return !(lhs == rhs);
+};
+template <class T, class Growth>
+bool operator<  (const mmap_vector<T,Growth>& lhs, const mmap_vector<T,Growth>& rhs) {
+	return ft::simd::lexicographical_less(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+};
+};
+
+#endif
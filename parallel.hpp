@@ -0,0 +1,331 @@
+#ifndef parallel_hpp
+#define parallel_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ft {
+namespace parallel {
+class thread_pool {
+private:
+	typedef std::function<void()> t_task;
+	typedef struct		s_queue
+	{
+		std::mutex			_lock;
+		std::deque<t_task>	_tasks;
+	}					t_queue;
+
+	std::vector<t_queue*>		_queues;
+	std::vector<std::thread>	_workers;
+	std::atomic<size_t>			_pending;
+	std::atomic<size_t>			_next;
+	std::mutex					_idleLock;
+	std::condition_variable		_idle;
+	bool						_stop;
+
+public:
+	//MARK: - Constructors
+	explicit thread_pool (unsigned threads = std::thread::hardware_concurrency()) : _pending(0), _next(0), _stop(false) {
+		if (threads == 0)
+			threads = 1;
+		for (unsigned i = 0; i < threads; i++)
+			_queues.push_back(new t_queue);
+		for (unsigned i = 1; i < threads; i++)
+			_workers.push_back(std::thread(&thread_pool::workerLoop, this, i));
+	};
+
+	//MARK: - Destructor
+	~thread_pool() {
+		{
+			std::lock_guard<std::mutex> guard(_idleLock);
+			_stop = true;
+		}
+		_idle.notify_all();
+		for (size_t i = 0; i < _workers.size(); i++)
+			_workers[i].join();
+		for (size_t i = 0; i < _queues.size(); i++)
+			delete _queues[i];
+	};
+
+	//MARK: - Capacity
+	unsigned size() const {
+		return static_cast<unsigned>(_queues.size());
+	};
+	static thread_pool& global() {
+		static thread_pool pool;
+		return pool;
+	};
+
+	//MARK: - Execution
+	template <class Function>
+	void run (size_t tasks, Function f) {
+		if (tasks == 0)
+			return;
+		if (tasks == 1 || size() == 1) {
+			for (size_t i = 0; i < tasks; i++)
+				f(i);
+			return;
+		}
+		std::atomic<size_t> remaining(tasks);
+		std::exception_ptr error;
+		std::mutex errorLock;
+		size_t self = currentQueue();
+		for (size_t i = 0; i < tasks; i++) {
+			size_t target = self;
+			if (currentPool() != this)
+				target = _next++ % _queues.size();
+			push(target, [&, i]() {
+				try {
+					f(i);
+				}
+				catch (...) {
+					std::lock_guard<std::mutex> guard(errorLock);
+					if (!error)
+						error = std::current_exception();
+				}
+				remaining--;
+			});
+		}
+		while (remaining != 0)
+			if (!runOne(self))
+				std::this_thread::yield();
+		if (error)
+			std::rethrow_exception(error);
+	};
+
+	//MARK: - Utilitys
+private:
+	thread_pool(const thread_pool&);
+	thread_pool& operator=(const thread_pool&);
+	static thread_pool*& currentPool() {
+		static thread_local thread_pool* pool = 0;
+		return pool;
+	}
+	static size_t& currentIndex() {
+		static thread_local size_t index = 0;
+		return index;
+	}
+	size_t currentQueue() {
+		if (currentPool() == this)
+			return currentIndex();
+		return 0;
+	}
+	void push(size_t target, const t_task& task) {
+		{
+			std::lock_guard<std::mutex> guard(_idleLock);
+			_pending++;
+		}
+		{
+			std::lock_guard<std::mutex> guard(_queues[target]->_lock);
+			_queues[target]->_tasks.push_back(task);
+		}
+		_idle.notify_one();
+	}
+	bool popOwn(size_t self, t_task& task) {
+		std::lock_guard<std::mutex> guard(_queues[self]->_lock);
+		if (_queues[self]->_tasks.empty())
+			return false;
+		task = _queues[self]->_tasks.back();
+		_queues[self]->_tasks.pop_back();
+		return true;
+	}
+	bool steal(size_t self, t_task& task) {
+		for (size_t i = 1; i < _queues.size(); i++) {
+			t_queue* victim = _queues[(self + i) % _queues.size()];
+			std::lock_guard<std::mutex> guard(victim->_lock);
+			if (victim->_tasks.empty())
+				continue;
+			task = victim->_tasks.front();
+			victim->_tasks.pop_front();
+			return true;
+		}
+		return false;
+	}
+	bool runOne(size_t self) {
+		t_task task;
+		if (!popOwn(self, task) && !steal(self, task))
+			return false;
+		_pending--;
+		task();
+		return true;
+	}
+	void workerLoop(size_t self) {
+		currentPool() = this;
+		currentIndex() = self;
+		while (true) {
+			if (runOne(self))
+				continue;
+			std::unique_lock<std::mutex> lock(_idleLock);
+			_idle.wait(lock, [this]() { return _stop || _pending != 0; });
+			if (_stop)
+				return;
+		}
+	}
+};
+
+//MARK: - Partitioning
+inline size_t chunkCount(size_t n, size_t& grain, const thread_pool& pool) {
+	if (grain == 0)
+		grain = std::max<size_t>(n / (pool.size() * 4), 1);
+	return (n + grain - 1) / grain;
+}
+
+//MARK: - Algorithms
+template <class RandomIt, class Function>
+void for_each (RandomIt first, RandomIt last, Function f, size_t grain = 0, thread_pool& pool = thread_pool::global()) {
+	size_t n = last - first;
+	size_t chunks = chunkCount(n, grain, pool);
+	pool.run(chunks, [&](size_t c) {
+		RandomIt it = first + c * grain;
+		RandomIt end = first + std::min(n, (c + 1) * grain);
+		for (; it != end; ++it)
+			f(*it);
+	});
+}
+
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt transform (RandomIt first, RandomIt last, OutputIt out, UnaryOperation op, size_t grain = 0, thread_pool& pool = thread_pool::global()) {
+	size_t n = last - first;
+	size_t chunks = chunkCount(n, grain, pool);
+	pool.run(chunks, [&](size_t c) {
+		size_t begin = c * grain;
+		size_t end = std::min(n, begin + grain);
+		std::transform(first + begin, first + end, out + begin, op);
+	});
+	return out + n;
+}
+
+template <class RandomIt, class T, class BinaryOperation>
+T reduce (RandomIt first, RandomIt last, T init, BinaryOperation op, size_t grain = 0, thread_pool& pool = thread_pool::global()) {
+	size_t n = last - first;
+	if (n == 0)
+		return init;
+	size_t chunks = chunkCount(n, grain, pool);
+	std::vector<T> partial(chunks);
+	pool.run(chunks, [&](size_t c) {
+		RandomIt it = first + c * grain;
+		RandomIt end = first + std::min(n, (c + 1) * grain);
+		T sum = *it;
+		for (++it; it != end; ++it)
+			sum = op(sum, *it);
+		partial[c] = sum;
+	});
+	for (size_t c = 0; c < chunks; c++)
+		init = op(init, partial[c]);
+	return init;
+}
+
+template <class RandomIt, class T>
+T reduce (RandomIt first, RandomIt last, T init) {
+	return ft::parallel::reduce(first, last, init, std::plus<T>());
+}
+
+template <class RandomIt, class OutputIt, class BinaryOperation>
+OutputIt inclusive_scan (RandomIt first, RandomIt last, OutputIt out, BinaryOperation op, size_t grain = 0, thread_pool& pool = thread_pool::global()) {
+	typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+	size_t n = last - first;
+	if (n == 0)
+		return out;
+	size_t chunks = chunkCount(n, grain, pool);
+	std::vector<value_type> carry(chunks);
+	pool.run(chunks, [&](size_t c) {
+		RandomIt it = first + c * grain;
+		RandomIt end = first + std::min(n, (c + 1) * grain);
+		value_type sum = *it;
+		for (++it; it != end; ++it)
+			sum = op(sum, *it);
+		carry[c] = sum;
+	});
+	for (size_t c = 1; c < chunks; c++)
+		carry[c] = op(carry[c - 1], carry[c]);
+	pool.run(chunks, [&](size_t c) {
+		size_t begin = c * grain;
+		size_t end = std::min(n, begin + grain);
+		value_type sum = first[begin];
+		if (c != 0)
+			sum = op(carry[c - 1], sum);
+		out[begin] = sum;
+		for (size_t i = begin + 1; i < end; i++) {
+			sum = op(sum, first[i]);
+			out[i] = sum;
+		}
+	});
+	return out + n;
+}
+
+template <class RandomIt, class OutputIt>
+OutputIt inclusive_scan (RandomIt first, RandomIt last, OutputIt out) {
+	typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+	return ft::parallel::inclusive_scan(first, last, out, std::plus<value_type>());
+}
+
+template <class RandomIt, class Compare>
+void sort (RandomIt first, RandomIt last, Compare comp, size_t grain = 0, thread_pool& pool = thread_pool::global()) {
+	typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+	size_t n = last - first;
+	size_t chunks = chunkCount(n, grain, pool);
+	if (chunks < 2) {
+		std::sort(first, last, comp);
+		return;
+	}
+	pool.run(chunks, [&](size_t c) {
+		std::sort(first + c * grain, first + std::min(n, (c + 1) * grain), comp);
+	});
+	std::vector<value_type> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+	bool inBuffer = true;
+	for (size_t width = grain; width < n; width *= 2) {
+		size_t pairs = (n + 2 * width - 1) / (2 * width);
+		pool.run(pairs, [&](size_t p) {
+			size_t begin = p * 2 * width;
+			size_t middle = std::min(n, begin + width);
+			size_t end = std::min(n, begin + 2 * width);
+			if (inBuffer)
+				std::merge(std::make_move_iterator(buffer.begin() + begin), std::make_move_iterator(buffer.begin() + middle),
+					std::make_move_iterator(buffer.begin() + middle), std::make_move_iterator(buffer.begin() + end), first + begin, comp);
+			else
+				std::merge(std::make_move_iterator(first + begin), std::make_move_iterator(first + middle),
+					std::make_move_iterator(first + middle), std::make_move_iterator(first + end), buffer.begin() + begin, comp);
+		});
+		inBuffer = !inBuffer;
+	}
+	if (inBuffer)
+		std::move(buffer.begin(), buffer.end(), first);
+}
+
+template <class RandomIt>
+void sort (RandomIt first, RandomIt last) {
+	typedef typename std::iterator_traits<RandomIt>::value_type value_type;
+	ft::parallel::sort(first, last, std::less<value_type>());
+}
+
+template <class RandomIt, class Predicate>
+RandomIt find_if (RandomIt first, RandomIt last, Predicate pred, size_t grain = 0, thread_pool& pool = thread_pool::global()) {
+	size_t n = last - first;
+	size_t chunks = chunkCount(n, grain, pool);
+	std::atomic<size_t> found(n);
+	pool.run(chunks, [&](size_t c) {
+		size_t begin = c * grain;
+		size_t end = std::min(n, begin + grain);
+		for (size_t i = begin; i < end && i < found; i++) {
+			if (pred(first[i])) {
+				size_t current = found;
+				while (i < current && !found.compare_exchange_weak(current, i))
+					;
+				return;
+			}
+		}
+	});
+	return first + found;
+}
+}
+}
+
+#endif
@@ -0,0 +1,316 @@
+#ifndef set_hpp
+#define set_hpp
+
+#include "avl_tree.hpp"
+
+namespace ft {
+template <class T, class Compare = std::less<T>, class Alloc = std::allocator<T> > class set {
+public:
+	//MARK: - Member types
+	typedef T key_type;
+	typedef T value_type;
+	typedef Compare key_compare;
+	typedef Compare value_compare;
+	typedef Alloc allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+	typedef avl_tree<key_type, value_type, identity<value_type>, key_compare, allocator_type> tree_type;
+	typedef typename tree_type::const_iterator iterator;
+	typedef typename tree_type::const_iterator const_iterator;
+	typedef typename tree_type::const_reverse_iterator reverse_iterator;
+	typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+private:
+	tree_type		_tree;
+
+public:
+	//MARK: - Constructors
+	explicit set (const key_compare& comp = key_compare(),
+				  const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {};
+	template <class InputIterator>
+	set (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		 const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _tree(comp, alloc) {
+		insert(first, last);
+	};
+	set (const set& x) : _tree(x._tree) {};
+	
+	//MARK: - Destructor
+	~set() {};
+	
+	//MARK: - Assign
+	set& operator=(const set& x) {
+		_tree = x._tree;
+		return *this;
+	};
+	
+	//MARK: - Iterators
+	iterator begin() const {
+		return _tree.begin();
+	}
+	iterator end() const {
+		return _tree.end();
+	}
+	const_iterator cbegin() const {
+		return _tree.begin();
+	}
+	const_iterator cend() const {
+		return _tree.end();
+	}
+	reverse_iterator rbegin() const {
+		return _tree.rbegin();
+	}
+	reverse_iterator rend() const {
+		return _tree.rend();
+	}
+	const_reverse_iterator crbegin() const {
+		return _tree.rbegin();
+	}
+	const_reverse_iterator crend() const {
+		return _tree.rend();
+	}
+	
+	//MARK: - Capacity
+	bool empty() const {
+		return _tree.empty();
+	};
+	size_type size() const {
+		return _tree.size();
+	};
+	size_type max_size() const {
+		return _tree.max_size();
+	};
+	
+	//MARK: - Modifiers
+	std::pair<iterator,bool> insert (const value_type& val) {
+		std::pair<typename tree_type::iterator,bool> res = _tree.insert_unique(val);
+		return std::pair<iterator,bool>(res.first, res.second);
+	};
+	iterator insert (iterator position, const value_type& val) {
+		(void)position;
+		return _tree.insert_unique(val).first;
+	};
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		while (first != last) {
+			insert(*first);
+			first++;
+		}
+	};
+	void erase (iterator position) {
+		_tree.erase(position.point);
+	};
+	size_type erase (const value_type& val) {
+		return _tree.erase_unique(val);
+	};
+	void erase (iterator first, iterator last) {
+		_tree.erase(first.point, last.point);
+	};
+	void swap (set& x) {
+		_tree.swap(x._tree);
+	};
+	void clear() {
+		_tree.clear();
+	};
+
+	//MARK: - Set operations
+	void merge (set& src) {
+		_tree.merge_unique(src._tree);
+	};
+	void unite (const set& x) {
+		_tree.unite(x._tree);
+	};
+	void intersect (const set& x) {
+		_tree.intersect(x._tree);
+	};
+	void subtract (const set& x) {
+		_tree.subtract(x._tree);
+	};
+	
+	//MARK: - Observers
+	key_compare key_comp() const {return _tree.key_comp();};
+	value_compare value_comp() const {return _tree.key_comp();};
+	
+	//MARK: - Operations
+	const_iterator find (const value_type& val) const {
+		return _tree.find(val);
+	};
+	size_type count (const value_type& val) const {
+		return _tree.find(val) != _tree.end();
+	};
+	const_iterator lower_bound (const value_type& val) const {
+		return _tree.lower_bound(val);
+	};
+	const_iterator upper_bound (const value_type& val) const {
+		return _tree.upper_bound(val);
+	};
+	std::pair<const_iterator,const_iterator> equal_range (const value_type& val) const {
+		return std::pair<const_iterator,const_iterator>(lower_bound(val), upper_bound(val));
+	};
+	
+	//MARK: - Order statistics
+	const_iterator nth (size_type k) const {
+		return _tree.nth(k);
+	};
+	size_type rank (const value_type& val) const {
+		return _tree.rank(val);
+	};
+	size_type count_range (const value_type& lo, const value_type& hi) const {
+		return _tree.count_range(lo, hi);
+	};
+};
+
+template <class T, class Compare = std::less<T>, class Alloc = std::allocator<T> > class multiset {
+public:
+	//MARK: - Member types
+	typedef T key_type;
+	typedef T value_type;
+	typedef Compare key_compare;
+	typedef Compare value_compare;
+	typedef Alloc allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+	typedef avl_tree<key_type, value_type, identity<value_type>, key_compare, allocator_type> tree_type;
+	typedef typename tree_type::const_iterator iterator;
+	typedef typename tree_type::const_iterator const_iterator;
+	typedef typename tree_type::const_reverse_iterator reverse_iterator;
+	typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+
+private:
+	tree_type		_tree;
+
+public:
+	//MARK: - Constructors
+	explicit multiset (const key_compare& comp = key_compare(),
+				  const allocator_type& alloc = allocator_type()) : _tree(comp, alloc) {};
+	template <class InputIterator>
+	multiset (InputIterator first, InputIterator last, const key_compare& comp = key_compare(),
+		 const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _tree(comp, alloc) {
+		insert(first, last);
+	};
+	multiset (const multiset& x) : _tree(x._tree) {};
+	
+	//MARK: - Destructor
+	~multiset() {};
+	
+	//MARK: - Assign
+	multiset& operator=(const multiset& x) {
+		_tree = x._tree;
+		return *this;
+	};
+	
+	//MARK: - Iterators
+	iterator begin() const {
+		return _tree.begin();
+	}
+	iterator end() const {
+		return _tree.end();
+	}
+	const_iterator cbegin() const {
+		return _tree.begin();
+	}
+	const_iterator cend() const {
+		return _tree.end();
+	}
+	reverse_iterator rbegin() const {
+		return _tree.rbegin();
+	}
+	reverse_iterator rend() const {
+		return _tree.rend();
+	}
+	const_reverse_iterator crbegin() const {
+		return _tree.rbegin();
+	}
+	const_reverse_iterator crend() const {
+		return _tree.rend();
+	}
+	
+	//MARK: - Capacity
+	bool empty() const {
+		return _tree.empty();
+	};
+	size_type size() const {
+		return _tree.size();
+	};
+	size_type max_size() const {
+		return _tree.max_size();
+	};
+	
+	//MARK: - Modifiers
+	iterator insert (const value_type& val) {
+		return _tree.insert_equal(val);
+	};
+	iterator insert (iterator position, const value_type& val) {
+		return _tree.insert_equal(position.point, val);
+	};
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		while (first != last) {
+			insert(*first);
+			first++;
+		}
+	};
+	void erase (iterator position) {
+		_tree.erase(position.point);
+	};
+	size_type erase (const value_type& val) {
+		return _tree.erase_equal(val);
+	};
+	void erase (iterator first, iterator last) {
+		_tree.erase(first.point, last.point);
+	};
+	void swap (multiset& x) {
+		_tree.swap(x._tree);
+	};
+	void clear() {
+		_tree.clear();
+	};
+	void merge (multiset& src) {
+		_tree.merge_equal(src._tree);
+	};
+	
+	//MARK: - Observers
+	key_compare key_comp() const {return _tree.key_comp();};
+	value_compare value_comp() const {return _tree.key_comp();};
+	
+	//MARK: - Operations
+	const_iterator find (const value_type& val) const {
+		const_iterator res = _tree.lower_bound(val);
+		if (res == end() || _tree.key_comp()(val, *res))
+			return end();
+		return res;
+	};
+	size_type count (const value_type& val) const {
+		return _tree.count(val);
+	};
+	const_iterator lower_bound (const value_type& val) const {
+		return _tree.lower_bound(val);
+	};
+	const_iterator upper_bound (const value_type& val) const {
+		return _tree.upper_bound(val);
+	};
+	std::pair<const_iterator,const_iterator> equal_range (const value_type& val) const {
+		return std::pair<const_iterator,const_iterator>(lower_bound(val), upper_bound(val));
+	};
+	
+	//MARK: - Order statistics
+	const_iterator nth (size_type k) const {
+		return _tree.nth(k);
+	};
+	size_type rank (const value_type& val) const {
+		return _tree.rank(val);
+	};
+	size_type count_range (const value_type& lo, const value_type& hi) const {
+		return _tree.count_range(lo, hi);
+	};
+};
+}
+
+#endif
@@ -0,0 +1,541 @@
+#ifndef simd_hpp
+#define simd_hpp
+
+#include <cstddef>
+#include <limits>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FT_SIMD_X86 1
+#endif
+
+namespace ft {
+namespace simd {
+//MARK: - Dispatch level
+enum level {
+	scalar_level = 0,
+	sse2_level = 1,
+	avx2_level = 2
+};
+
+inline level detectLevel() {
+#ifdef FT_SIMD_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return avx2_level;
+	if (__builtin_cpu_supports("sse2"))
+		return sse2_level;
+#endif
+	return scalar_level;
+}
+inline level& currentLevel() {
+	static level current = detectLevel();
+	return current;
+}
+inline level supported_level() {
+	static const level best = detectLevel();
+	return best;
+}
+inline level active_level() {
+	return currentLevel();
+}
+inline void set_level(level wanted) {
+	if (wanted > supported_level())
+		wanted = supported_level();
+	currentLevel() = wanted;
+}
+
+//MARK: - Scalar kernels
+template <class T>
+struct scalarKernels {
+	static size_t mismatch(const T* a, const T* b, size_t n) {
+		for (size_t i = 0; i < n; i++)
+			if (!(a[i] == b[i]))
+				return i;
+		return n;
+	}
+	static size_t find(const T* data, size_t n, const T& val) {
+		for (size_t i = 0; i < n; i++)
+			if (data[i] == val)
+				return i;
+		return n;
+	}
+	static size_t count(const T* data, size_t n, const T& val) {
+		size_t res = 0;
+		for (size_t i = 0; i < n; i++)
+			if (data[i] == val)
+				res++;
+		return res;
+	}
+	static size_t min_element(const T* data, size_t n) {
+		size_t res = 0;
+		for (size_t i = 1; i < n; i++)
+			if (data[i] < data[res])
+				res = i;
+		return res;
+	}
+	static size_t max_element(const T* data, size_t n) {
+		size_t res = 0;
+		for (size_t i = 1; i < n; i++)
+			if (data[res] < data[i])
+				res = i;
+		return res;
+	}
+	static bool less(const T* a, size_t aSize, const T* b, size_t bSize) {
+		size_t n = aSize < bSize ? aSize : bSize;
+		for (size_t i = 0; i < n; i++) {
+			if (a[i] < b[i])
+				return true;
+			if (b[i] < a[i])
+				return false;
+		}
+		return aSize < bSize;
+	}
+	static T dot(const T* a, const T* b, size_t n) {
+		T res = T();
+		for (size_t i = 0; i < n; i++)
+			res += a[i] * b[i];
+		return res;
+	}
+};
+
+#ifdef FT_SIMD_X86
+//MARK: - SSE2 operations
+struct sse2Int {
+	typedef int value_type;
+	typedef __m128i reg;
+	static const size_t width = 4;
+	static reg load(const int* p) {
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+	}
+	static reg set1(int val) {
+		return _mm_set1_epi32(val);
+	}
+	static unsigned eq(reg a, reg b) {
+		return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+	}
+	static reg min(reg a, reg b) {
+		reg greater = _mm_cmpgt_epi32(a, b);
+		return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+	}
+	static reg max(reg a, reg b) {
+		reg greater = _mm_cmpgt_epi32(a, b);
+		return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+	}
+	static bool unordered(reg) {
+		return false;
+	}
+	static void store(int* p, reg a) {
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+	}
+};
+struct sse2Float {
+	typedef float value_type;
+	typedef __m128 reg;
+	static const size_t width = 4;
+	static reg load(const float* p) {
+		return _mm_loadu_ps(p);
+	}
+	static reg set1(float val) {
+		return _mm_set1_ps(val);
+	}
+	static unsigned eq(reg a, reg b) {
+		return _mm_movemask_ps(_mm_cmpeq_ps(a, b));
+	}
+	static reg min(reg a, reg b) {
+		return _mm_min_ps(a, b);
+	}
+	static reg max(reg a, reg b) {
+		return _mm_max_ps(a, b);
+	}
+	static bool unordered(reg a) {
+		return _mm_movemask_ps(_mm_cmpunord_ps(a, a)) != 0;
+	}
+	static void store(float* p, reg a) {
+		_mm_storeu_ps(p, a);
+	}
+};
+struct sse2Char {
+	typedef char value_type;
+	typedef __m128i reg;
+	static const size_t width = 16;
+	static reg load(const char* p) {
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+	}
+	static reg set1(char val) {
+		return _mm_set1_epi8(val);
+	}
+	static unsigned eq(reg a, reg b) {
+		return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+	}
+	static reg greater(reg a, reg b) {
+		if (std::numeric_limits<char>::is_signed)
+			return _mm_cmpgt_epi8(a, b);
+		reg bias = _mm_set1_epi8(static_cast<char>(0x80));
+		return _mm_cmpgt_epi8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+	}
+	static reg min(reg a, reg b) {
+		reg mask = greater(a, b);
+		return _mm_or_si128(_mm_and_si128(mask, b), _mm_andnot_si128(mask, a));
+	}
+	static reg max(reg a, reg b) {
+		reg mask = greater(a, b);
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+	static bool unordered(reg) {
+		return false;
+	}
+	static void store(char* p, reg a) {
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(p), a);
+	}
+};
+
+//MARK: - AVX2 operations
+struct avx2Int {
+	typedef int value_type;
+	typedef __m256i reg;
+	static const size_t width = 8;
+	__attribute__((target("avx2"))) static reg load(const int* p) {
+		return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+	}
+	__attribute__((target("avx2"))) static reg set1(int val) {
+		return _mm256_set1_epi32(val);
+	}
+	__attribute__((target("avx2"))) static unsigned eq(reg a, reg b) {
+		return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+	}
+	__attribute__((target("avx2"))) static reg min(reg a, reg b) {
+		return _mm256_min_epi32(a, b);
+	}
+	__attribute__((target("avx2"))) static reg max(reg a, reg b) {
+		return _mm256_max_epi32(a, b);
+	}
+	__attribute__((target("avx2"))) static bool unordered(reg) {
+		return false;
+	}
+	__attribute__((target("avx2"))) static void store(int* p, reg a) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+	}
+};
+struct avx2Float {
+	typedef float value_type;
+	typedef __m256 reg;
+	static const size_t width = 8;
+	__attribute__((target("avx2"))) static reg load(const float* p) {
+		return _mm256_loadu_ps(p);
+	}
+	__attribute__((target("avx2"))) static reg set1(float val) {
+		return _mm256_set1_ps(val);
+	}
+	__attribute__((target("avx2"))) static unsigned eq(reg a, reg b) {
+		return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+	}
+	__attribute__((target("avx2"))) static reg min(reg a, reg b) {
+		return _mm256_min_ps(a, b);
+	}
+	__attribute__((target("avx2"))) static reg max(reg a, reg b) {
+		return _mm256_max_ps(a, b);
+	}
+	__attribute__((target("avx2"))) static bool unordered(reg a) {
+		return _mm256_movemask_ps(_mm256_cmp_ps(a, a, _CMP_UNORD_Q)) != 0;
+	}
+	__attribute__((target("avx2"))) static void store(float* p, reg a) {
+		_mm256_storeu_ps(p, a);
+	}
+};
+struct avx2Char {
+	typedef char value_type;
+	typedef __m256i reg;
+	static const size_t width = 32;
+	__attribute__((target("avx2"))) static reg load(const char* p) {
+		return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+	}
+	__attribute__((target("avx2"))) static reg set1(char val) {
+		return _mm256_set1_epi8(val);
+	}
+	__attribute__((target("avx2"))) static unsigned eq(reg a, reg b) {
+		return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+	}
+	__attribute__((target("avx2"))) static reg min(reg a, reg b) {
+		if (std::numeric_limits<char>::is_signed)
+			return _mm256_min_epi8(a, b);
+		return _mm256_min_epu8(a, b);
+	}
+	__attribute__((target("avx2"))) static reg max(reg a, reg b) {
+		if (std::numeric_limits<char>::is_signed)
+			return _mm256_max_epi8(a, b);
+		return _mm256_max_epu8(a, b);
+	}
+	__attribute__((target("avx2"))) static bool unordered(reg) {
+		return false;
+	}
+	__attribute__((target("avx2"))) static void store(char* p, reg a) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a);
+	}
+};
+
+//MARK: - Vector kernels
+inline unsigned lowestBit(unsigned mask) {
+	return static_cast<unsigned>(__builtin_ctz(mask));
+}
+
+template <class Ops>
+struct sse2Kernels {
+	typedef typename Ops::value_type T;
+	static const unsigned full = (Ops::width == 32) ? ~0u : (1u << Ops::width) - 1;
+	static size_t mismatch(const T* a, const T* b, size_t n) {
+		size_t i = 0;
+		for (; i + Ops::width <= n; i += Ops::width) {
+			unsigned mask = Ops::eq(Ops::load(a + i), Ops::load(b + i));
+			if (mask != full)
+				return i + lowestBit(~mask & full);
+		}
+		return i + scalarKernels<T>::mismatch(a + i, b + i, n - i);
+	}
+	static size_t find(const T* data, size_t n, const T& val) {
+		typename Ops::reg needle = Ops::set1(val);
+		size_t i = 0;
+		for (; i + Ops::width <= n; i += Ops::width) {
+			unsigned mask = Ops::eq(Ops::load(data + i), needle);
+			if (mask != 0)
+				return i + lowestBit(mask);
+		}
+		return i + scalarKernels<T>::find(data + i, n - i, val);
+	}
+	static size_t count(const T* data, size_t n, const T& val) {
+		typename Ops::reg needle = Ops::set1(val);
+		size_t res = 0;
+		size_t i = 0;
+		for (; i + Ops::width <= n; i += Ops::width)
+			res += __builtin_popcount(Ops::eq(Ops::load(data + i), needle));
+		return res + scalarKernels<T>::count(data + i, n - i, val);
+	}
+	static size_t extremum(const T* data, size_t n, bool largest) {
+		if (n < Ops::width * 2)
+			return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+		typename Ops::reg best = Ops::load(data);
+		if (Ops::unordered(best))
+			return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+		size_t i = Ops::width;
+		for (; i + Ops::width <= n; i += Ops::width) {
+			typename Ops::reg cur = Ops::load(data + i);
+			if (Ops::unordered(cur))
+				return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+			best = largest ? Ops::max(best, cur) : Ops::min(best, cur);
+		}
+		T lanes[Ops::width];
+		Ops::store(lanes, best);
+		T res = lanes[0];
+		for (size_t l = 1; l < Ops::width; l++)
+			if (largest ? res < lanes[l] : lanes[l] < res)
+				res = lanes[l];
+		for (; i < n; i++) {
+			if (data[i] != data[i])
+				return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+			if (largest ? res < data[i] : data[i] < res)
+				res = data[i];
+		}
+		return find(data, n, res);
+	}
+};
+
+template <class Ops>
+struct avx2Kernels {
+	typedef typename Ops::value_type T;
+	static const unsigned full = (Ops::width == 32) ? ~0u : (1u << Ops::width) - 1;
+	__attribute__((target("avx2"))) static size_t mismatch(const T* a, const T* b, size_t n) {
+		size_t i = 0;
+		for (; i + Ops::width <= n; i += Ops::width) {
+			unsigned mask = Ops::eq(Ops::load(a + i), Ops::load(b + i));
+			if (mask != full)
+				return i + lowestBit(~mask & full);
+		}
+		return i + scalarKernels<T>::mismatch(a + i, b + i, n - i);
+	}
+	__attribute__((target("avx2"))) static size_t find(const T* data, size_t n, const T& val) {
+		typename Ops::reg needle = Ops::set1(val);
+		size_t i = 0;
+		for (; i + Ops::width <= n; i += Ops::width) {
+			unsigned mask = Ops::eq(Ops::load(data + i), needle);
+			if (mask != 0)
+				return i + lowestBit(mask);
+		}
+		return i + scalarKernels<T>::find(data + i, n - i, val);
+	}
+	__attribute__((target("avx2"))) static size_t count(const T* data, size_t n, const T& val) {
+		typename Ops::reg needle = Ops::set1(val);
+		size_t res = 0;
+		size_t i = 0;
+		for (; i + Ops::width <= n; i += Ops::width)
+			res += __builtin_popcount(Ops::eq(Ops::load(data + i), needle));
+		return res + scalarKernels<T>::count(data + i, n - i, val);
+	}
+	__attribute__((target("avx2"))) static size_t extremum(const T* data, size_t n, bool largest) {
+		if (n < Ops::width * 2)
+			return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+		typename Ops::reg best = Ops::load(data);
+		if (Ops::unordered(best))
+			return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+		size_t i = Ops::width;
+		for (; i + Ops::width <= n; i += Ops::width) {
+			typename Ops::reg cur = Ops::load(data + i);
+			if (Ops::unordered(cur))
+				return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+			best = largest ? Ops::max(best, cur) : Ops::min(best, cur);
+		}
+		T lanes[Ops::width];
+		Ops::store(lanes, best);
+		T res = lanes[0];
+		for (size_t l = 1; l < Ops::width; l++)
+			if (largest ? res < lanes[l] : lanes[l] < res)
+				res = lanes[l];
+		for (; i < n; i++) {
+			if (data[i] != data[i])
+				return largest ? scalarKernels<T>::max_element(data, n) : scalarKernels<T>::min_element(data, n);
+			if (largest ? res < data[i] : data[i] < res)
+				res = data[i];
+		}
+		return find(data, n, res);
+	}
+};
+
+//MARK: - Dot product kernels
+inline float sse2Dot(const float* a, const float* b, size_t n) {
+	__m128 sum0 = _mm_setzero_ps();
+	__m128 sum1 = _mm_setzero_ps();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+		sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+	}
+	float lanes[4];
+	_mm_storeu_ps(lanes, _mm_add_ps(sum0, sum1));
+	float res = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+	return res + scalarKernels<float>::dot(a + i, b + i, n - i);
+}
+__attribute__((target("avx2"))) inline float avx2Dot(const float* a, const float* b, size_t n) {
+	__m256 sum0 = _mm256_setzero_ps();
+	__m256 sum1 = _mm256_setzero_ps();
+	size_t i = 0;
+	for (; i + 16 <= n; i += 16) {
+		sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+		sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+	}
+	float lanes[8];
+	_mm256_storeu_ps(lanes, _mm256_add_ps(sum0, sum1));
+	float res = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+	return res + scalarKernels<float>::dot(a + i, b + i, n - i);
+}
+
+template <class Sse2, class Avx2>
+struct dispatchKernels : public scalarKernels<typename Sse2::value_type> {
+	typedef typename Sse2::value_type T;
+	static size_t mismatch(const T* a, const T* b, size_t n) {
+		if (currentLevel() == avx2_level)
+			return avx2Kernels<Avx2>::mismatch(a, b, n);
+		if (currentLevel() == sse2_level)
+			return sse2Kernels<Sse2>::mismatch(a, b, n);
+		return scalarKernels<T>::mismatch(a, b, n);
+	}
+	static size_t find(const T* data, size_t n, const T& val) {
+		if (currentLevel() == avx2_level)
+			return avx2Kernels<Avx2>::find(data, n, val);
+		if (currentLevel() == sse2_level)
+			return sse2Kernels<Sse2>::find(data, n, val);
+		return scalarKernels<T>::find(data, n, val);
+	}
+	static size_t count(const T* data, size_t n, const T& val) {
+		if (currentLevel() == avx2_level)
+			return avx2Kernels<Avx2>::count(data, n, val);
+		if (currentLevel() == sse2_level)
+			return sse2Kernels<Sse2>::count(data, n, val);
+		return scalarKernels<T>::count(data, n, val);
+	}
+	static size_t min_element(const T* data, size_t n) {
+		if (currentLevel() == avx2_level)
+			return avx2Kernels<Avx2>::extremum(data, n, false);
+		if (currentLevel() == sse2_level)
+			return sse2Kernels<Sse2>::extremum(data, n, false);
+		return scalarKernels<T>::min_element(data, n);
+	}
+	static size_t max_element(const T* data, size_t n) {
+		if (currentLevel() == avx2_level)
+			return avx2Kernels<Avx2>::extremum(data, n, true);
+		if (currentLevel() == sse2_level)
+			return sse2Kernels<Sse2>::extremum(data, n, true);
+		return scalarKernels<T>::max_element(data, n);
+	}
+	static bool less(const T* a, size_t aSize, const T* b, size_t bSize) {
+		size_t n = aSize < bSize ? aSize : bSize;
+		size_t i = 0;
+		while (i < n) {
+			i += mismatch(a + i, b + i, n - i);
+			if (i == n)
+				break;
+			if (a[i] < b[i])
+				return true;
+			if (b[i] < a[i])
+				return false;
+			i++;
+		}
+		return aSize < bSize;
+	}
+};
+#endif
+
+//MARK: - Kernel selection
+template <class T>
+struct kernels : public scalarKernels<T> {};
+#ifdef FT_SIMD_X86
+template <>
+struct kernels<int> : public dispatchKernels<sse2Int, avx2Int> {};
+template <>
+struct kernels<float> : public dispatchKernels<sse2Float, avx2Float> {
+	static float dot(const float* a, const float* b, size_t n) {
+		if (currentLevel() == avx2_level)
+			return avx2Dot(a, b, n);
+		if (currentLevel() == sse2_level)
+			return sse2Dot(a, b, n);
+		return scalarKernels<float>::dot(a, b, n);
+	}
+};
+template <>
+struct kernels<char> : public dispatchKernels<sse2Char, avx2Char> {};
+#endif
+
+//MARK: - Algorithms
+template <class T>
+bool equal (const T* a, const T* b, size_t n) {
+	return kernels<T>::mismatch(a, b, n) == n;
+}
+template <class T>
+bool lexicographical_less (const T* a, size_t aSize, const T* b, size_t bSize) {
+	return kernels<T>::less(a, aSize, b, bSize);
+}
+template <class T>
+const T* find (const T* first, const T* last, const T& val) {
+	return first + kernels<T>::find(first, last - first, val);
+}
+template <class T>
+size_t count (const T* first, const T* last, const T& val) {
+	return kernels<T>::count(first, last - first, val);
+}
+template <class T>
+const T* min_element (const T* first, const T* last) {
+	if (first == last)
+		return last;
+	return first + kernels<T>::min_element(first, last - first);
+}
+template <class T>
+const T* max_element (const T* first, const T* last) {
+	if (first == last)
+		return last;
+	return first + kernels<T>::max_element(first, last - first);
+}
+template <class T>
+T dot (const T* a, const T* b, size_t n) {
+	return kernels<T>::dot(a, b, n);
+}
+}
+}
+
+#endif
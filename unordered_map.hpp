@@ -0,0 +1,482 @@
+#ifndef unordered_map_hpp
+#define unordered_map_hpp
+
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft {
+//Flat open addressing table: one control byte per slot (free, erased or 7 bits
+//of the hash) probed 16 at a time, values stored inline in a parallel array.
+template <class Key, class T, class Hash = std::hash<Key>, class Pred = std::equal_to<Key>, class Alloc = std::allocator<std::pair<const Key,T> > >
+class unordered_map {
+public:
+	//MARK: - Member types
+	typedef Key key_type;
+	typedef T mapped_type;
+	typedef std::pair<const key_type,mapped_type> value_type;
+	typedef Hash hasher;
+	typedef Pred key_equal;
+	typedef Alloc allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+
+private:
+	enum { GROUP = 16 };
+	static const signed char EMPTY = -128;
+	static const signed char DELETED = -2;
+	static const signed char SENTINEL = -1;
+
+	typedef typename Alloc::template rebind<signed char>::other Alloc_rebind;
+	Alloc			_dataAlloc;
+	Alloc_rebind	_ctrlAlloc;
+	Hash			_hash;
+	Pred			_equal;
+
+	signed char*	_ctrl;
+	value_type*		_slots;
+	size_t			_capacity;
+	size_t			_size;
+	size_t			_growthLeft;
+
+public:
+	//MARK: - Constructors
+	explicit unordered_map (size_type n = 0, const hasher& hf = hasher(), const key_equal& eql = key_equal(),
+							const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _hash(hf), _equal(eql) {
+		initTable(n);
+	};
+	template <class InputIterator>
+	unordered_map (InputIterator first, InputIterator last, size_type n = 0, const hasher& hf = hasher(),
+				   const key_equal& eql = key_equal(), const allocator_type& alloc = allocator_type(),
+				   typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _dataAlloc(alloc), _hash(hf), _equal(eql) {
+		initTable(n);
+		insert(first, last);
+	};
+	unordered_map (const unordered_map& x) : _dataAlloc(x._dataAlloc), _hash(x._hash), _equal(x._equal) {
+		initTable(x._size);
+		insert(x.cbegin(), x.cend());
+	};
+
+	//MARK: - Destructor
+	~unordered_map() {
+		clear();
+		freeTable(_ctrl, _slots, _capacity);
+	};
+
+	//MARK: - Assign
+	unordered_map& operator=(const unordered_map& x) {
+		if (this == &x)
+			return *this;
+		clear();
+		reserve(x._size);
+		insert(x.cbegin(), x.cend());
+		return *this;
+	};
+
+	//MARK: - Iterators
+	class const_iterator;
+	class iterator : public std::iterator<std::forward_iterator_tag, value_type> {
+	public:
+		signed char*	ctrl;
+		value_type*		slot;
+		iterator() : ctrl(0), slot(0) {};
+		iterator(signed char* c, value_type* s) : ctrl(c), slot(s) {
+			skipFree();
+		}
+		iterator& operator++() {
+			ctrl++;
+			slot++;
+			skipFree();
+			return *this;
+		}
+		iterator operator++(int) {
+			iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		bool operator==(const iterator& rhs) const {
+			return ctrl == rhs.ctrl;
+		}
+		bool operator!=(const iterator& rhs) const {
+			return ctrl != rhs.ctrl;
+		}
+		value_type& operator*() const {
+			return *slot;
+		}
+		value_type* operator->() const {
+			return slot;
+		}
+	private:
+		void skipFree() {
+			while (ctrl && *ctrl < 0 && *ctrl != SENTINEL) {
+				ctrl++;
+				slot++;
+			}
+		}
+	};
+	class const_iterator : public std::iterator<std::forward_iterator_tag, value_type> {
+	public:
+		const signed char*	ctrl;
+		const value_type*	slot;
+		const_iterator() : ctrl(0), slot(0) {};
+		const_iterator(const signed char* c, const value_type* s) : ctrl(c), slot(s) {
+			skipFree();
+		}
+		const_iterator(const iterator& src) : ctrl(src.ctrl), slot(src.slot) {}
+		const_iterator& operator++() {
+			ctrl++;
+			slot++;
+			skipFree();
+			return *this;
+		}
+		const_iterator operator++(int) {
+			const_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		bool operator==(const const_iterator& rhs) const {
+			return ctrl == rhs.ctrl;
+		}
+		bool operator!=(const const_iterator& rhs) const {
+			return ctrl != rhs.ctrl;
+		}
+		const value_type& operator*() const {
+			return *slot;
+		}
+		const value_type* operator->() const {
+			return slot;
+		}
+	private:
+		void skipFree() {
+			while (ctrl && *ctrl < 0 && *ctrl != SENTINEL) {
+				ctrl++;
+				slot++;
+			}
+		}
+	};
+	iterator begin() {
+		return iterator(_ctrl, _slots);
+	}
+	iterator end() {
+		return iterator(_ctrl + _capacity, _slots + _capacity);
+	}
+	const_iterator cbegin() const {
+		return const_iterator(_ctrl, _slots);
+	}
+	const_iterator cend() const {
+		return const_iterator(_ctrl + _capacity, _slots + _capacity);
+	}
+
+	//MARK: - Capacity
+	bool empty() const {
+		return (_size == 0);
+	};
+	size_type size() const {
+		return _size;
+	};
+	size_type max_size() const {
+		return std::numeric_limits<size_type>::max() / (sizeof(value_type) + 1);
+	};
+
+	//MARK: - Element access
+	mapped_type& operator[] (const key_type& k) {
+		size_t h = hashOf(k);
+		size_t pos = findIndex(k, h);
+		if (pos == _capacity)
+			pos = insertAt(h, value_type(k, mapped_type()));
+		return _slots[pos].second;
+	};
+	mapped_type& at (const key_type& k) {
+		size_t pos = findIndex(k, hashOf(k));
+		if (pos == _capacity)
+			throw std::out_of_range("key not found");
+		return _slots[pos].second;
+	};
+	const mapped_type& at (const key_type& k) const {
+		size_t pos = findIndex(k, hashOf(k));
+		if (pos == _capacity)
+			throw std::out_of_range("key not found");
+		return _slots[pos].second;
+	};
+
+	//MARK: - Modifiers
+	std::pair<iterator,bool> insert (const value_type& val) {
+		size_t h = hashOf(val.first);
+		size_t pos = findIndex(val.first, h);
+		if (pos != _capacity)
+			return std::pair<iterator, bool>(iteratorAt(pos), false);
+		return std::pair<iterator, bool>(iteratorAt(insertAt(h, val)), true);
+	};
+	iterator insert (const_iterator hint, const value_type& val) {
+		(void)hint;
+		return insert(val).first;
+	};
+	template <class InputIterator>
+	void insert (InputIterator first, InputIterator last) {
+		while (first != last) {
+			insert(*first);
+			first++;
+		}
+	};
+	iterator erase (const_iterator position) {
+		size_t pos = position.ctrl - _ctrl;
+		eraseAt(pos);
+		return iteratorAt(pos);
+	};
+	size_type erase (const key_type& k) {
+		size_t pos = findIndex(k, hashOf(k));
+		if (pos == _capacity)
+			return 0;
+		eraseAt(pos);
+		return 1;
+	};
+	iterator erase (const_iterator first, const_iterator last) {
+		while (first != last) {
+			const_iterator tmp = first;
+			first++;
+			erase(tmp);
+		}
+		return iteratorAt(last.ctrl - _ctrl);
+	};
+	void swap (unordered_map& x) {
+		std::swap(_hash, x._hash);
+		std::swap(_equal, x._equal);
+		std::swap(_ctrl, x._ctrl);
+		std::swap(_slots, x._slots);
+		std::swap(_capacity, x._capacity);
+		std::swap(_size, x._size);
+		std::swap(_growthLeft, x._growthLeft);
+	};
+	void clear() {
+		for (size_t i = 0; i < _capacity; i++) {
+			if (_ctrl[i] >= 0)
+				_dataAlloc.destroy(_slots + i);
+			_ctrl[i] = EMPTY;
+		}
+		_size = 0;
+		_growthLeft = maxLoad(_capacity);
+	};
+
+	//MARK: - Observers
+	hasher hash_function() const {return _hash;};
+	key_equal key_eq() const {return _equal;};
+
+	//MARK: - Operations
+	iterator find (const key_type& k) {
+		return iteratorAt(findIndex(k, hashOf(k)));
+	};
+	const_iterator find (const key_type& k) const {
+		size_t pos = findIndex(k, hashOf(k));
+		return const_iterator(_ctrl + pos, _slots + pos);
+	};
+	size_type count (const key_type& k) const {
+		return findIndex(k, hashOf(k)) != _capacity;
+	};
+	std::pair<iterator,iterator> equal_range (const key_type& k) {
+		iterator it = find(k);
+		if (it == end())
+			return std::pair<iterator,iterator>(it, it);
+		iterator next = it;
+		return std::pair<iterator,iterator>(it, ++next);
+	};
+	std::pair<const_iterator,const_iterator> equal_range (const key_type& k) const {
+		const_iterator it = find(k);
+		if (it == cend())
+			return std::pair<const_iterator,const_iterator>(it, it);
+		const_iterator next = it;
+		return std::pair<const_iterator,const_iterator>(it, ++next);
+	};
+
+	//MARK: - Hash policy
+	size_type bucket_count() const {
+		return _capacity;
+	};
+	float load_factor() const {
+		return _capacity == 0 ? 0 : static_cast<float>(_size) / _capacity;
+	};
+	float max_load_factor() const {
+		return 7.0f / 8;
+	};
+	void rehash (size_type n) {
+		if (n < _size)
+			n = _size;
+		size_t capacity = capacityFor(n);
+		if (capacity != _capacity)
+			resizeTable(capacity);
+	};
+	void reserve (size_type n) {
+		if (n > _size + _growthLeft)
+			resizeTable(capacityFor(n));
+	};
+
+	//MARK: - Utilitys
+private:
+	static size_t maxLoad(size_t capacity) {
+		return capacity - capacity / 8;
+	}
+	static size_t capacityFor(size_t n) {
+		if (n == 0)
+			return 0;
+		size_t capacity = GROUP;
+		while (maxLoad(capacity) < n)
+			capacity = capacity * 2;
+		return capacity;
+	}
+	size_t hashOf(const key_type& k) const {
+		size_t h = _hash(k) * static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+		return h ^ (h >> (sizeof(size_t) * 4));
+	}
+	static unsigned matchByte(const signed char* group, signed char b) {
+#if defined(__SSE2__)
+		__m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(b), ctrl)));
+#else
+		unsigned mask = 0;
+		for (int i = 0; i < GROUP; i++)
+			if (group[i] == b)
+				mask |= 1u << i;
+		return mask;
+#endif
+	}
+	static unsigned matchFree(const signed char* group) {
+#if defined(__SSE2__)
+		__m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmplt_epi8(ctrl, _mm_set1_epi8(SENTINEL))));
+#else
+		unsigned mask = 0;
+		for (int i = 0; i < GROUP; i++)
+			if (group[i] < SENTINEL)
+				mask |= 1u << i;
+		return mask;
+#endif
+	}
+	iterator iteratorAt(size_t pos) {
+		return iterator(_ctrl + pos, _slots + pos);
+	}
+	size_t findIndex(const key_type& k, size_t h) const {
+		if (_capacity == 0)
+			return 0;
+		signed char h2 = static_cast<signed char>(h & 0x7F);
+		size_t mask = _capacity / GROUP - 1;
+		size_t group = (h >> 7) & mask;
+		for (size_t step = 1; step <= _capacity / GROUP; step++) {
+			const signed char* ctrl = _ctrl + group * GROUP;
+			for (unsigned match = matchByte(ctrl, h2); match; match &= match - 1) {
+				size_t pos = group * GROUP + __builtin_ctz(match);
+				if (_equal(_slots[pos].first, k))
+					return pos;
+			}
+			if (matchByte(ctrl, EMPTY))
+				break;
+			group = (group + step) & mask;
+		}
+		return _capacity;
+	}
+	size_t freeIndex(size_t h) const {
+		size_t mask = _capacity / GROUP - 1;
+		size_t group = (h >> 7) & mask;
+		for (size_t step = 1; ; step++) {
+			unsigned match = matchFree(_ctrl + group * GROUP);
+			if (match)
+				return group * GROUP + __builtin_ctz(match);
+			group = (group + step) & mask;
+		}
+	}
+	size_t insertAt(size_t h, const value_type& val) {
+		if (_capacity == 0)
+			resizeTable(GROUP);
+		size_t pos = freeIndex(h);
+		if (_growthLeft == 0 && _ctrl[pos] == EMPTY) {
+			resizeTable(_size * 2 >= maxLoad(_capacity) ? _capacity * 2 : _capacity);
+			pos = freeIndex(h);
+		}
+		_dataAlloc.construct(_slots + pos, val);
+		if (_ctrl[pos] == EMPTY)
+			_growthLeft--;
+		_ctrl[pos] = static_cast<signed char>(h & 0x7F);
+		_size++;
+		return pos;
+	}
+	void eraseAt(size_t pos) {
+		_dataAlloc.destroy(_slots + pos);
+		if (matchByte(_ctrl + pos / GROUP * GROUP, EMPTY)) {
+			_ctrl[pos] = EMPTY;
+			_growthLeft++;
+		}
+		else
+			_ctrl[pos] = DELETED;
+		_size--;
+	}
+	void initTable(size_t n) {
+		_ctrl = 0;
+		_slots = 0;
+		_capacity = 0;
+		_size = 0;
+		_growthLeft = 0;
+		if (n != 0)
+			resizeTable(capacityFor(n));
+	}
+	void resizeTable(size_t capacity) {
+		signed char* oldCtrl = _ctrl;
+		value_type* oldSlots = _slots;
+		size_t oldCapacity = _capacity;
+		_ctrl = _ctrlAlloc.allocate(capacity + 1);
+		_slots = _dataAlloc.allocate(capacity);
+		_capacity = capacity;
+		for (size_t i = 0; i < capacity; i++)
+			_ctrl[i] = EMPTY;
+		_ctrl[capacity] = SENTINEL;
+		_growthLeft = maxLoad(capacity) - _size;
+		for (size_t i = 0; i < oldCapacity; i++) {
+			if (oldCtrl[i] >= 0) {
+				size_t h = hashOf(oldSlots[i].first);
+				size_t pos = freeIndex(h);
+				_dataAlloc.construct(_slots + pos, oldSlots[i]);
+				_ctrl[pos] = static_cast<signed char>(h & 0x7F);
+				_dataAlloc.destroy(oldSlots + i);
+			}
+		}
+		freeTable(oldCtrl, oldSlots, oldCapacity);
+	}
+	void freeTable(signed char* ctrl, value_type* slots, size_t capacity) {
+		if (ctrl == 0)
+			return;
+		_ctrlAlloc.deallocate(ctrl, capacity + 1);
+		_dataAlloc.deallocate(slots, capacity);
+	}
+};
+
+//MARK: - Non-member function overloads
+template <class Key, class T, class Hash, class Pred, class Alloc>
+bool operator== (const unordered_map<Key,T,Hash,Pred,Alloc>& lhs, const unordered_map<Key,T,Hash,Pred,Alloc>& rhs) {
+	if (lhs.size() != rhs.size())
+		return false;
+	typename ft::unordered_map<Key,T,Hash,Pred,Alloc>::const_iterator it = lhs.cbegin();
+	for (; it != lhs.cend(); it++) {
+		typename ft::unordered_map<Key,T,Hash,Pred,Alloc>::const_iterator res = rhs.find(it->first);
+		if (res == rhs.cend() || !(res->second == it->second))
+			return false;
+	}
+	return true;
+};
+template <class Key, class T, class Hash, class Pred, class Alloc>
+bool operator!= (const unordered_map<Key,T,Hash,Pred,Alloc>& lhs, const unordered_map<Key,T,Hash,Pred,Alloc>& rhs) {
+	return !(lhs == rhs);
+};
+template <class Key, class T, class Hash, class Pred, class Alloc>
+void swap (unordered_map<Key,T,Hash,Pred,Alloc>& x, unordered_map<Key,T,Hash,Pred,Alloc>& y) {
+	x.swap(y);
+};
+}
+
+#endif
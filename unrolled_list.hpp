@@ -0,0 +1,689 @@
+#ifndef unrolled_list_hpp
+#define unrolled_list_hpp
+
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace ft {
+template <class T, size_t BlockSize = 16, class Alloc = std::allocator<T> > class unrolled_list {
+private:
+	typedef struct		s_ulink
+	{
+		struct s_ulink*	_next;
+		struct s_ulink*	_prev;
+		size_t			_count;
+	}					t_ulink;
+	typedef struct		s_ublock : public s_ulink
+	{
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type	_data[BlockSize];
+	}					t_ublock;
+
+	typedef typename Alloc::template rebind<t_ublock>::other Alloc_rebind;
+	Alloc				_dataAlloc;
+	Alloc_rebind		_blockAlloc;
+
+	t_ulink				_end;
+	size_t				_size;
+
+public:
+	//MARK: - Member types
+	typedef T value_type;
+	typedef Alloc allocator_type;
+	typedef typename allocator_type::reference reference;
+	typedef typename allocator_type::const_reference const_reference;
+	typedef typename allocator_type::pointer pointer;
+	typedef typename allocator_type::const_pointer const_pointer;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+
+	//MARK: - Constructors
+	explicit unrolled_list (const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _blockAlloc(alloc) {
+		resetEnd();
+	};
+	explicit unrolled_list (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc), _blockAlloc(alloc) {
+		resetEnd();
+		for (size_type i = 0; i < n; i++)
+			push_back(val);
+	};
+	template <class InputIterator>
+	unrolled_list (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _dataAlloc(alloc), _blockAlloc(alloc) {
+		resetEnd();
+		while (first != last) {
+			push_back(*first);
+			first++;
+		}
+	};
+	unrolled_list (const unrolled_list& src) : _dataAlloc(src._dataAlloc), _blockAlloc(src._blockAlloc) {
+		resetEnd();
+		for (const_iterator it = src.cbegin(); it != src.cend(); it++)
+			push_back(*it);
+	};
+
+	//MARK: - Destructor
+	~unrolled_list() {
+		clear();
+	};
+
+	//MARK: - Assign
+	unrolled_list& operator=(const unrolled_list& src) {
+		if (this == &src)
+			return (*this);
+		clear();
+		for (const_iterator it = src.cbegin(); it != src.cend(); it++)
+			push_back(*it);
+		return (*this);
+	};
+	template <class InputIterator>
+	void assign (InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
+		clear();
+		while (first != last) {
+			push_back(*first);
+			first++;
+		}
+	};
+	void assign (size_type n, const value_type& val) {
+		clear();
+		for (size_type i = 0; i < n; i++)
+			push_back(val);
+	};
+
+	//MARK: - Iterators
+	class iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_ulink* point;
+		size_t index;
+		iterator() : point(0), index(0) {};
+		iterator(t_ulink* src, size_t idx) : point(src), index(idx) {}
+		iterator& operator++() {
+			stepForward(point, index);
+			return *this;
+		}
+		iterator operator++(int) {
+			iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		iterator& operator--() {
+			stepBack(point, index);
+			return *this;
+		}
+		iterator operator--(int) {
+			iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		bool operator==(const iterator& rhs) const {
+			return point == rhs.point && index == rhs.index;
+		}
+		bool operator!=(const iterator& rhs) const {
+			return !(*this == rhs);
+		}
+		value_type& operator*() const {
+			return valueAt(point, index);
+		}
+		value_type* operator->() const {
+			return &valueAt(point, index);
+		}
+	};
+	class const_iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_ulink* point;
+		size_t index;
+		const_iterator() : point(0), index(0) {};
+		const_iterator(t_ulink* src, size_t idx) : point(src), index(idx) {}
+		const_iterator(const iterator& src) : point(src.point), index(src.index) {}
+		const_iterator& operator++() {
+			stepForward(point, index);
+			return *this;
+		}
+		const_iterator operator++(int) {
+			const_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		const_iterator& operator--() {
+			stepBack(point, index);
+			return *this;
+		}
+		const_iterator operator--(int) {
+			const_iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		bool operator==(const const_iterator& rhs) const {
+			return point == rhs.point && index == rhs.index;
+		}
+		bool operator!=(const const_iterator& rhs) const {
+			return !(*this == rhs);
+		}
+		const value_type& operator*() const {
+			return valueAt(point, index);
+		}
+		const value_type* operator->() const {
+			return &valueAt(point, index);
+		}
+	};
+	class reverse_iterator : public std::iterator<std::bidirectional_iterator_tag, value_type> {
+	public:
+		t_ulink* point;
+		size_t index;
+		reverse_iterator() : point(0), index(0) {};
+		reverse_iterator(t_ulink* src, size_t idx) : point(src), index(idx) {}
+		reverse_iterator& operator++() {
+			stepBack(point, index);
+			return *this;
+		}
+		reverse_iterator operator++(int) {
+			reverse_iterator tmp(*this);
+			operator++();
+			return tmp;
+		}
+		reverse_iterator& operator--() {
+			stepForward(point, index);
+			return *this;
+		}
+		reverse_iterator operator--(int) {
+			reverse_iterator tmp(*this);
+			operator--();
+			return tmp;
+		}
+		bool operator==(const reverse_iterator& rhs) const {
+			return point == rhs.point && index == rhs.index;
+		}
+		bool operator!=(const reverse_iterator& rhs) const {
+			return !(*this == rhs);
+		}
+		value_type& operator*() const {
+			return valueAt(point, index);
+		}
+		value_type* operator->() const {
+			return &valueAt(point, index);
+		}
+	};
+	iterator begin() {
+		return iterator(_end._next, 0);
+	}
+	iterator end() {
+		return iterator(&_end, 0);
+	}
+	const_iterator cbegin() const {
+		return const_iterator(_end._next, 0);
+	}
+	const_iterator cend() const {
+		return const_iterator(const_cast<t_ulink*>(&_end), 0);
+	}
+	reverse_iterator rbegin() {
+		iterator tmp = end();
+		tmp--;
+		return reverse_iterator(tmp.point, tmp.index);
+	}
+	reverse_iterator rend() {
+		return reverse_iterator(&_end, 0);
+	}
+
+	//MARK: - Capacity
+	bool empty() const {
+		return _size == 0;
+	};
+	size_type size() const {
+		return _size;
+	};
+	size_type max_size() const {
+		return std::numeric_limits<size_type>::max() / sizeof(t_ublock) * BlockSize;
+	};
+
+	//MARK: - Element access
+	reference front() {
+		return valueAt(_end._next, 0);
+	};
+	const_reference front() const {
+		return valueAt(_end._next, 0);
+	};
+	reference back() {
+		return valueAt(_end._prev, _end._prev->_count - 1);
+	};
+	const_reference back() const {
+		return valueAt(_end._prev, _end._prev->_count - 1);
+	};
+
+	//MARK: - Modifiers
+	void push_back (const value_type& val) {
+		emplace(end(), val);
+	};
+	void push_front (const value_type& val) {
+		emplace(begin(), val);
+	};
+	void pop_front() {
+		if (_size > 0)
+			erase(begin());
+	};
+	void pop_back() {
+		if (_size > 0)
+			erase(--end());
+	};
+	iterator insert (iterator position, const value_type& val) {
+		return emplace(position, val);
+	};
+	void insert (iterator position, size_type n, const value_type& val) {
+		for (size_type i = 0; i < n; i++) {
+			position = emplace(position, val);
+			position++;
+		}
+	};
+	template <class InputIterator>
+	void insert (iterator position, InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
+		while (first != last) {
+			position = emplace(position, *first);
+			position++;
+			first++;
+		}
+	};
+	template <class... Args>
+	iterator emplace (iterator position, Args&&... args) {
+		t_ulink* block = position.point;
+		size_t index = position.index;
+		if (index == 0 && block->_prev != &_end && block->_prev->_count < BlockSize) {
+			block = block->_prev;
+			index = block->_count;
+		}
+		else if (block == &_end || block->_count == BlockSize) {
+			if (index == 0)
+				block = linkBlock(block, createBlock());
+			else {
+				t_ulink* upper = splitBlock(block, BlockSize / 2);
+				if (index > block->_count) {
+					index -= block->_count;
+					block = upper;
+				}
+			}
+		}
+		shiftUp(block, index);
+		try {
+			_dataAlloc.construct(&valueAt(block, index), std::forward<Args>(args)...);
+		}
+		catch (...) {
+			shiftDown(block, index);
+			if (block->_count == 0)
+				freeBlock(unlinkBlock(block));
+			throw;
+		}
+		_size++;
+		return iterator(block, index);
+	};
+	iterator erase (iterator position) {
+		t_ulink* block = position.point;
+		size_t index = position.index;
+		_dataAlloc.destroy(&valueAt(block, index));
+		shiftDown(block, index);
+		_size--;
+		if (block->_count == 0) {
+			t_ulink* next = block->_next;
+			freeBlock(unlinkBlock(block));
+			return iterator(next, 0);
+		}
+		if (block->_count < BlockSize / 2 && block->_next != &_end && block->_count + block->_next->_count <= BlockSize)
+			absorbNext(block);
+		if (index == block->_count)
+			return iterator(block->_next, 0);
+		return iterator(block, index);
+	};
+	iterator erase (iterator first, iterator last) {
+		size_type n = 0;
+		for (iterator it = first; it != last; it++)
+			n++;
+		for (size_type i = 0; i < n; i++)
+			first = erase(first);
+		return first;
+	};
+	void swap (unrolled_list& src) {
+		t_ulink* first = _end._next;
+		t_ulink* last = _end._prev;
+		t_ulink* srcFirst = src._end._next;
+		t_ulink* srcLast = src._end._prev;
+		attachRing(srcFirst, srcLast, src._end);
+		src.attachRing(first, last, _end);
+		size_type tmpSize = _size;
+		_size = src._size;
+		src._size = tmpSize;
+	};
+	void resize (size_type n, value_type val = value_type()) {
+		while (_size > n)
+			pop_back();
+		while (_size < n)
+			push_back(val);
+	};
+	void clear() {
+		t_ulink* block = _end._next;
+		while (block != &_end) {
+			t_ulink* next = block->_next;
+			for (size_t i = 0; i < block->_count; i++)
+				_dataAlloc.destroy(&valueAt(block, i));
+			freeBlock(block);
+			block = next;
+		}
+		resetEnd();
+	};
+
+	//MARK: - Operations
+	void splice (iterator position, unrolled_list& src) {
+		if (this == &src || src._size == 0)
+			return;
+		t_ulink* block = position.point;
+		if (position.index != 0)
+			block = splitBlock(block, position.index);
+		t_ulink* first = src._end._next;
+		t_ulink* last = src._end._prev;
+		first->_prev = block->_prev;
+		block->_prev->_next = first;
+		last->_next = block;
+		block->_prev = last;
+		_size += src._size;
+		src.resetEnd();
+	};
+	void splice (iterator position, unrolled_list& src, iterator i) {
+		iterator next = i;
+		next++;
+		splice(position, src, i, next);
+	};
+	void splice (iterator position, unrolled_list& src, iterator first, iterator last) {
+		if (first == last || position == last)
+			return;
+		unrolled_list tmp(_dataAlloc);
+		size_type offset = 0;
+		if (this == &src) {
+			for (iterator it = begin(); it != position; it++)
+				offset++;
+			size_type before = 0;
+			for (iterator it = begin(); it != first; it++)
+				before++;
+			for (iterator it = first; it != last; it++)
+				tmp.emplace(tmp.end(), std::move(*it));
+			if (offset > before)
+				offset -= tmp._size;
+		}
+		else
+			for (iterator it = first; it != last; it++)
+				tmp.emplace(tmp.end(), std::move(*it));
+		src.erase(first, last);
+		if (this == &src) {
+			position = begin();
+			std::advance(position, offset);
+		}
+		splice(position, tmp);
+	};
+	size_type remove (const value_type& val) {
+		// val may live in this list, and remove_if relocates the survivors
+		const value_type copy(val);
+		return remove_if(equalTo(copy));
+	};
+	template <class Predicate>
+	size_type remove_if (Predicate pred) {
+		size_type res = 0;
+		t_ulink* block = _end._next;
+		while (block != &_end) {
+			size_t write = 0;
+			for (size_t read = 0; read < block->_count; read++) {
+				if (pred(valueAt(block, read))) {
+					_dataAlloc.destroy(&valueAt(block, read));
+					res++;
+				}
+				else
+					relocate(block, read, block, write++);
+			}
+			block->_count = write;
+			block = block->_next;
+		}
+		_size -= res;
+		compact();
+		return res;
+	};
+	size_type unique() {
+		return unique(std::equal_to<value_type>());
+	};
+	template <class BinaryPredicate>
+	size_type unique (BinaryPredicate binary_pred) {
+		size_type res = 0;
+		value_type* kept = 0;
+		t_ulink* block = _end._next;
+		while (block != &_end) {
+			size_t write = 0;
+			for (size_t read = 0; read < block->_count; read++) {
+				if (kept != 0 && binary_pred(*kept, valueAt(block, read))) {
+					_dataAlloc.destroy(&valueAt(block, read));
+					res++;
+				}
+				else {
+					relocate(block, read, block, write);
+					kept = &valueAt(block, write++);
+				}
+			}
+			block->_count = write;
+			block = block->_next;
+		}
+		_size -= res;
+		compact();
+		return res;
+	};
+	void merge (unrolled_list& src) {
+		merge(src, std::less<value_type>());
+	};
+	template <class Compare>
+	void merge (unrolled_list& src, Compare comp) {
+		if (this == &src || src._size == 0)
+			return;
+		unrolled_list res(_dataAlloc);
+		iterator it = begin();
+		iterator srci = src.begin();
+		while (it != end() && srci != src.end()) {
+			if (comp(*srci, *it)) {
+				res.emplace(res.end(), std::move(*srci));
+				srci++;
+			}
+			else {
+				res.emplace(res.end(), std::move(*it));
+				it++;
+			}
+		}
+		for (; it != end(); it++)
+			res.emplace(res.end(), std::move(*it));
+		for (; srci != src.end(); srci++)
+			res.emplace(res.end(), std::move(*srci));
+		src.clear();
+		swap(res);
+	};
+	void sort() {
+		sort(std::less<value_type>());
+	};
+	template <class Compare>
+	void sort (Compare comp) {
+		if (_size < 2)
+			return;
+		value_type* buffer = _dataAlloc.allocate(_size);
+		size_type n = 0;
+		for (iterator it = begin(); it != end(); it++)
+			_dataAlloc.construct(buffer + n++, std::move(*it));
+		std::stable_sort(buffer, buffer + n, comp);
+		n = 0;
+		for (iterator it = begin(); it != end(); it++)
+			*it = std::move(buffer[n++]);
+		for (size_type i = 0; i < n; i++)
+			_dataAlloc.destroy(buffer + i);
+		_dataAlloc.deallocate(buffer, n);
+	};
+	void reverse() {
+		t_ulink* block = &_end;
+		do {
+			t_ulink* next = block->_next;
+			block->_next = block->_prev;
+			block->_prev = next;
+			for (size_t i = 0; i < block->_count / 2; i++)
+				std::swap(valueAt(block, i), valueAt(block, block->_count - 1 - i));
+			block = next;
+		} while (block != &_end);
+	};
+
+	//MARK: - Allocator
+	allocator_type get_allocator() const {
+		return _dataAlloc;
+	};
+
+	//MARK: - Utilitys
+private:
+	struct equalTo {
+		const value_type& val;
+		equalTo(const value_type& src) : val(src) {}
+		bool operator()(const value_type& elem) const {
+			return elem == val;
+		}
+	};
+	static value_type& valueAt(t_ulink* block, size_t index) {
+		return *reinterpret_cast<value_type*>(&static_cast<t_ublock*>(block)->_data[index]);
+	}
+	static void stepForward(t_ulink*& block, size_t& index) {
+		if (++index >= block->_count) {
+			block = block->_next;
+			index = 0;
+		}
+	}
+	static void stepBack(t_ulink*& block, size_t& index) {
+		if (index == 0) {
+			block = block->_prev;
+			index = block->_count;
+		}
+		if (index != 0)
+			index--;
+	}
+	void resetEnd() {
+		_end._next = &_end;
+		_end._prev = &_end;
+		_end._count = 0;
+		_size = 0;
+	}
+	void attachRing(t_ulink* first, t_ulink* last, t_ulink& oldEnd) {
+		if (first == &oldEnd) {
+			_end._next = &_end;
+			_end._prev = &_end;
+			return;
+		}
+		_end._next = first;
+		_end._prev = last;
+		first->_prev = &_end;
+		last->_next = &_end;
+	}
+	void relocate(t_ulink* from, size_t fromIndex, t_ulink* to, size_t toIndex) {
+		if (from == to && fromIndex == toIndex)
+			return;
+		_dataAlloc.construct(&valueAt(to, toIndex), std::move(valueAt(from, fromIndex)));
+		_dataAlloc.destroy(&valueAt(from, fromIndex));
+	}
+	void shiftUp(t_ulink* block, size_t index) {
+		for (size_t i = block->_count; i > index; i--)
+			relocate(block, i - 1, block, i);
+		block->_count++;
+	}
+	void shiftDown(t_ulink* block, size_t index) {
+		for (size_t i = index + 1; i < block->_count; i++)
+			relocate(block, i, block, i - 1);
+		block->_count--;
+	}
+	t_ulink* splitBlock(t_ulink* block, size_t index) {
+		t_ulink* upper = linkBlock(block->_next, createBlock());
+		for (size_t i = index; i < block->_count; i++)
+			relocate(block, i, upper, i - index);
+		upper->_count = block->_count - index;
+		block->_count = index;
+		return upper;
+	}
+	void absorbNext(t_ulink* block) {
+		t_ulink* next = block->_next;
+		for (size_t i = 0; i < next->_count; i++)
+			relocate(next, i, block, block->_count + i);
+		block->_count += next->_count;
+		next->_count = 0;
+		freeBlock(unlinkBlock(next));
+	}
+	void compact() {
+		t_ulink* block = _end._next;
+		while (block != &_end) {
+			if (block->_count == 0) {
+				t_ulink* next = block->_next;
+				freeBlock(unlinkBlock(block));
+				block = next;
+			}
+			else if (block->_next != &_end && block->_count + block->_next->_count <= BlockSize)
+				absorbNext(block);
+			else
+				block = block->_next;
+		}
+	}
+	t_ulink* linkBlock(t_ulink* position, t_ulink* newone) {
+		newone->_prev = position->_prev;
+		newone->_next = position;
+		position->_prev->_next = newone;
+		position->_prev = newone;
+		return newone;
+	}
+	t_ulink* unlinkBlock(t_ulink* block) {
+		block->_prev->_next = block->_next;
+		block->_next->_prev = block->_prev;
+		return block;
+	}
+	t_ulink* createBlock() {
+		t_ublock* newone = _blockAlloc.allocate(1);
+		newone->_next = 0;
+		newone->_prev = 0;
+		newone->_count = 0;
+		return newone;
+	}
+	void freeBlock(t_ulink* block) {
+		_blockAlloc.deallocate(static_cast<t_ublock*>(block), 1);
+	}
+};
+
+//MARK: - Non-member function overloads
+template <class T, size_t BlockSize, class Alloc>
+bool operator== (const ft::unrolled_list<T,BlockSize,Alloc>& lhs, const ft::unrolled_list<T,BlockSize,Alloc>& rhs) {
+	if (lhs.size() != rhs.size())
+		return false;
+	typename ft::unrolled_list<T,BlockSize,Alloc>::const_iterator lit = lhs.cbegin();
+	typename ft::unrolled_list<T,BlockSize,Alloc>::const_iterator rit = rhs.cbegin();
+	while (lit != lhs.cend()) {
+		if (!(*lit == *rit))
+			return false;
+		lit++;
+		rit++;
+	}
+	return true;
+};
+template <class T, size_t BlockSize, class Alloc>
+bool operator!= (const ft::unrolled_list<T,BlockSize,Alloc>& lhs, const ft::unrolled_list<T,BlockSize,Alloc>& rhs) {
+	return !(lhs == rhs);
+};
+template <class T, size_t BlockSize, class Alloc>
+bool operator<  (const ft::unrolled_list<T,BlockSize,Alloc>& lhs, const ft::unrolled_list<T,BlockSize,Alloc>& rhs) {
+	return std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+};
+template <class T, size_t BlockSize, class Alloc>
+bool operator<= (const ft::unrolled_list<T,BlockSize,Alloc>& lhs, const ft::unrolled_list<T,BlockSize,Alloc>& rhs) {
+	return !(rhs < lhs);
+};
+template <class T, size_t BlockSize, class Alloc>
+bool operator>  (const ft::unrolled_list<T,BlockSize,Alloc>& lhs, const ft::unrolled_list<T,BlockSize,Alloc>& rhs) {
+	return rhs < lhs;
+};
+template <class T, size_t BlockSize, class Alloc>
+bool operator>= (const ft::unrolled_list<T,BlockSize,Alloc>& lhs, const ft::unrolled_list<T,BlockSize,Alloc>& rhs) {
+	return !(lhs < rhs);
+};
+template <class T, size_t BlockSize, class Alloc>
+void swap (ft::unrolled_list<T,BlockSize,Alloc>& x, ft::unrolled_list<T,BlockSize,Alloc>& y) {
+	x.swap(y);
+};
+}
+
+#endif
@@ -1,13 +1,75 @@
 #ifndef vector_hpp
 #define vector_hpp
 
+#include <algorithm>
 #include <iostream>
 #include <iterator>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include "simd.hpp"
 
 namespace ft {
-template < class T, class Alloc = std::allocator<T> >
+//MARK: - Growth policies
+//next picks the capacity when the vector has to grow; fit picks it when a
+//caller asks for an exact size (construction, copy, assign, reserve and
+//shrink_to_fit).
+struct double_growth {
+	static size_t next(size_t capacity, size_t required, size_t) {
+		if (capacity == 0)
+			capacity = 1;
+		while (capacity < required)
+			capacity = capacity * 2;
+		return capacity;
+	}
+	static size_t fit(size_t required, size_t) {
+		return required;
+	}
+};
+struct one_and_half_growth {
+	static size_t next(size_t capacity, size_t required, size_t) {
+		if (capacity < 2)
+			capacity = 2;
+		while (capacity < required)
+			capacity = capacity + capacity / 2;
+		return capacity;
+	}
+	static size_t fit(size_t required, size_t) {
+		return required;
+	}
+};
+template <size_t PageSize = 4096>
+struct page_growth {
+	static size_t next(size_t capacity, size_t required, size_t elemSize) {
+		size_t bytes = double_growth::next(capacity, required, elemSize) * elemSize;
+		bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+		return bytes / elemSize;
+	}
+	static size_t fit(size_t required, size_t) {
+		return required;
+	}
+};
+template <size_t Align = 64, class Base = double_growth>
+struct aligned_growth {
+	static size_t next(size_t capacity, size_t required, size_t elemSize) {
+		return fit(Base::next(capacity, required, elemSize), elemSize);
+	}
+	//Rounds up to a multiple of lcm(Align, elemSize) / elemSize elements, so the
+	//storage is a whole number of Align-byte blocks for any element size.
+	static size_t fit(size_t required, size_t elemSize) {
+		size_t a = Align;
+		size_t b = elemSize;
+		while (b != 0) {
+			size_t tmp = a % b;
+			a = b;
+			b = tmp;
+		}
+		size_t step = Align / a;
+		return (Base::fit(required, elemSize) + step - 1) / step * step;
+	}
+};
+
+template < class T, class Alloc = std::allocator<T>, class Growth = double_growth >
 class vector {
 private:
 	T*				_data;
@@ -24,369 +86,331 @@ public:
 	typedef typename allocator_type::const_pointer const_pointer;
 	typedef ptrdiff_t difference_type;
 	typedef size_t size_type;
+	typedef Growth growth_policy;
 	
 	//MARK: - Constructors
 	explicit vector (const allocator_type& alloc = allocator_type()) : _data(0), _capacity(0), _size(0), _dataAlloc(alloc) {};
 	explicit vector (size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type()) : _dataAlloc(alloc) {
-		_data = createArr(n);
+		_capacity = fitCapacity(n);
+		_data = fillArr(n, _capacity, val);
 		_size = n;
-		_capacity = n;
-		fillArr(val, 0, n, _data);
 	};
 	template <class InputIterator>
 	vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _data(0), _capacity(0), _size(0), _dataAlloc(alloc) {
-		_data = createArr(last - first);
-		_size = last - first;
-		_capacity = last - first;
-		copyArr(first, last, _data);
+		rangeInit(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 	};
-	vector (const vector& x) {
-		_capacity = x._size;
+	vector (const vector& x) : _dataAlloc(x._dataAlloc) {
+		_capacity = fitCapacity(x._size);
+		_data = buildArr(x._data, x._data + x._size, _capacity);
 		_size = x._size;
-		_data = createArr(_capacity);
-		const_iterator it = x.cbegin();
-		const_iterator ite = x.cend();
-		constCopyArr(it, ite, _data);
 	};
 	
 	//MARK: - Destructor
 	~vector() {
-		clear();
+		destroyRange(_data, _data + _size);
 		_dataAlloc.deallocate(_data, _capacity);
-		_capacity = 0;
 	};
 	
 	//MARK: - Assign
 	vector& operator=(const vector& x) {
 		if (this == &x)
 			return (*this);
-		const_iterator it = x.cbegin();
-		const_iterator ite = x.cend();
-		T* tmp = createArr(x._capacity);
-		constCopyArr(it, ite, tmp);
-		clear();
-		_dataAlloc.deallocate(_data, _capacity);
-		_capacity = x._size;
-		_size = x._size;
-		_data = tmp;
+		assignRange(x._data, x._data + x._size, x._size);
 		return (*this);
 	};
 	
 	//MARK: - Iterators
-	class iterator : public std::iterator<std::random_access_iterator_tag, value_type> {
+	class iterator : public std::iterator<std::random_access_iterator_tag, value_type, difference_type, value_type*, value_type&> {
 	public:
 		T*		data;
 		iterator() : data(0) {};
 		iterator(T* src) : data(src) {}
-		iterator(const iterator& src) {
-			data = src.data;
-		}
-		iterator& operator=(const iterator& src) {
-			if (*this == src)
-				return (*this);
-			this->data = src.data;
-			return (*this);
-		}
-		virtual ~iterator() {};
-		virtual iterator& operator++() {
+		iterator& operator++() {
 			data++;
 			return *this;
 		}
-		virtual iterator operator++(int){
+		iterator operator++(int) {
 			iterator tmp = *this;
-			operator++();
+			data++;
 			return tmp;
 		}
-		virtual iterator& operator--() {
+		iterator& operator--() {
 			data--;
 			return *this;
 		}
-		virtual iterator operator--(int) {
+		iterator operator--(int) {
 			iterator tmp = *this;
-			operator--();
+			data--;
 			return tmp;
 		}
-		virtual bool operator==(const iterator& rhs) const {
-			return data == rhs.data;
-		}
-		virtual bool operator!=(const iterator& rhs) const {
-			return data != rhs.data;
-		}
-		virtual value_type& operator*() {
+		value_type& operator*() const {
 			return *data;
 		}
-		virtual value_type operator->() {
-			return *data;
+		value_type* operator->() const {
+			return data;
 		}
-		virtual iterator operator+(int num) {
+		value_type& operator[](difference_type num) const {
+			return data[num];
+		}
+		iterator& operator+=(difference_type num) {
 			data += num;
 			return *this;
 		}
-		virtual iterator operator-(int num) {
+		iterator& operator-=(difference_type num) {
 			data -= num;
 			return *this;
 		}
-		virtual value_type& operator[](const size_t num) {
-			return (*(data + num));
+		iterator operator+(difference_type num) const {
+			return iterator(data + num);
 		}
-		virtual bool operator<(const iterator x) {
-			return (data < x.data);
+		iterator operator-(difference_type num) const {
+			return iterator(data - num);
 		}
-		virtual bool operator>(const iterator x) {
-			return (data > x.data);
+		friend iterator operator+(difference_type num, const iterator& it) {
+			return iterator(it.data + num);
 		}
-		virtual bool operator<=(const iterator x) {
-			return (data <= x.data);
+		friend difference_type operator-(const iterator& lhs, const iterator& rhs) {
+			return lhs.data - rhs.data;
 		}
-		virtual bool operator>=(const iterator x) {
-			return (data >= x.data);
+		friend bool operator==(const iterator& lhs, const iterator& rhs) {
+			return lhs.data == rhs.data;
 		}
-		virtual iterator& operator+=(const size_t num) {
-			data += num;
-			return *this;
+		friend bool operator!=(const iterator& lhs, const iterator& rhs) {
+			return lhs.data != rhs.data;
 		}
-		virtual iterator& operator-=(const size_t num) {
-			data -= num;
-			return *this;
+		friend bool operator<(const iterator& lhs, const iterator& rhs) {
+			return lhs.data < rhs.data;
+		}
+		friend bool operator>(const iterator& lhs, const iterator& rhs) {
+			return lhs.data > rhs.data;
+		}
+		friend bool operator<=(const iterator& lhs, const iterator& rhs) {
+			return lhs.data <= rhs.data;
+		}
+		friend bool operator>=(const iterator& lhs, const iterator& rhs) {
+			return lhs.data >= rhs.data;
 		}
 	};
-	class const_iterator : public std::iterator<std::random_access_iterator_tag, value_type> {
+	class const_iterator : public std::iterator<std::random_access_iterator_tag, value_type, difference_type, const value_type*, const value_type&> {
 	public:
 		T*		data;
-		const_iterator() : data(0){};
+		const_iterator() : data(0) {};
 		const_iterator(T* src) : data(src) {}
-		const_iterator(const const_iterator& src) {
-			*this = src;
-		}
-		const_iterator& operator=(const const_iterator& src) {
-			if (*this == src)
-				return (*this);
-			this->data = src.data;
-			return (*this);
-		}
-		virtual ~const_iterator() {};
-		virtual const_iterator& operator++() {
+		const_iterator(const iterator& src) : data(src.data) {}
+		const_iterator& operator++() {
 			data++;
 			return *this;
 		}
-		virtual const_iterator operator++(int){
+		const_iterator operator++(int) {
 			const_iterator tmp = *this;
-			operator++();
+			data++;
 			return tmp;
 		}
-		virtual const_iterator& operator--() {
+		const_iterator& operator--() {
 			data--;
 			return *this;
 		}
-		virtual const_iterator operator--(int) {
+		const_iterator operator--(int) {
 			const_iterator tmp = *this;
-			operator--();
+			data--;
 			return tmp;
 		}
-		virtual bool operator==(const const_iterator& rhs) const {
-			return data == rhs.data;
-		}
-		virtual bool operator!=(const const_iterator& rhs) const {
-			return data != rhs.data;
-		}
-		virtual const value_type& operator*() {
+		const value_type& operator*() const {
 			return *data;
 		}
-		virtual const value_type operator->() {
-			return *data;
+		const value_type* operator->() const {
+			return data;
 		}
-		virtual const_iterator operator+(int num) {
+		const value_type& operator[](difference_type num) const {
+			return data[num];
+		}
+		const_iterator& operator+=(difference_type num) {
 			data += num;
 			return *this;
 		}
-		virtual const_iterator operator-(int num) {
+		const_iterator& operator-=(difference_type num) {
 			data -= num;
 			return *this;
 		}
-		virtual value_type& operator[](const size_t num) {
-			return (*(data + num));
+		const_iterator operator+(difference_type num) const {
+			return const_iterator(data + num);
 		}
-		virtual bool operator<(const const_iterator x) {
-			return (data < x.data);
+		const_iterator operator-(difference_type num) const {
+			return const_iterator(data - num);
 		}
-		virtual bool operator>(const const_iterator x) {
-			return (data > x.data);
+		friend const_iterator operator+(difference_type num, const const_iterator& it) {
+			return const_iterator(it.data + num);
 		}
-		virtual bool operator<=(const const_iterator x) {
-			return (data <= x.data);
+		friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) {
+			return lhs.data - rhs.data;
 		}
-		virtual bool operator>=(const const_iterator x) {
-			return (data >= x.data);
+		friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) {
+			return lhs.data == rhs.data;
 		}
-		virtual const_iterator& operator+=(const size_t num) {
-			data += num;
-			return *this;
+		friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) {
+			return lhs.data != rhs.data;
 		}
-		virtual const_iterator& operator-=(const size_t num) {
-			data -= num;
-			return *this;
+		friend bool operator<(const const_iterator& lhs, const const_iterator& rhs) {
+			return lhs.data < rhs.data;
+		}
+		friend bool operator>(const const_iterator& lhs, const const_iterator& rhs) {
+			return lhs.data > rhs.data;
+		}
+		friend bool operator<=(const const_iterator& lhs, const const_iterator& rhs) {
+			return lhs.data <= rhs.data;
+		}
+		friend bool operator>=(const const_iterator& lhs, const const_iterator& rhs) {
+			return lhs.data >= rhs.data;
 		}
 	};
-	class reverse_iterator : public std::iterator<std::random_access_iterator_tag, value_type> {
-		public:
+	class reverse_iterator : public std::iterator<std::random_access_iterator_tag, value_type, difference_type, value_type*, value_type&> {
+	public:
 		T*		data;
 		reverse_iterator() : data(0) {};
 		reverse_iterator(T* src) : data(src) {}
-		reverse_iterator(const reverse_iterator& src) {
-			data = src.data;
-		}
-		reverse_iterator& operator=(const reverse_iterator& src) {
-			if (*this == src)
-				return (*this);
-			this->data = src.data;
-			return (*this);
-		}
-		virtual ~reverse_iterator() {};
-		virtual reverse_iterator& operator++() {
+		reverse_iterator& operator++() {
 			data--;
 			return *this;
 		}
-		virtual reverse_iterator operator++(int){
+		reverse_iterator operator++(int) {
 			reverse_iterator tmp = *this;
-			operator++();
+			data--;
 			return tmp;
 		}
-		virtual reverse_iterator& operator--() {
+		reverse_iterator& operator--() {
 			data++;
 			return *this;
 		}
-		virtual reverse_iterator operator--(int) {
+		reverse_iterator operator--(int) {
 			reverse_iterator tmp = *this;
-			operator--();
+			data++;
 			return tmp;
 		}
-		virtual bool operator==(const reverse_iterator& rhs) const {
-			return data == rhs.data;
-		}
-		virtual bool operator!=(const reverse_iterator& rhs) const {
-			return data != rhs.data;
-		}
-		virtual value_type& operator*() {
+		value_type& operator*() const {
 			return *data;
 		}
-		virtual value_type operator->() {
-			return *data;
+		value_type* operator->() const {
+			return data;
+		}
+		value_type& operator[](difference_type num) const {
+			return *(data - num);
 		}
-		virtual reverse_iterator operator+(int num) {
+		reverse_iterator& operator+=(difference_type num) {
 			data -= num;
 			return *this;
 		}
-		virtual reverse_iterator operator-(int num) {
+		reverse_iterator& operator-=(difference_type num) {
 			data += num;
 			return *this;
 		}
-		virtual value_type& operator[](const size_t num) {
-			return (*(data + num));
+		reverse_iterator operator+(difference_type num) const {
+			return reverse_iterator(data - num);
 		}
-		virtual bool operator<(const reverse_iterator x) {
-			return (data < x.data);
+		reverse_iterator operator-(difference_type num) const {
+			return reverse_iterator(data + num);
 		}
-		virtual bool operator>(const reverse_iterator x) {
-			return (data > x.data);
+		friend reverse_iterator operator+(difference_type num, const reverse_iterator& it) {
+			return reverse_iterator(it.data - num);
 		}
-		virtual bool operator<=(const reverse_iterator x) {
-			return (data <= x.data);
+		friend difference_type operator-(const reverse_iterator& lhs, const reverse_iterator& rhs) {
+			return rhs.data - lhs.data;
 		}
-		virtual bool operator>=(const reverse_iterator x) {
-			return (data >= x.data);
+		friend bool operator==(const reverse_iterator& lhs, const reverse_iterator& rhs) {
+			return lhs.data == rhs.data;
 		}
-		virtual reverse_iterator& operator+=(const size_t num) {
-			data -= num;
-			return *this;
+		friend bool operator!=(const reverse_iterator& lhs, const reverse_iterator& rhs) {
+			return lhs.data != rhs.data;
 		}
-		virtual reverse_iterator& operator-=(const size_t num) {
-			data += num;
-			return *this;
+		friend bool operator<(const reverse_iterator& lhs, const reverse_iterator& rhs) {
+			return lhs.data > rhs.data;
+		}
+		friend bool operator>(const reverse_iterator& lhs, const reverse_iterator& rhs) {
+			return lhs.data < rhs.data;
+		}
+		friend bool operator<=(const reverse_iterator& lhs, const reverse_iterator& rhs) {
+			return lhs.data >= rhs.data;
+		}
+		friend bool operator>=(const reverse_iterator& lhs, const reverse_iterator& rhs) {
+			return lhs.data <= rhs.data;
 		}
 	};
-	class const_reverse_iterator : public std::iterator<std::random_access_iterator_tag, value_type> {
-		public:
+	class const_reverse_iterator : public std::iterator<std::random_access_iterator_tag, value_type, difference_type, const value_type*, const value_type&> {
+	public:
 		T*		data;
 		const_reverse_iterator() : data(0) {};
 		const_reverse_iterator(T* src) : data(src) {}
-		const_reverse_iterator(const const_reverse_iterator& src) {
-			*this = src;
-		}
-		const_reverse_iterator& operator=(const const_reverse_iterator& src) {
-			if (*this == src)
-				return (*this);
-			this->data = src.data;
-			return (*this);
-		}
-		virtual ~const_reverse_iterator() {};
-		virtual const_reverse_iterator& operator++() {
+		const_reverse_iterator(const reverse_iterator& src) : data(src.data) {}
+		const_reverse_iterator& operator++() {
 			data--;
 			return *this;
 		}
-		virtual const_reverse_iterator operator++(int){
+		const_reverse_iterator operator++(int) {
 			const_reverse_iterator tmp = *this;
-			operator++();
+			data--;
 			return tmp;
 		}
-		virtual const_reverse_iterator& operator--() {
+		const_reverse_iterator& operator--() {
 			data++;
 			return *this;
 		}
-		virtual const_reverse_iterator operator--(int) {
+		const_reverse_iterator operator--(int) {
 			const_reverse_iterator tmp = *this;
-			operator--();
+			data++;
 			return tmp;
 		}
-		virtual bool operator==(const const_reverse_iterator& rhs) const {
-			return data == rhs.data;
-		}
-		virtual bool operator!=(const const_reverse_iterator& rhs) const {
-			return data != rhs.data;
-		}
-		virtual value_type& operator*() {
+		const value_type& operator*() const {
 			return *data;
 		}
-		virtual value_type operator->() {
-			return *data;
+		const value_type* operator->() const {
+			return data;
+		}
+		const value_type& operator[](difference_type num) const {
+			return *(data - num);
 		}
-		virtual const_reverse_iterator operator+(int num) {
+		const_reverse_iterator& operator+=(difference_type num) {
 			data -= num;
 			return *this;
 		}
-		virtual const_reverse_iterator operator-(int num) {
+		const_reverse_iterator& operator-=(difference_type num) {
 			data += num;
 			return *this;
 		}
-		virtual value_type& operator[](const size_t num) {
-			return (*(data + num));
+		const_reverse_iterator operator+(difference_type num) const {
+			return const_reverse_iterator(data - num);
 		}
-		virtual bool operator<(const const_reverse_iterator x) {
-			return (data < x.data);
+		const_reverse_iterator operator-(difference_type num) const {
+			return const_reverse_iterator(data + num);
 		}
-		virtual bool operator>(const const_reverse_iterator x) {
-			return (data > x.data);
+		friend const_reverse_iterator operator+(difference_type num, const const_reverse_iterator& it) {
+			return const_reverse_iterator(it.data - num);
 		}
-		virtual bool operator<=(const const_reverse_iterator x) {
-			return (data <= x.data);
+		friend difference_type operator-(const const_reverse_iterator& lhs, const const_reverse_iterator& rhs) {
+			return rhs.data - lhs.data;
 		}
-		virtual bool operator>=(const const_reverse_iterator x) {
-			return (data >= x.data);
+		friend bool operator==(const const_reverse_iterator& lhs, const const_reverse_iterator& rhs) {
+			return lhs.data == rhs.data;
 		}
-		virtual const_reverse_iterator& operator+=(const size_t num) {
-			data -= num;
-			return *this;
+		friend bool operator!=(const const_reverse_iterator& lhs, const const_reverse_iterator& rhs) {
+			return lhs.data != rhs.data;
 		}
-		virtual const_reverse_iterator& operator-=(const size_t num) {
-			data += num;
-			return *this;
+		friend bool operator<(const const_reverse_iterator& lhs, const const_reverse_iterator& rhs) {
+			return lhs.data > rhs.data;
+		}
+		friend bool operator>(const const_reverse_iterator& lhs, const const_reverse_iterator& rhs) {
+			return lhs.data < rhs.data;
+		}
+		friend bool operator<=(const const_reverse_iterator& lhs, const const_reverse_iterator& rhs) {
+			return lhs.data >= rhs.data;
+		}
+		friend bool operator>=(const const_reverse_iterator& lhs, const const_reverse_iterator& rhs) {
+			return lhs.data <= rhs.data;
 		}
 	};
 	iterator begin() {
 		return iterator(_data);
 	};
 	iterator end() {
-		iterator res = iterator(_data) + static_cast<int>(_size);
-		return res;
+		return iterator(_data + _size);
 	};
 	reverse_iterator rbegin() {
 		reverse_iterator res = reverse_iterator(_data + _size - 1);
@@ -419,26 +443,28 @@ public:
 	size_type max_size() const {
 		return std::numeric_limits<size_type>::max() / sizeof(value_type);
 	};
-	void resize (size_type n, value_type val = value_type()) {
-		size_type temp = _capacity;
-		if (n > _capacity) {
-			if (_capacity == 0)
-				_capacity = 1;
-			while (_capacity < n)
-				_capacity = _capacity * 2;
-		}
-		T* tmp = createArr(_capacity);
-		iterator it = begin();
-		iterator ite = end();
-		if (n > _size) {
-			copyArr(it, ite, tmp);
-			fillArr(val, _size, n, tmp);
-		}
-		else if (n < _size)
-			copyArr(it, ite, tmp);
-		clear();
-		_dataAlloc.deallocate(_data, temp);
-		_data = tmp;
+	void resize (size_type n) {
+		resize(n, value_type());
+	};
+	void resize (size_type n, const value_type& val) {
+		if (n <= _size) {
+			destroyRange(_data + n, _data + _size);
+			_size = n;
+			return;
+		}
+		value_type copy(val);
+		_data = realloc(&_capacity, n);
+		fillConstruct(_data + _size, n - _size, copy);
+		_size = n;
+	};
+	void resize_default_init (size_type n) {
+		if (n <= _size) {
+			destroyRange(_data + n, _data + _size);
+			_size = n;
+			return;
+		}
+		_data = realloc(&_capacity, n);
+		defaultConstruct(_data + _size, _data + n, std::integral_constant<bool, std::is_trivially_default_constructible<T>::value>());
 		_size = n;
 	};
 	size_type capacity() const {
@@ -448,18 +474,13 @@ public:
 		return (_size == 0);
 	};
 	void reserve (size_type n) {
-		if (n > _capacity) {
-			size_type temp = _size;
-			T* tmp = createArr(n);
-			iterator it = begin();
-			iterator ite = end();
-			copyArr(it, ite, tmp);
-			clear();
-			_dataAlloc.deallocate(_data, _capacity);
-			_data = tmp;
-			_capacity = n;
-			_size = temp;
-		}
+		if (n > _capacity)
+			relocate(fitCapacity(n));
+	};
+	void shrink_to_fit() {
+		size_type capacity = fitCapacity(_size);
+		if (_capacity > capacity)
+			relocate(capacity);
 	};
 	
 	//MARK: - Element access
@@ -495,79 +516,57 @@ public:
 	//MARK: - Modifiers
 	template <class InputIterator>
 	void assign (InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
-		clear();
-		iterator ite = end();
-		long i = 0;
-		for (InputIterator tmp = first; tmp != last; tmp++)
-			i++;
-		_data = realloc(&_capacity, _size + i);
-		move(begin(), end(), i);
-		for (int i = 0; first != last; i++) {
-			_data[i] = *first;
-			_size++;
-			first++;
-		}
+		rangeAssign(first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 	};
 	void assign (size_type n, const value_type& val) {
-		clear();
-		_data = createArr(n);
+		value_type copy(val);
+		if (n > _capacity) {
+			size_type capacity = fitCapacity(n);
+			T* tmp = fillArr(n, capacity, copy);
+			replaceArr(tmp, n, capacity);
+			return;
+		}
+		size_type common = n < _size ? n : _size;
+		std::fill(_data, _data + common, copy);
+		fillConstruct(_data + common, n - common, copy);
+		destroyRange(_data + common, _data + _size);
 		_size = n;
-		_capacity = n;
-		fillArr(val, 0, n, _data);
 	};
 	void push_back (const value_type& val) {
-		_data = realloc(&_capacity, _size + 1);
-		_data[_size] = val;
+		if (_size == _capacity) {
+			value_type copy(val);
+			_data = realloc(&_capacity, _size + 1);
+			_dataAlloc.construct(_data + _size, copy);
+		}
+		else
+			_dataAlloc.construct(_data + _size, val);
 		_size++;
 	};
 	void pop_back() {
 		_size--;
-		_dataAlloc.destroy(&_data[_size]);
+		destroyRange(_data + _size, _data + _size + 1);
 	};
 	iterator insert (iterator position, const value_type& val) {
-		iterator ite = end();
 		long tmp = position.data - _data;
-		_data = realloc(&_capacity, _size + 1);
-		move(position, end(), 1);
-		_data[tmp] = val;
-		_size++;
+		insert(position, 1, val);
 		iterator res(_data + tmp);
 		return res;
 	};
 	void insert (iterator position, size_type n, const value_type& val) {
-		iterator ite = end();
 		long tmp = position.data - _data;
+		value_type copy(val);
 		_data = realloc(&_capacity, _size + n);
-		move(position, end(), static_cast<int>(n));
-		for (size_t i = 0; i < n; i++) {
-			_data[tmp] = val;
-			_size++;
-			tmp++;
-		}
+		fillGap(tmp, n, [&]() { return &copy; });
 	};
 	template <class InputIterator>
 	void insert (iterator position, InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
-		long i = 0;
-		for (InputIterator tmp = first; tmp != last; tmp++)
-			i++;
-		_data = realloc(&_capacity, _size + i);
-		iterator ite = end();
-		iterator res(_data + (position.data - _data));
-		move(position, end(), i);
-		for (; first != last; first++) {
-			*res = *first;
-			res++;
-			_size++;
-		}
+		rangeInsert(position.data - _data, first, last, typename std::iterator_traits<InputIterator>::iterator_category());
 	};
 	iterator erase (iterator position) {
-		moveBack(position, end(), 1);
-		_size--;
-		return position;
+		return erase(position, position + 1);
 	};
 	iterator erase (iterator first, iterator last) {
-		moveBack(first, end(), static_cast<int>(last.data - first.data));
-		_size -= last.data - first.data;
+		closeGap(first.data - _data, last.data - first.data);
 		return first;
 	};
 	void swap (vector& x) {
@@ -582,137 +581,266 @@ public:
 		x._capacity = tmpCapacity;
 	};
 	void clear() {
-		while (_size != 0)
-			pop_back();
+		destroyRange(_data, _data + _size);
+		_size = 0;
 	};
 	
 	//MARK: - Utility
 private:
+	static size_type fitCapacity(size_type n) {
+		return Growth::fit(n, sizeof(value_type));
+	}
 	T* createArr(size_type n) {
-		T* cont = _dataAlloc.allocate(n);
-		T* tmp = cont;
-		for (size_t i = 0; i < n; i++)
-			_dataAlloc.construct(tmp++, T());
-		return cont;
+		return _dataAlloc.allocate(n);
+	}
+	void destroyRange(T* first, T* last) {
+		destroyRange(first, last, std::integral_constant<bool, std::is_trivially_destructible<T>::value>());
+	}
+	void destroyRange(T*, T*, std::true_type) {}
+	void destroyRange(T* first, T* last, std::false_type) {
+		for (; first != last; first++)
+			_dataAlloc.destroy(first);
 	}
-	void fillArr(const value_type& val, size_type start, size_type finish, T* data) {
-		for (; start < finish; start++) {
-			data[start] = val;
+	void fillConstruct(T* data, size_type n, const value_type& val) {
+		size_type i = 0;
+		try {
+			for (; i < n; i++)
+				_dataAlloc.construct(data + i, val);
 		}
+		catch (...) {
+			destroyRange(data, data + i);
+			throw;
+		}
+	}
+	void defaultConstruct(T*, T*, std::true_type) {}
+	void defaultConstruct(T* first, T* last, std::false_type) {
+		for (; first != last; first++)
+			::new (static_cast<void*>(first)) T;
 	}
 	template <class InputIterator>
-	size_t copyArr(InputIterator first, InputIterator last, T* data, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
+	size_t copyConstruct(InputIterator first, InputIterator last, T* data, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
 		size_t arrSize = 0;
-		for (; first != last; first++) {
-			data[arrSize] = *first;
-			arrSize++;
+		try {
+			for (; first != last; first++) {
+				_dataAlloc.construct(data + arrSize, *first);
+				arrSize++;
+			}
+		}
+		catch (...) {
+			destroyRange(data, data + arrSize);
+			throw;
 		}
 		return arrSize;
 	}
-	void constCopyArr(const_iterator first, const_iterator last, T* data) {
-		for (size_t i = 0; first != last; first++) {
-			data[i] = *first;
-			i++;
+	template <class ForwardIterator>
+	T* buildArr(ForwardIterator first, ForwardIterator last, size_type capacity) {
+		T* tmp = createArr(capacity);
+		try {
+			copyConstruct(first, last, tmp);
+		}
+		catch (...) {
+			_dataAlloc.deallocate(tmp, capacity);
+			throw;
 		}
+		return tmp;
 	}
-	T* realloc(size_type *capacity, size_type n) {
-		size_type temp = _capacity;
-		if (n > *capacity) {
-			if (*capacity == 0)
-				*capacity = 1;
-			while (*capacity < n)
-				*capacity = *capacity * 2;
-			T* tmp = createArr(*capacity);
-			size_type elems = copyArr(begin(), end(), tmp);
-			clear();
-			_dataAlloc.deallocate(_data, temp);
-			_data = tmp;
-			_size = elems;
+	T* fillArr(size_type n, size_type capacity, const value_type& val) {
+		T* tmp = createArr(capacity);
+		try {
+			fillConstruct(tmp, n, val);
+		}
+		catch (...) {
+			_dataAlloc.deallocate(tmp, capacity);
+			throw;
+		}
+		return tmp;
+	}
+	void replaceArr(T* data, size_type size, size_type capacity) {
+		destroyRange(_data, _data + _size);
+		_dataAlloc.deallocate(_data, _capacity);
+		_data = data;
+		_size = size;
+		_capacity = capacity;
+	}
+	void relocate(size_type capacity) {
+		T* tmp = buildArr(_data, _data + _size, capacity);
+		replaceArr(tmp, _size, capacity);
+	}
+	template <class InputIterator>
+	void assignRange(InputIterator first, InputIterator last, size_type n) {
+		if (n > _capacity) {
+			size_type capacity = fitCapacity(n);
+			T* tmp = buildArr(first, last, capacity);
+			replaceArr(tmp, n, capacity);
+			return;
 		}
+		size_type i = 0;
+		for (; i < _size && first != last; i++, first++)
+			_data[i] = *first;
+		if (i < _size)
+			destroyRange(_data + i, _data + _size);
+		else
+			i += copyConstruct(first, last, _data + i);
+		_size = i;
+	}
+	T* realloc(size_type *capacity, size_type n) {
+		if (n > *capacity)
+			relocate(Growth::next(*capacity, n, sizeof(value_type)));
 		return _data;
 	}
-	void move(iterator pos, iterator end, long n) {
-		iterator cur = end;
-		cur += static_cast<int>(n);
-		while (end != pos) {
-			*cur = *end;
-			end--;
-			cur--;
-		}
-		*cur = *end;
+	template <class InputIterator>
+	void rangeInit(InputIterator first, InputIterator last, std::input_iterator_tag) {
+		try {
+			for (; first != last; first++)
+				push_back(*first);
+		}
+		catch (...) {
+			destroyRange(_data, _data + _size);
+			_dataAlloc.deallocate(_data, _capacity);
+			throw;
+		}
 	}
-	void moveBack(iterator pos, iterator end, long n) {
-		iterator cur = pos;
-		cur += static_cast<int>(n);
-		while (cur != end) {
-			*pos = *cur;
-			pos++;
-			cur++;
-		}
-		*pos = *cur;
+	template <class ForwardIterator>
+	void rangeInit(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+		size_type n = std::distance(first, last);
+		_capacity = fitCapacity(n);
+		_data = buildArr(first, last, _capacity);
+		_size = n;
+	}
+	template <class InputIterator>
+	void rangeAssign(InputIterator first, InputIterator last, std::input_iterator_tag) {
+		size_type i = 0;
+		for (; i < _size && first != last; i++, first++)
+			_data[i] = *first;
+		if (i < _size) {
+			destroyRange(_data + i, _data + _size);
+			_size = i;
+		}
+		for (; first != last; first++)
+			push_back(*first);
+	}
+	template <class ForwardIterator>
+	void rangeAssign(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+		assignRange(first, last, std::distance(first, last));
+	}
+	template <class InputIterator>
+	void rangeInsert(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag) {
+		if (index == _size) {
+			for (; first != last; first++)
+				push_back(*first);
+			return;
+		}
+		vector buffer(first, last, _dataAlloc);
+		rangeInsert(index, buffer._data, buffer._data + buffer._size, std::random_access_iterator_tag());
+	}
+	template <class ForwardIterator>
+	void rangeInsert(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+		size_type n = std::distance(first, last);
+		if (n == 0)
+			return;
+		if (_size + n > _capacity) {
+			size_type capacity = Growth::next(_capacity, _size + n, sizeof(value_type));
+			T* tmp = createArr(capacity);
+			size_type done = 0;
+			try {
+				done = copyConstruct(_data, _data + index, tmp);
+				done += copyConstruct(first, last, tmp + done);
+				done += copyConstruct(_data + index, _data + _size, tmp + done);
+			}
+			catch (...) {
+				destroyRange(tmp, tmp + done);
+				_dataAlloc.deallocate(tmp, capacity);
+				throw;
+			}
+			replaceArr(tmp, _size + n, capacity);
+			return;
+		}
+		fillGap(index, n, [&]() { return first++; });
+	}
+	//Shifts the tail up by n within capacity and writes *next() into the gap.
+	//Slots built past _size are destroyed again if a copy throws.
+	template <class Next>
+	void fillGap(size_type index, size_type n, Next next) {
+		size_type split = index + n > _size ? index + n : _size;
+		size_type built = split;
+		size_type cur = index;
+		try {
+			for (; built < _size + n; built++)
+				_dataAlloc.construct(_data + built, _data[built - n]);
+			std::copy_backward(_data + index, _data + split - n, _data + split);
+			for (; cur < index + n; cur++) {
+				if (cur < _size)
+					_data[cur] = *next();
+				else
+					_dataAlloc.construct(_data + cur, *next());
+			}
+		}
+		catch (...) {
+			if (cur > _size)
+				destroyRange(_data + _size, _data + cur);
+			destroyRange(_data + split, _data + built);
+			throw;
+		}
+		_size += n;
+	}
+	void closeGap(size_type index, size_type n) {
+		std::copy(_data + index + n, _data + _size, _data + index);
+		destroyRange(_data + _size - n, _data + _size);
+		_size -= n;
 	}
 };
 
 //MARK: - Non-member function overloads
-template <class T, class Alloc>
-bool operator== (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator== (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs) {
 	if (lhs.size() != rhs.size())
 		return false;
-	typename ft::vector<T>::const_iterator lit = lhs.cbegin();
-	typename ft::vector<T>::const_iterator lite = lhs.cend();
-	typename ft::vector<T>::const_iterator rit = rhs.cbegin();
-	typename ft::vector<T>::const_iterator rite = rhs.cend();
-	while (lit != lite) {
-		if (*lit != *rit)
-			return false ;
-		lit++;
-		rit++;
-	}
-	if (lhs.size() == rhs.size())
-		return true ;
-	return false;
+	return ft::simd::equal(lhs.cbegin().data, rhs.cbegin().data, lhs.size());
 };
-template <class T, class Alloc>
-bool operator!= (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator!= (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs) {
 	return !(lhs == rhs);
 };
-template <class T, class Alloc>
-bool operator<  (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {
-	size_t size;
-	if (lhs.size() < rhs.size())
-		size = lhs.size();
-	else
-		size = rhs.size();
-	typename ft::vector<T>::const_iterator lit = lhs.cbegin();
-	typename ft::vector<T>::const_iterator lite = lhs.cend();
-	typename ft::vector<T>::const_iterator rit = rhs.cbegin();
-	typename ft::vector<T>::const_iterator rite = rhs.cend();
-	for (size_t i = 0; i < size; i++) {
-		if (*rit < *lit)
-			return false;
-		else if (*lit < *rit)
-			return true;
-		lit++;
-		rit++;
-	}
-	return false;
+template <class T, class Alloc, class Growth>
+bool operator<  (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs) {
+	return ft::simd::lexicographical_less(lhs.cbegin().data, lhs.size(), rhs.cbegin().data, rhs.size());
 };
-template <class T, class Alloc>
-bool operator<= (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator<= (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs) {
 	return (lhs < rhs || lhs == rhs);
 };
-template <class T, class Alloc>
-bool operator>  (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator>  (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs) {
 	return !(lhs <= rhs);
 };
-template <class T, class Alloc>
-bool operator>= (const vector<T,Alloc>& lhs, const vector<T,Alloc>& rhs) {
+template <class T, class Alloc, class Growth>
+bool operator>= (const vector<T,Alloc,Growth>& lhs, const vector<T,Alloc,Growth>& rhs) {
 	return (!(lhs < rhs) || lhs == rhs);
 };
-template <class T, class Alloc>
-void swap (vector<T,Alloc>& x, vector<T,Alloc>& y) {
+template <class T, class Alloc, class Growth>
+void swap (vector<T,Alloc,Growth>& x, vector<T,Alloc,Growth>& y) {
 	x.swap(y);
 };
+
+//MARK: - Search
+template <class T, class Alloc, class Growth>
+typename vector<T,Alloc,Growth>::const_iterator find (const vector<T,Alloc,Growth>& v, const T& val) {
+	return typename vector<T,Alloc,Growth>::const_iterator(const_cast<T*>(ft::simd::find(v.cbegin().data, v.cend().data, val)));
+};
+template <class T, class Alloc, class Growth>
+typename vector<T,Alloc,Growth>::size_type count (const vector<T,Alloc,Growth>& v, const T& val) {
+	return ft::simd::count(v.cbegin().data, v.cend().data, val);
 };
+template <class T, class Alloc, class Growth>
+typename vector<T,Alloc,Growth>::const_iterator min_element (const vector<T,Alloc,Growth>& v) {
+	return typename vector<T,Alloc,Growth>::const_iterator(const_cast<T*>(ft::simd::min_element(v.cbegin().data, v.cend().data)));
+};
+template <class T, class Alloc, class Growth>
+typename vector<T,Alloc,Growth>::const_iterator max_element (const vector<T,Alloc,Growth>& v) {
+	return typename vector<T,Alloc,Growth>::const_iterator(const_cast<T*>(ft::simd::max_element(v.cbegin().data, v.cend().data)));
+};
+};
+
+#include "vector_bool.hpp"
 
 #endif
@@ -0,0 +1,536 @@
+#ifndef vector_bool_hpp
+#define vector_bool_hpp
+
+#include "vector.hpp"
+
+namespace ft {
+template <class Alloc, class Growth>
+class vector<bool, Alloc, Growth> {
+private:
+	typedef unsigned long t_word;
+	typedef typename Alloc::template rebind<t_word>::other t_wordAlloc;
+	static const size_t wordBits = sizeof(t_word) * 8;
+
+	t_word*			_words;
+	size_t			_capacity;
+	size_t			_size;
+	t_wordAlloc		_wordAlloc;
+public:
+	//MARK: - Member types
+	typedef bool value_type;
+	typedef Alloc allocator_type;
+	typedef bool const_reference;
+	typedef ptrdiff_t difference_type;
+	typedef size_t size_type;
+	typedef Growth growth_policy;
+
+	class reference {
+	public:
+		t_word*		word;
+		t_word		mask;
+		reference(t_word* src, t_word bit) : word(src), mask(bit) {}
+		operator bool() const {
+			return (*word & mask) != 0;
+		}
+		reference& operator=(bool val) {
+			if (val)
+				*word |= mask;
+			else
+				*word &= ~mask;
+			return *this;
+		}
+		reference& operator=(const reference& src) {
+			return *this = bool(src);
+		}
+		bool operator~() const {
+			return !bool(*this);
+		}
+		void flip() {
+			*word ^= mask;
+		}
+		friend void swap(reference lhs, reference rhs) {
+			bool tmp = lhs;
+			lhs = bool(rhs);
+			rhs = tmp;
+		}
+	};
+
+	//MARK: - Iterators
+	class bitCursor {
+	public:
+		t_word*		word;
+		size_t		bit;
+		bitCursor(t_word* src, size_t offset) : word(src), bit(offset) {}
+		void increment() {
+			if (++bit == wordBits) {
+				bit = 0;
+				word++;
+			}
+		}
+		void decrement() {
+			if (bit-- == 0) {
+				bit = wordBits - 1;
+				word--;
+			}
+		}
+		void advance(difference_type num) {
+			difference_type pos = static_cast<difference_type>(bit) + num;
+			difference_type bits = static_cast<difference_type>(wordBits);
+			word += pos / bits;
+			pos %= bits;
+			if (pos < 0) {
+				pos += bits;
+				word--;
+			}
+			bit = static_cast<size_t>(pos);
+		}
+		friend difference_type operator-(const bitCursor& lhs, const bitCursor& rhs) {
+			return (lhs.word - rhs.word) * static_cast<difference_type>(wordBits) + static_cast<difference_type>(lhs.bit) - static_cast<difference_type>(rhs.bit);
+		}
+		friend bool operator==(const bitCursor& lhs, const bitCursor& rhs) {
+			return lhs.word == rhs.word && lhs.bit == rhs.bit;
+		}
+		friend bool operator!=(const bitCursor& lhs, const bitCursor& rhs) {
+			return !(lhs == rhs);
+		}
+		friend bool operator<(const bitCursor& lhs, const bitCursor& rhs) {
+			return lhs.word < rhs.word || (lhs.word == rhs.word && lhs.bit < rhs.bit);
+		}
+		friend bool operator>(const bitCursor& lhs, const bitCursor& rhs) {
+			return rhs < lhs;
+		}
+		friend bool operator<=(const bitCursor& lhs, const bitCursor& rhs) {
+			return !(rhs < lhs);
+		}
+		friend bool operator>=(const bitCursor& lhs, const bitCursor& rhs) {
+			return !(lhs < rhs);
+		}
+	};
+	class iterator : public bitCursor, public std::iterator<std::random_access_iterator_tag, bool, difference_type, void, reference> {
+	public:
+		iterator() : bitCursor(0, 0) {}
+		iterator(t_word* src, size_t offset) : bitCursor(src, offset) {}
+		reference operator*() const {
+			return reference(this->word, t_word(1) << this->bit);
+		}
+		reference operator[](difference_type num) const {
+			return *(*this + num);
+		}
+		iterator& operator++() {
+			this->increment();
+			return *this;
+		}
+		iterator operator++(int) {
+			iterator tmp = *this;
+			this->increment();
+			return tmp;
+		}
+		iterator& operator--() {
+			this->decrement();
+			return *this;
+		}
+		iterator operator--(int) {
+			iterator tmp = *this;
+			this->decrement();
+			return tmp;
+		}
+		iterator& operator+=(difference_type num) {
+			this->advance(num);
+			return *this;
+		}
+		iterator& operator-=(difference_type num) {
+			this->advance(-num);
+			return *this;
+		}
+		iterator operator+(difference_type num) const {
+			iterator tmp = *this;
+			return tmp += num;
+		}
+		iterator operator-(difference_type num) const {
+			iterator tmp = *this;
+			return tmp -= num;
+		}
+		friend iterator operator+(difference_type num, const iterator& it) {
+			return it + num;
+		}
+	};
+	class const_iterator : public bitCursor, public std::iterator<std::random_access_iterator_tag, bool, difference_type, void, bool> {
+	public:
+		const_iterator() : bitCursor(0, 0) {}
+		const_iterator(t_word* src, size_t offset) : bitCursor(src, offset) {}
+		const_iterator(const typename vector::iterator& src) : bitCursor(src.word, src.bit) {}
+		bool operator*() const {
+			return (*this->word >> this->bit) & 1;
+		}
+		bool operator[](difference_type num) const {
+			return *(*this + num);
+		}
+		const_iterator& operator++() {
+			this->increment();
+			return *this;
+		}
+		const_iterator operator++(int) {
+			const_iterator tmp = *this;
+			this->increment();
+			return tmp;
+		}
+		const_iterator& operator--() {
+			this->decrement();
+			return *this;
+		}
+		const_iterator operator--(int) {
+			const_iterator tmp = *this;
+			this->decrement();
+			return tmp;
+		}
+		const_iterator& operator+=(difference_type num) {
+			this->advance(num);
+			return *this;
+		}
+		const_iterator& operator-=(difference_type num) {
+			this->advance(-num);
+			return *this;
+		}
+		const_iterator operator+(difference_type num) const {
+			const_iterator tmp = *this;
+			return tmp += num;
+		}
+		const_iterator operator-(difference_type num) const {
+			const_iterator tmp = *this;
+			return tmp -= num;
+		}
+		friend const_iterator operator+(difference_type num, const const_iterator& it) {
+			return it + num;
+		}
+	};
+	typedef std::reverse_iterator<iterator> reverse_iterator;
+	typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	//MARK: - Constructors
+	explicit vector (const allocator_type& alloc = allocator_type()) : _words(0), _capacity(0), _size(0), _wordAlloc(alloc) {};
+	explicit vector (size_type n, const value_type& val = false, const allocator_type& alloc = allocator_type()) : _words(0), _capacity(0), _size(0), _wordAlloc(alloc) {
+		assign(n, val);
+	};
+	template <class InputIterator>
+	vector (InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type(), typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) : _words(0), _capacity(0), _size(0), _wordAlloc(alloc) {
+		insert(end(), first, last);
+	};
+	vector (const vector& x) : _words(0), _capacity(0), _size(0), _wordAlloc(x._wordAlloc) {
+		*this = x;
+	};
+
+	//MARK: - Destructor
+	~vector() {
+		_wordAlloc.deallocate(_words, wordCount(_capacity));
+	};
+
+	//MARK: - Assign
+	vector& operator=(const vector& x) {
+		if (this == &x)
+			return (*this);
+		fillBits(0, _size, false);
+		if (x._size > _capacity)
+			reallocate(wordCount(x._size));
+		std::copy(x._words, x._words + wordCount(x._size), _words);
+		_size = x._size;
+		return (*this);
+	};
+
+	//MARK: - Iterators
+	iterator begin() {
+		return iterator(_words, 0);
+	};
+	const_iterator begin() const {
+		return const_iterator(_words, 0);
+	};
+	iterator end() {
+		return iterator(_words + _size / wordBits, _size % wordBits);
+	};
+	const_iterator end() const {
+		return const_iterator(_words + _size / wordBits, _size % wordBits);
+	};
+	reverse_iterator rbegin() {
+		return reverse_iterator(end());
+	};
+	const_reverse_iterator rbegin() const {
+		return const_reverse_iterator(end());
+	};
+	reverse_iterator rend() {
+		return reverse_iterator(begin());
+	};
+	const_reverse_iterator rend() const {
+		return const_reverse_iterator(begin());
+	};
+	const_iterator cbegin() const {
+		return begin();
+	};
+	const_iterator cend() const {
+		return end();
+	};
+	const_reverse_iterator crbegin() const {
+		return rbegin();
+	};
+	const_reverse_iterator crend() const {
+		return rend();
+	};
+
+	//MARK: - Capacity
+	size_type size() const {
+		return _size;
+	};
+	size_type max_size() const {
+		return static_cast<size_type>(std::numeric_limits<difference_type>::max());
+	};
+	void resize (size_type n, value_type val = false) {
+		if (n < _size)
+			fillBits(n, _size, false);
+		else {
+			growFor(n);
+			if (val)
+				fillBits(_size, n, true);
+		}
+		_size = n;
+	};
+	size_type capacity() const {
+		return _capacity;
+	};
+	bool empty() const {
+		return (_size == 0);
+	};
+	void reserve (size_type n) {
+		if (n > _capacity)
+			reallocate(wordCount(n));
+	};
+	void shrink_to_fit() {
+		if (wordCount(_size) < wordCount(_capacity))
+			reallocate(wordCount(_size));
+	};
+
+	//MARK: - Element access
+	reference operator[] (size_type n) {
+		return reference(_words + n / wordBits, t_word(1) << (n % wordBits));
+	};
+	const_reference operator[] (size_type n) const {
+		return getBit(n);
+	};
+	reference at (size_type n) {
+		if (n >= _size)
+			throw std::out_of_range("index out of range");
+		return (*this)[n];
+	};
+	const_reference at (size_type n) const {
+		if (n >= _size)
+			throw std::out_of_range("index out of range");
+		return getBit(n);
+	};
+	reference front() {
+		return (*this)[0];
+	};
+	const_reference front() const {
+		return getBit(0);
+	};
+	reference back() {
+		return (*this)[_size - 1];
+	};
+	const_reference back() const {
+		return getBit(_size - 1);
+	};
+
+	//MARK: - Modifiers
+	template <class InputIterator>
+	void assign (InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
+		clear();
+		insert(end(), first, last);
+	};
+	void assign (size_type n, const value_type& val) {
+		clear();
+		reserve(n);
+		if (val)
+			fillBits(0, n, true);
+		_size = n;
+	};
+	void push_back (const value_type& val) {
+		growFor(_size + 1);
+		if (val)
+			setBit(_size, true);
+		_size++;
+	};
+	void pop_back() {
+		_size--;
+		setBit(_size, false);
+	};
+	iterator insert (iterator position, const value_type& val) {
+		size_type index = position - begin();
+		insert(position, 1, val);
+		return begin() + index;
+	};
+	void insert (iterator position, size_type n, const value_type& val) {
+		size_type index = position - begin();
+		openGap(index, n);
+		fillBits(index, index + n, val);
+	};
+	template <class InputIterator>
+	void insert (iterator position, InputIterator first, InputIterator last, typename std::enable_if<std::__is_input_iterator<InputIterator>::value>::type* = 0) {
+		rangeInsert(position - begin(), first, last, typename std::iterator_traits<InputIterator>::iterator_category());
+	};
+	iterator erase (iterator position) {
+		return erase(position, position + 1);
+	};
+	iterator erase (iterator first, iterator last) {
+		size_type index = first - begin();
+		size_type n = last - first;
+		for (size_type i = index + n; i < _size; i++)
+			setBit(i - n, getBit(i));
+		fillBits(_size - n, _size, false);
+		_size -= n;
+		return begin() + index;
+	};
+	void swap (vector& x) {
+		t_word* tmpWords = _words;
+		size_type tmpSize = _size;
+		size_type tmpCapacity = _capacity;
+		_words = x._words;
+		_size = x._size;
+		_capacity = x._capacity;
+		x._words = tmpWords;
+		x._size = tmpSize;
+		x._capacity = tmpCapacity;
+	};
+	void clear() {
+		fillBits(0, _size, false);
+		_size = 0;
+	};
+	void flip() {
+		size_type words = wordCount(_size);
+		for (size_type i = 0; i < words; i++)
+			_words[i] = ~_words[i];
+		if (_size % wordBits)
+			_words[words - 1] &= ~t_word(0) >> (wordBits - _size % wordBits);
+	};
+
+	//MARK: - Search
+	size_type count (value_type val) const {
+		size_type ones = 0;
+		size_type words = wordCount(_size);
+		for (size_type i = 0; i < words; i++)
+			ones += __builtin_popcountl(_words[i]);
+		return val ? ones : _size - ones;
+	};
+	const_iterator find (value_type val) const {
+		size_type words = wordCount(_size);
+		for (size_type i = 0; i < words; i++) {
+			t_word bits = val ? _words[i] : ~_words[i];
+			if (bits == 0)
+				continue;
+			size_type pos = i * wordBits + __builtin_ctzl(bits);
+			if (pos >= _size)
+				break;
+			return begin() + pos;
+		}
+		return end();
+	};
+
+	//MARK: - Non-member function overloads
+	friend bool operator== (const vector& lhs, const vector& rhs) {
+		if (lhs._size != rhs._size)
+			return false;
+		return std::equal(lhs._words, lhs._words + wordCount(lhs._size), rhs._words);
+	};
+	friend bool operator< (const vector& lhs, const vector& rhs) {
+		size_type n = lhs._size < rhs._size ? lhs._size : rhs._size;
+		size_type words = wordCount(n);
+		for (size_type i = 0; i < words; i++) {
+			t_word diff = lhs._words[i] ^ rhs._words[i];
+			if (diff == 0)
+				continue;
+			size_type pos = i * wordBits + __builtin_ctzl(diff);
+			if (pos >= n)
+				break;
+			return (rhs._words[i] >> (pos % wordBits)) & 1;
+		}
+		return lhs._size < rhs._size;
+	};
+
+	//MARK: - Utility
+private:
+	static size_type wordCount(size_type bits) {
+		return (bits + wordBits - 1) / wordBits;
+	}
+	bool getBit(size_type index) const {
+		return (_words[index / wordBits] >> (index % wordBits)) & 1;
+	}
+	void setBit(size_type index, bool val) {
+		setMask(index / wordBits, t_word(1) << (index % wordBits), val);
+	}
+	void setMask(size_type word, t_word mask, bool val) {
+		if (val)
+			_words[word] |= mask;
+		else
+			_words[word] &= ~mask;
+	}
+	void fillBits(size_type from, size_type to, bool val) {
+		if (from >= to)
+			return;
+		size_type first = from / wordBits;
+		size_type last = (to - 1) / wordBits;
+		t_word head = ~t_word(0) << (from % wordBits);
+		t_word tail = ~t_word(0) >> (wordBits - 1 - (to - 1) % wordBits);
+		if (first == last) {
+			setMask(first, head & tail, val);
+			return;
+		}
+		setMask(first, head, val);
+		for (size_type i = first + 1; i < last; i++)
+			_words[i] = val ? ~t_word(0) : 0;
+		setMask(last, tail, val);
+	}
+	void reallocate(size_type words) {
+		t_word* tmp = _wordAlloc.allocate(words);
+		size_type used = wordCount(_size);
+		std::copy(_words, _words + used, tmp);
+		std::fill(tmp + used, tmp + words, t_word(0));
+		_wordAlloc.deallocate(_words, wordCount(_capacity));
+		_words = tmp;
+		_capacity = words * wordBits;
+	}
+	void growFor(size_type bits) {
+		if (bits > _capacity)
+			reallocate(Growth::next(wordCount(_capacity), wordCount(bits), sizeof(t_word)));
+	}
+	void openGap(size_type index, size_type n) {
+		growFor(_size + n);
+		for (size_type i = _size; i > index; i--)
+			setBit(i - 1 + n, getBit(i - 1));
+		_size += n;
+	}
+	template <class InputIterator>
+	void rangeInsert(size_type index, InputIterator first, InputIterator last, std::input_iterator_tag) {
+		if (index == _size) {
+			for (; first != last; first++)
+				push_back(*first);
+			return;
+		}
+		vector buffer(first, last);
+		rangeInsert(index, buffer.begin(), buffer.end(), std::random_access_iterator_tag());
+	}
+	template <class ForwardIterator>
+	void rangeInsert(size_type index, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+		size_type n = std::distance(first, last);
+		openGap(index, n);
+		for (size_type i = index; first != last; first++)
+			setBit(i++, *first);
+	}
+};
+
+//MARK: - Search
+template <class Alloc, class Growth>
+typename vector<bool,Alloc,Growth>::const_iterator find (const vector<bool,Alloc,Growth>& v, const bool& val) {
+	return v.find(val);
+};
+template <class Alloc, class Growth>
+typename vector<bool,Alloc,Growth>::size_type count (const vector<bool,Alloc,Growth>& v, const bool& val) {
+	return v.count(val);
+};
+};
+
+#endif